@@ -0,0 +1,51 @@
+#include "Arena.h"
+#include "Log.h"
+#include <cstdarg>
+#include <cstdio>
+
+Arena::Arena(const char* name, size_t capacity)
+    : name(name)
+    , block(new std::byte[capacity])
+    , blockSize(capacity)
+{
+    bump.emplace(block.get(), blockSize, std::pmr::new_delete_resource());
+}
+
+void Arena::reset() {
+    bump.reset(); // Frees any heap spill
+    if (used > blockSize) {
+        // Alignment padding is not counted in `used`, so leave some headroom
+        size_t grown = blockSize;
+        while (grown < used + used / 4) grown *= 2;
+        LOG_WARN(CORE, "%s arena overflowed (%llu of %llu bytes), growing to %llu", name,
+                 static_cast<unsigned long long>(used), static_cast<unsigned long long>(blockSize),
+                 static_cast<unsigned long long>(grown));
+        block.reset(new std::byte[grown]);
+        blockSize = grown;
+    }
+    bump.emplace(block.get(), blockSize, std::pmr::new_delete_resource());
+    used = 0;
+}
+
+const char* Arena::format(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    va_list measure;
+    va_copy(measure, args);
+    int length = std::vsnprintf(nullptr, 0, format, measure);
+    va_end(measure);
+
+    if (length < 0) {
+        va_end(args);
+        return "";
+    }
+    char* text = static_cast<char*>(allocate(static_cast<size_t>(length) + 1, 1));
+    std::vsnprintf(text, static_cast<size_t>(length) + 1, format, args);
+    va_end(args);
+    return text;
+}
+
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    used += bytes;
+    return bump->allocate(bytes, alignment);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+// Bump allocator for data that dies together: everything handed out since the
+// last reset() is released at once, and deallocate() is a no-op. Use it through
+// std::pmr containers (std::pmr::vector<T> v(&arena)) or format() for strings.
+//
+// Allocations come from one preallocated block. If a cycle spills past it the
+// spill goes to the heap, and the next reset() grows the block to the observed
+// peak, so steady state never touches the heap.
+//
+// Anything still pointing into the arena is dangling after reset(); containers
+// that outlive a cycle have to drop their storage first.
+class Arena : public std::pmr::memory_resource {
+public:
+    Arena(const char* name, size_t capacity);
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void reset();
+
+    // printf into arena memory; valid until the next reset()
+    const char* format(const char* format, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 2, 3)))
+#endif
+        ;
+
+    size_t bytesUsed() const { return used; }
+    size_t capacity() const { return blockSize; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    const char* name;
+    std::unique_ptr<std::byte[]> block;
+    size_t blockSize;
+    std::optional<std::pmr::monotonic_buffer_resource> bump;
+    size_t used = 0;   // Requested bytes this cycle, alignment padding not included
+};
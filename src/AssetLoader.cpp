@@ -0,0 +1,253 @@
+#include "AssetLoader.h"
+#include "Log.h"
+#include "PixelBlend.h"
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cstring>
+
+AssetLoader::AssetLoader()
+    : renderer(nullptr), stopping(false), inFlight(0) {
+}
+
+AssetLoader::~AssetLoader() {
+    shutdown();
+}
+
+void AssetLoader::start(SDL_Renderer* r, int workerCount) {
+    renderer = r;
+    stopping = false;
+
+    if (workerCount <= 0) {
+        // Leave a core for the main thread; decoding a handful of PNGs doesn't need more than a few
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        workerCount = std::max(1, std::min(4, cores - 1));
+    }
+
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+    LOG_INFO(ASSETS, "Asset loader started with %d worker thread(s)", static_cast<int>(workerCount));
+}
+
+void AssetLoader::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+        decodeQueue.clear();
+    }
+    queueCondition.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+    uploadQueue.clear();
+    inFlight = 0;
+
+    for (auto& entry : cache) {
+        TextureAsset* asset = entry.second.get();
+        if (asset->surface) {
+            SDL_FreeSurface(asset->surface);
+            asset->surface = nullptr;
+        }
+        if (asset->texture) {
+            SDL_DestroyTexture(asset->texture);
+            asset->texture = nullptr;
+        }
+    }
+    pixelCopies.clear();
+    // Assets themselves stay allocated so outstanding handles remain valid (and read null)
+    renderer = nullptr;
+}
+
+bool AssetLoader::mountPack(const std::string& path) {
+    return pack.open(path);
+}
+
+TTF_Font* AssetLoader::openFont(const std::string& path, int pointSize) {
+    if (const PakEntry* entry = pack.isOpen() ? pack.find(path) : nullptr) {
+        if (entry->type == PAK_ENTRY_FONT) {
+            return TTF_OpenFontRW(pack.openStream(*entry), 1, pointSize);
+        }
+    }
+    return TTF_OpenFont(path.c_str(), pointSize);
+}
+
+TextureHandle AssetLoader::requestTexture(const std::string& path) {
+    auto it = cache.find(path);
+    if (it != cache.end()) {
+        return TextureHandle(it->second.get());
+    }
+
+    auto asset = std::make_unique<TextureAsset>();
+    asset->path = path;
+    TextureAsset* raw = asset.get();
+    raw->requestedAt = SDL_GetPerformanceCounter();
+    cache[path] = std::move(asset);
+    requestHistory.push_back(raw);
+
+    if (pack.isOpen()) {
+        raw->packEntry = pack.find(path);
+    }
+
+    if (workers.empty()) {
+        // Loader not running (or already shut down): load inline
+        if (!raw->packEntry) {
+            raw->surface = IMG_Load(path.c_str());
+        }
+        uploadAsset(raw);
+        return TextureHandle(raw);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (raw->packEntry) {
+            // Already decoded on disk; skip the workers and wait for an upload slot
+            uploadQueue.push_back(raw);
+        } else {
+            decodeQueue.push_back(raw);
+        }
+        inFlight++;
+    }
+    queueCondition.notify_one();
+    return TextureHandle(raw);
+}
+
+void AssetLoader::pumpUploads(int maxUploads) {
+    for (int i = 0; i < maxUploads; i++) {
+        TextureAsset* asset = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (uploadQueue.empty()) {
+                return;
+            }
+            asset = uploadQueue.front();
+            uploadQueue.pop_front();
+            inFlight--;
+        }
+        uploadAsset(asset);
+    }
+}
+
+int AssetLoader::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return inFlight;
+}
+
+void AssetLoader::workerLoop() {
+    while (true) {
+        TextureAsset* asset = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this] { return stopping || !decodeQueue.empty(); });
+            if (stopping) {
+                return;
+            }
+            asset = decodeQueue.front();
+            decodeQueue.pop_front();
+        }
+
+        // The expensive part: file read + PNG decode, off the render thread
+        Uint64 decodeStart = SDL_GetPerformanceCounter();
+        SDL_Surface* surface = IMG_Load(asset->path.c_str());
+        float decodeMs = static_cast<float>(SDL_GetPerformanceCounter() - decodeStart) * 1000.0f /
+                         static_cast<float>(SDL_GetPerformanceFrequency());
+        if (!surface) {
+            LOG_ERROR(ASSETS, "Failed to load texture %s: %s", asset->path.c_str(), IMG_GetError());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (stopping) {
+                if (surface) SDL_FreeSurface(surface);
+                return;
+            }
+            asset->surface = surface;
+            asset->decodeMs = decodeMs;
+            uploadQueue.push_back(asset);
+        }
+    }
+}
+
+void AssetLoader::uploadAsset(TextureAsset* asset) {
+    Uint64 uploadStart = SDL_GetPerformanceCounter();
+    createTexture(asset);
+    asset->readyAt = SDL_GetPerformanceCounter();
+    asset->uploadMs = static_cast<float>(asset->readyAt - uploadStart) * 1000.0f /
+                      static_cast<float>(SDL_GetPerformanceFrequency());
+}
+
+void AssetLoader::createTexture(TextureAsset* asset) {
+    if (asset->packEntry && renderer) {
+        asset->texture = pack.createTexture(renderer, *asset->packEntry);
+        asset->width = static_cast<int>(asset->packEntry->width);
+        asset->height = static_cast<int>(asset->packEntry->height);
+        asset->state = asset->texture ? AssetState::READY : AssetState::FAILED;
+        if (!asset->texture) {
+            LOG_ERROR(ASSETS, "Failed to create texture %s from pack: %s", asset->path.c_str(), SDL_GetError());
+        } else if (keepPixels) {
+            const PakEntry& entry = *asset->packEntry;
+            SDL_Surface* view = SDL_CreateRGBSurfaceWithFormatFrom(
+                const_cast<void*>(pack.getData(entry)), asset->width, asset->height,
+                SDL_BITSPERPIXEL(entry.pixelFormat), static_cast<int>(entry.pitch), entry.pixelFormat);
+            if (view) {
+                keepPixelCopy(asset->texture, view, (entry.flags & PAK_FLAG_PREMULTIPLIED) != 0);
+                SDL_FreeSurface(view);
+            }
+        }
+        return;
+    }
+
+    if (!asset->surface || !renderer) {
+        asset->state = AssetState::FAILED;
+        if (asset->surface) {
+            SDL_FreeSurface(asset->surface);
+            asset->surface = nullptr;
+        }
+        return;
+    }
+
+    asset->texture = SDL_CreateTextureFromSurface(renderer, asset->surface);
+    asset->width = asset->surface->w;
+    asset->height = asset->surface->h;
+    if (asset->texture && keepPixels) {
+        keepPixelCopy(asset->texture, asset->surface, false);
+    }
+    SDL_FreeSurface(asset->surface);
+    asset->surface = nullptr;
+
+    if (asset->texture) {
+        asset->state = AssetState::READY;
+    } else {
+        LOG_ERROR(ASSETS, "Failed to create texture %s: %s", asset->path.c_str(), SDL_GetError());
+        asset->state = AssetState::FAILED;
+    }
+}
+
+void AssetLoader::keepPixelCopy(SDL_Texture* texture, SDL_Surface* surface, bool premultiplied) {
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!converted) {
+        LOG_WARN(ASSETS, "Could not keep pixels of a %dx%d texture: %s", surface->w, surface->h, SDL_GetError());
+        return;
+    }
+
+    PixelImage& image = pixelCopies[texture];
+    image.width = converted->w;
+    image.height = converted->h;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height);
+    for (int y = 0; y < image.height; y++) {
+        const uint8_t* row = static_cast<const uint8_t*>(converted->pixels) + y * converted->pitch;
+        std::memcpy(&image.pixels[static_cast<size_t>(y) * image.width], row, image.width * sizeof(uint32_t));
+    }
+    SDL_FreeSurface(converted);
+
+    if (!premultiplied) {
+        PixelBlend::premultiplyImage(image.pixels.data(), static_cast<int>(image.pixels.size()));
+    }
+}
+
+const PixelImage* AssetLoader::findPixels(SDL_Texture* texture) const {
+    auto it = pixelCopies.find(texture);
+    return it != pixelCopies.end() ? &it->second : nullptr;
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include "AssetPack.h"
+
+enum class AssetState {
+    PENDING,   // Queued, decoding, or waiting for upload on the render thread
+    READY,     // Texture created
+    FAILED     // File missing or undecodable
+};
+
+// CPU copy of a texture's pixels, premultiplied ARGB8888 (see PixelBlend.h),
+// for backends that rasterize without SDL_Renderer
+struct PixelImage {
+    std::vector<uint32_t> pixels;
+    int width = 0;
+    int height = 0;
+};
+
+// One cached texture. Owned by AssetLoader. Workers only write `surface`; everything
+// else is touched on the render thread.
+struct TextureAsset {
+    std::string path;
+    SDL_Texture* texture = nullptr;
+    SDL_Surface* surface = nullptr; // Decoded pixels awaiting upload
+    const PakEntry* packEntry = nullptr; // Pre-decoded pixels in the mounted pack, if present
+    int width = 0;
+    int height = 0;
+    AssetState state = AssetState::PENDING;
+
+    // Load timing (performance-counter ticks / milliseconds) for the startup report
+    Uint64 requestedAt = 0;
+    Uint64 readyAt = 0;
+    float decodeMs = 0.0f;
+    float uploadMs = 0.0f;
+};
+
+// Lightweight, copyable reference to a cached texture. get() returns nullptr until
+// the texture is uploaded, so callers draw their existing fallback as a placeholder.
+class TextureHandle {
+public:
+    TextureHandle() : asset(nullptr) {}
+    explicit TextureHandle(const TextureAsset* a) : asset(a) {}
+
+    SDL_Texture* get() const { return asset ? asset->texture : nullptr; }
+    bool isPending() const { return asset && asset->state == AssetState::PENDING; }
+    int getWidth() const { return asset ? asset->width : 0; }
+    int getHeight() const { return asset ? asset->height : 0; }
+
+private:
+    const TextureAsset* asset;
+};
+
+// Decodes images on a small worker pool and uploads them on the render thread.
+// Requests are cached by path, so repeated requests (e.g. every enemy spawn) are free.
+class AssetLoader {
+public:
+    AssetLoader();
+    ~AssetLoader();
+
+    void start(SDL_Renderer* renderer, int workerCount = 0);
+    // Keep a PixelImage of every texture as it's uploaded. Set before start()
+    void setKeepPixels(bool keep) { keepPixels = keep; }
+    void shutdown();
+
+    // Serve assets from a packed archive when it has them; loose files remain the fallback.
+    // Mount before requesting anything. The pack stays mapped until the loader is destroyed.
+    bool mountPack(const std::string& path);
+
+    // Fonts come from the pack when possible, otherwise from disk. Caller closes the font,
+    // and must do so before the loader is destroyed.
+    TTF_Font* openFont(const std::string& path, int pointSize);
+
+    // Non-blocking: returns immediately, the texture appears once uploaded
+    TextureHandle requestTexture(const std::string& path);
+
+    // Render thread: turn at most maxUploads decoded surfaces into textures
+    void pumpUploads(int maxUploads);
+
+    int getPendingCount() const;
+
+    // Render thread: the kept copy of an uploaded texture, or nullptr
+    const PixelImage* findPixels(SDL_Texture* texture) const;
+
+    // Every asset requested so far, in request order (render thread only)
+    const std::vector<const TextureAsset*>& getRequestHistory() const { return requestHistory; }
+
+private:
+    void workerLoop();
+    void uploadAsset(TextureAsset* asset);
+    void createTexture(TextureAsset* asset);
+    void keepPixelCopy(SDL_Texture* texture, SDL_Surface* surface, bool premultiplied);
+
+    SDL_Renderer* renderer;
+    AssetPack pack;
+    std::map<std::string, std::unique_ptr<TextureAsset>> cache;
+    std::vector<const TextureAsset*> requestHistory;
+    bool keepPixels = false;
+    std::unordered_map<SDL_Texture*, PixelImage> pixelCopies;
+
+    // Worker pool
+    std::vector<std::thread> workers;
+    std::deque<TextureAsset*> decodeQueue;
+    std::deque<TextureAsset*> uploadQueue;
+    mutable std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    bool stopping;
+    int inFlight; // Requested but not yet uploaded or failed
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <string>
+#include <unordered_map>
+#include "PakFormat.h"
+
+// Read-only view of a .pak archive. The file is memory-mapped, so textures are
+// created straight from the mapped pixel blocks without any decoding, and
+// the OS only pages in what is actually used.
+class AssetPack {
+public:
+    AssetPack();
+    ~AssetPack();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return base != nullptr; }
+
+    const PakEntry* find(const std::string& name) const;
+    const void* getData(const PakEntry& entry) const { return base + entry.dataOffset; }
+
+    // Render thread: upload an image entry. Premultiplied entries get a matching blend mode.
+    SDL_Texture* createTexture(SDL_Renderer* renderer, const PakEntry& entry) const;
+
+    // Read-only stream over an entry (e.g. for TTF_OpenFontRW); caller closes it
+    SDL_RWops* openStream(const PakEntry& entry) const;
+
+private:
+    bool validate();
+
+    const uint8_t* base;
+    size_t size;
+    std::unordered_map<std::string, const PakEntry*> entries;
+
+    // Platform mapping handles (HANDLEs on Windows, unused elsewhere)
+    void* fileHandle;
+    void* mappingHandle;
+};
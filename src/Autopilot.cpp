@@ -0,0 +1,198 @@
+#include "Autopilot.h"
+#include "BossEnemy.h"
+#include "Shop.h"
+#include "Components.h"
+#include "Log.h"
+#include <algorithm>
+#include <cmath>
+
+void Autopilot::clearGrid() {
+    grid.fill(0.0f);
+}
+
+// Adds weight to every cell within radius, fading linearly to zero at the edge
+void Autopilot::stamp(Vector2 position, float radius, float weight) {
+    int minX = std::max(0, static_cast<int>((position.x - radius) / CELL_SIZE));
+    int maxX = std::min(GRID_WIDTH - 1, static_cast<int>((position.x + radius) / CELL_SIZE));
+    int minY = std::max(0, static_cast<int>((position.y - radius) / CELL_SIZE));
+    int maxY = std::min(GRID_HEIGHT - 1, static_cast<int>((position.y + radius) / CELL_SIZE));
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            Vector2 cellCenter((x + 0.5f) * CELL_SIZE, (y + 0.5f) * CELL_SIZE);
+            float distance = cellCenter.distance(position);
+            // Half a cell of slack so small things still mark the cell they sit in
+            float falloff = 1.0f - std::max(0.0f, distance - CELL_SIZE * 0.5f) / radius;
+            if (falloff > 0.0f) {
+                grid[y * GRID_WIDTH + x] += weight * falloff;
+            }
+        }
+    }
+}
+
+float Autopilot::dangerAt(Vector2 position) const {
+    int x = static_cast<int>(position.x / CELL_SIZE);
+    int y = static_cast<int>(position.y / CELL_SIZE);
+    if (x < 0 || y < 0 || x >= GRID_WIDTH || y >= GRID_HEIGHT) {
+        return 100.0f; // Off the field
+    }
+    return grid[y * GRID_WIDTH + x];
+}
+
+PlayerInput Autopilot::drive(const Player& player, EnemyBatches& enemies, const BossEnemy* boss, World& world) {
+    PlayerInput input;
+    const Vector2 playerPos = player.getPosition();
+
+    clearGrid();
+
+    // Enemy bullets: sample the path over the lookahead window, nearer samples count more
+    world.each<Transform, Velocity, Collider, TeamTag, Projectile>(
+        [&](Entity, Transform& transform, Velocity& velocity, Collider& collider, TeamTag& team, Projectile&) {
+            if (team.team != Team::ENEMY) return;
+            const int samples = 4;
+            for (int i = 0; i <= samples; i++) {
+                float t = BULLET_LOOKAHEAD * i / samples;
+                Vector2 future = transform.position + velocity.value * t;
+                future.y += 0.5f * velocity.gravity * t * t;
+                float weight = 4.0f * (1.0f - 0.5f * i / samples);
+                stamp(future, collider.radius + player.getRadius() + CELL_SIZE * 0.5f, weight);
+            }
+        });
+
+    // Enemies: body contact hurts, and kiting pushes away from everything within range
+    Vector2 repulsion;
+    Vector2 aimTarget;
+    float nearestThreat = 1e9f;
+    enemies.forEach([&](Enemy& enemy) {
+        if (!enemy.isAlive()) return;
+        Vector2 enemyPos = enemy.getPosition();
+        stamp(enemyPos, enemy.getRadius() + ENEMY_DANGER_RADIUS, 2.0f);
+
+        float distance = enemyPos.distance(playerPos);
+        if (distance < KITE_RADIUS && distance > 0.1f) {
+            repulsion += (playerPos - enemyPos) * ((KITE_RADIUS - distance) / (KITE_RADIUS * distance));
+        }
+        if (distance < nearestThreat) {
+            nearestThreat = distance;
+            aimTarget = enemyPos;
+        }
+    });
+
+    if (boss && boss->isAlive()) {
+        Vector2 bossPos = boss->getPosition();
+        stamp(bossPos, boss->getRadius() + ENEMY_DANGER_RADIUS * 2.0f, 4.0f);
+
+        float distance = bossPos.distance(playerPos);
+        if (distance < KITE_RADIUS * 1.5f && distance > 0.1f) {
+            repulsion += (playerPos - bossPos) * (2.0f * (KITE_RADIUS * 1.5f - distance) / (KITE_RADIUS * 1.5f * distance));
+        }
+        // Bosses soak most of the damage; aim at them unless something is right on us
+        if (nearestThreat > 150.0f || distance < nearestThreat) {
+            nearestThreat = distance;
+            aimTarget = bossPos;
+        }
+    }
+
+    // Nearest loose pickup, followed only when the area is calm
+    Vector2 pickupTarget;
+    float nearestPickup = PICKUP_RADIUS;
+    world.each<Transform, Pickup>([&](Entity, Transform& transform, Pickup&) {
+        float distance = transform.position.distance(playerPos);
+        if (distance < nearestPickup) {
+            nearestPickup = distance;
+            pickupTarget = transform.position;
+        }
+    });
+
+    // Score the eight directions and standing still; lower is better
+    const float speed = player.getStats().moveSpeed;
+    const Vector2 center(LOGICAL_WIDTH * 0.5f, LOGICAL_HEIGHT * 0.5f);
+    const float margin = player.getRadius() + CELL_SIZE;
+    float bestScore = 1e9f;
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            Vector2 move(static_cast<float>(dx), static_cast<float>(dy));
+            float score = 0.0f;
+            for (float t : {0.1f, 0.25f, 0.4f}) {
+                Vector2 probe = playerPos + move * (speed * t);
+                probe.x = std::clamp(probe.x, player.getRadius(), LOGICAL_WIDTH - player.getRadius());
+                probe.y = std::clamp(probe.y, player.getRadius(), LOGICAL_HEIGHT - player.getRadius());
+                score += dangerAt(probe);
+
+                // Corners and edges leave nowhere to run
+                if (probe.x < margin || probe.x > LOGICAL_WIDTH - margin ||
+                    probe.y < margin || probe.y > LOGICAL_HEIGHT - margin) {
+                    score += 1.5f;
+                }
+            }
+
+            Vector2 direction = move.normalized();
+            score -= 3.0f * (direction.x * repulsion.x + direction.y * repulsion.y);
+
+            Vector2 end = playerPos + move * (speed * 0.4f);
+            score += 0.0005f * end.distance(center);
+            if (nearestPickup < PICKUP_RADIUS && repulsion.length() < 0.2f) {
+                score += 0.004f * end.distance(pickupTarget);
+            }
+
+            if (score < bestScore) {
+                bestScore = score;
+                input.move = move;
+            }
+        }
+    }
+
+    // Nothing to shoot at: keep aiming where we were
+    input.aimTarget = nearestThreat < 1e9f ? aimTarget : playerPos + player.getShootDirection() * 100.0f;
+
+    // Consumables, spaced out so one press isn't repeated every step
+    if (itemCooldown > 0) {
+        itemCooldown--;
+    } else {
+        const PlayerStats& stats = player.getStats();
+        int crowded = 0;
+        enemies.forEach([&](Enemy& enemy) {
+            if (enemy.isAlive() && enemy.getPosition().distance(playerPos) < KITE_RADIUS) crowded++;
+        });
+
+        if (player.getHealth() < stats.maxHealth * 0.4f && player.hasItemType(ItemType::HEALING_BOX)) {
+            input.useHealing = true;
+            itemCooldown = ITEM_COOLDOWN_STEPS;
+        } else if (player.hasItemType(ItemType::MASS_BOMB) &&
+                   (crowded >= 12 || (boss && boss->isAlive() && boss->getPosition().distance(playerPos) < 250.0f))) {
+            input.useBomb = true;
+            itemCooldown = ITEM_COOLDOWN_STEPS;
+        }
+    }
+
+    return input;
+}
+
+void Autopilot::shop(Shop& shop, Player& player) {
+    for (;;) {
+        const auto& items = shop.getItems();
+        const int materials = player.getStats().materials;
+        int best = -1;
+        int bestRank = 0;
+        for (int i = 0; i < static_cast<int>(items.size()); i++) {
+            const ShopItem& item = items[i];
+            if (item.price > materials) continue;
+
+            int rank = 0;
+            if (item.type == ShopItemType::WEAPON) {
+                if (player.hasWeaponSlot()) rank = 10 + static_cast<int>(item.tier);
+            } else if (player.hasItemSlot() && !player.hasItemType(item.itemType)) {
+                rank = item.itemType == ItemType::HEALING_BOX ? 2 : 1;
+            }
+            if (rank > bestRank) {
+                bestRank = rank;
+                best = i;
+            }
+        }
+        if (best < 0) break;
+        shop.buyItem(best, player);
+    }
+
+    LOG_INFO(SHOP, "Autopilot leaves the shop with %d materials", player.getStats().materials);
+    shop.closeShop();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <array>
+#include "Player.h"
+#include "Enemy.h"
+#include "World.h"
+#include "RenderScaler.h"
+
+class BossEnemy;
+class Shop;
+
+// Plays unattended runs for benchmarks and soak tests (--autopilot). Each step
+// it turns the world into the same PlayerInput the keyboard and mouse produce,
+// so everything downstream of the input seam runs exactly as in normal play.
+//
+// Movement scores nine candidates (eight directions and standing still)
+// against a coarse danger grid: enemy bullets are stamped along their next
+// half second of flight and enemies with a falloff around their body. Nearby
+// enemies also push the choice away from them (kiting), and loose pickups pull
+// gently when nothing is threatening.
+class Autopilot {
+public:
+    PlayerInput drive(const Player& player, EnemyBatches& enemies, const BossEnemy* boss, World& world);
+
+    // Greedy purchases: weapons while there's a free slot (best tier first),
+    // then one healing box and one bomb. Closes the shop when done.
+    void shop(Shop& shop, Player& player);
+
+private:
+    static const int CELL_SIZE = 60;
+    static const int GRID_WIDTH = LOGICAL_WIDTH / CELL_SIZE;
+    static const int GRID_HEIGHT = LOGICAL_HEIGHT / CELL_SIZE;
+
+    static constexpr float BULLET_LOOKAHEAD = 0.5f;  // Seconds of bullet flight stamped into the grid
+    static constexpr float ENEMY_DANGER_RADIUS = 90.0f; // Beyond the enemy's body
+    static constexpr float KITE_RADIUS = 300.0f;
+    static constexpr float PICKUP_RADIUS = 400.0f;
+    static const int ITEM_COOLDOWN_STEPS = 60;
+
+    void clearGrid();
+    void stamp(Vector2 position, float radius, float weight);
+    float dangerAt(Vector2 position) const;
+
+    std::array<float, GRID_WIDTH * GRID_HEIGHT> grid = {};
+    int itemCooldown = 0;
+};
@@ -0,0 +1,124 @@
+#include "Balance.h"
+#include "Definitions.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Balance {
+    float nextWaveDuration(float duration) {
+        return std::min(duration + 5.0f, 60.0f);
+    }
+
+    float spawnInterval(int wave) {
+        float spawnRate = 1.0f - (wave * 0.1f);
+        if (spawnRate < 0.2f) spawnRate = 0.2f;
+        return spawnRate;
+    }
+
+    EnemySpawnType spawnType(int wave, float roll) {
+        if (wave >= 2) {
+            // From wave 2: 40% slime, 40% pebblin, 20% base
+            if (roll < 0.4f) return EnemySpawnType::SLIME;
+            if (roll < 0.8f) return EnemySpawnType::PEBBLIN;
+            return EnemySpawnType::BASE;
+        }
+        // Wave 1: 50% slime, 50% base (no pebblin yet)
+        return roll < 0.5f ? EnemySpawnType::SLIME : EnemySpawnType::BASE;
+    }
+
+    float materialDropChance(int wave) {
+        // Brotato's material drop formula:
+        // Starts at 100%, decreases 1.5% per wave number, minimum 50%
+        float baseChance = 1.0f;
+        float reduction = (wave - 1) * 0.015f;
+        float dropChance = baseChance - reduction;
+
+        // Minimum 50% chance
+        if (dropChance < 0.5f) dropChance = 0.5f;
+
+        // TODO: Implement horde wave reduction (-35%)
+
+        return dropChance;
+    }
+
+    int bossConsolationMaterials(int wave) {
+        return std::max(3, wave / 2);
+    }
+
+    int damageAfterArmor(int damage, int armor) {
+        int actualDamage = damage - armor;
+        if (actualDamage < 1) actualDamage = 1; // Always take at least 1 damage
+        return actualDamage;
+    }
+
+    int shopTierCount(int wave) {
+        // Brotato tier restrictions
+        if (wave >= 8) return 4;
+        if (wave >= 4) return 3;
+        if (wave >= 2) return 2;
+        return 1;
+    }
+
+    int weaponPrice(WeaponTier tier, int wave) {
+        int basePrice = 20; // Base weapon price
+
+        // Tier multiplier
+        int tierMultiplier = (int)tier;
+        basePrice *= tierMultiplier;
+
+        // Wave scaling (increases with wave)
+        basePrice += wave * 5;
+
+        return basePrice;
+    }
+
+    int itemPrice(int power, int wave) {
+        int basePrice = 15; // Base item price (slightly cheaper than weapons)
+
+        // Power scaling
+        basePrice += power / 2;
+
+        // Wave scaling
+        basePrice += wave * 3;
+
+        return basePrice;
+    }
+
+    int rerollPrice(int wave, int rerollCount) {
+        // Brotato reroll formula
+        int rerollIncrease = std::max(1, (int)std::floor(0.40f * wave));
+        int firstRerollPrice = (int)std::floor(wave * 0.75f) + rerollIncrease;
+
+        return firstRerollPrice + (rerollCount * rerollIncrease);
+    }
+
+    WeaponStats weaponStats(WeaponType type, WeaponTier tier) {
+        // Per type/tier numbers come from data/weapons.def
+        const WeaponDef& def = Defs::weapon(type);
+        const WeaponTierDef& tierDef = Defs::weaponTier(type, tier);
+        WeaponStats stats;
+        stats.baseDamage = tierDef.damage;
+        stats.attackSpeed = tierDef.cooldown;
+        stats.critChance = tierDef.critChance;
+        stats.range = def.range;
+        stats.critMultiplier = def.critMultiplier;
+        stats.knockback = def.knockback;
+        stats.lifesteal = def.lifesteal;
+        stats.rangedDamageScaling = def.rangedScaling;
+        stats.meleeDamageScaling = def.meleeScaling;
+        stats.elementalDamageScaling = def.elementalScaling;
+        return stats;
+    }
+
+    int weaponHitDamage(const WeaponStats& stats, int playerDamage) {
+        float totalDamage = stats.baseDamage;
+
+        // Apply scaling from player stats
+        if (stats.rangedDamageScaling > 0) {
+            // For now, we'll use player's base damage as ranged damage
+            // In a full implementation, Player would have separate ranged damage stat
+            totalDamage += playerDamage * stats.rangedDamageScaling;
+        }
+
+        return (int)totalDamage;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Weapon.h"
+#include "Enemy.h"
+
+// Gameplay tuning: wave pacing, drops, experience and prices. Weapon, enemy and
+// item stats are data (data/*.def, loaded by Definitions).
+// Everything here is plain arithmetic with no SDL calls, so tools/BalanceSim.cpp
+// links Balance.cpp directly and simulates runs with the exact numbers the game uses.
+namespace Balance {
+    // Waves
+    const float FIRST_WAVE_DURATION = 20.0f;
+    const int BOSS_WAVE_INTERVAL = 3;
+    float nextWaveDuration(float duration);   // +5 s per wave, capped at 60 s
+    inline bool isBossWave(int wave) { return wave > 0 && (wave % BOSS_WAVE_INTERVAL) == 0; }
+    float spawnInterval(int wave);             // Seconds between spawn telegraphs
+    EnemySpawnType spawnType(int wave, float roll); // roll in [0, 1)
+
+    // Drops and rewards
+    float materialDropChance(int wave);
+    inline int materialValue(int wave) { return 1 + wave / 3; }
+    inline int materialExperience(int wave) { return 1 + wave / 5; }
+    inline int bossRewardDrops(int wave) { return 15 + wave / 3; }
+    inline int bossRewardMaterialValue(int wave) { return 2 + wave / 2; }
+    inline int bossRewardExperience(int wave) { return 3 + wave / 2; }
+    const int BOSS_REWARD_ORBS = 10;
+    int bossConsolationMaterials(int wave);    // Boss survived the timer
+
+    // Enemy bullets (stats per type are in data/enemies.def)
+    const int SLIME_BULLET_DAMAGE = 10;
+    const int PEBBLIN_BULLET_DAMAGE = 8;       // Per bullet of the three-shot spread
+
+    // Player
+    inline int experienceForLevel(int level) { return (level + 3) * (level + 3); }
+    int damageAfterArmor(int damage, int armor);
+
+    // Shop
+    const float SHOP_WEAPON_CHANCE = 0.7f;
+    int shopTierCount(int wave);               // Tiers 1..N can appear
+    inline int shopItemPower(int wave) { return 20 + wave * 5; }
+    int weaponPrice(WeaponTier tier, int wave);
+    int itemPrice(int power, int wave);
+    int rerollPrice(int wave, int rerollCount);
+    inline int sellPrice(int price) { return price / 2 > 1 ? price / 2 : 1; }
+
+    // Weapons (requires Defs::load)
+    WeaponStats weaponStats(WeaponType type, WeaponTier tier);
+    int weaponHitDamage(const WeaponStats& stats, int playerDamage);
+}
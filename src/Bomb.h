@@ -1,43 +1,13 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_image.h>
 #include "Vector2.h"
+#include "World.h"
+#include "RenderScaler.h"
+#include "RenderQueue.h"
 
-class Bomb {
-public:
-    Bomb(Vector2 position, float timer, float radius, int damage);
-    ~Bomb();
-    
-    void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    bool isExploded() const { return exploded; }
-    bool isAlive() const { return alive; }
-    bool hasAppliedDamage() const { return damageApplied; }
-    void markDamageApplied() { damageApplied = true; }
-    void setTexture(SDL_Texture* texture, bool owns) { bombTexture = texture; ownsTexture = owns; }
-    
-    Vector2 getPosition() const { return position; }
-    float getRadius() const { return radius; }
-    int getDamage() const { return damage; }
-    
-private:
-    Vector2 position;
-    float timer;
-    float maxTimer;
-    float radius;
-    int damage;
-    bool exploded;
-    bool alive;
-    bool damageApplied;
-    bool ownsTexture;
-    
-    // Visual states
-    float flashTimer;
-    float flashInterval;
-    bool showFlash;
-    SDL_Texture* bombTexture;
-    
-    void explode();
-    void loadTexture(SDL_Renderer* renderer);
-    void renderCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius, bool filled);
-};
\ No newline at end of file
+// Bombs are World entities: Transform + Collider (blast radius) + BombFuse + TeamTag + Sprite
+Entity spawnBomb(World& world, Vector2 position, float timer, float radius, int damage, SDL_Texture* texture);
+
+// Burns fuses down, explodes them and removes finished explosions
+void updateBombs(World& world, float deltaTime);
+void renderBombs(World& world, RenderQueue& queue, const Viewport& view);
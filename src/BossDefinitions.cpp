@@ -0,0 +1,232 @@
+#include "BossEnemy.h"
+#include <cstring>
+
+// Все боссы описаны данными: эмиттеры, рывки, призыв и веса паттернов по фазам.
+// BossEnemy только исполняет это описание.
+
+namespace {
+    // Общая база; каждый босс меняет только то, чем отличается
+    BossConfig baseBossConfig(int waveIndex) {
+        BossConfig config;
+        config.seed = static_cast<uint32_t>(waveIndex);
+
+        // Wave-based boss tuning (HP is effectively absolute since base = 1)
+        config.scale = 2.8f;
+        config.speedMul = 0.6f;
+        switch (waveIndex) {
+            case 3:
+                config.hpMul = 1200.f;
+                config.dmgMul = 2.0f;
+                break;
+            case 6:
+                config.hpMul = 2400.f;
+                config.dmgMul = 2.2f;
+                break;
+            case 9:
+            default:
+                config.hpMul = 3600.f;
+                config.dmgMul = 2.5f;
+                break;
+        }
+
+        // Круговой залп: +3/+6 пуль и +30/+60 скорости во второй фазе и в ярости
+        config.radial.shape = EmitterShape::RING;
+        config.radial.shots = {10, 13, 16};
+        config.radial.speed = {200.0f, 230.0f, 260.0f};
+        config.radial.range = 600.0f;
+
+        // Спираль: короткая очередь вращающихся колец вместо одного кольца за активацию
+        config.spiral.shape = EmitterShape::RING;
+        config.spiral.shots = {2, 3, 4};
+        config.spiral.speed = {250.0f, 250.0f, 250.0f};
+        config.spiral.volleys = 8;
+        config.spiral.volleyInterval = 0.12f;
+        config.spiral.rotationStep = 0.2f;
+        config.spiral.range = 750.0f; // Увеличенный радиус полёта для всех боссов
+
+        // Прицельная очередь: +1/+3 пули
+        config.burst.shape = EmitterShape::AIMED_BURST;
+        config.burst.shots = {3, 4, 6};
+        config.burst.speed = {260.0f, 260.0f, 260.0f};
+        config.burst.range = 650.0f; // was 750
+
+        config.dash.speedMul = 5.0f;
+        config.dash.phaseSpeedMul = {1.0f, 1.15f, 1.35f};
+        config.dash.telegraphRadius = 64.0f;
+
+        config.summon.count = {2, 3, 4};
+        config.summon.radius = 150.0f;
+        return config;
+    }
+
+    // MEGA SLIME - прыгучий босс с круговыми атаками
+    BossConfig megaSlime(int waveIndex) {
+        BossConfig config = baseBossConfig(waveIndex);
+        config.name = "MEGA SLIME";
+        config.texture = "assets/enemies/slime.png";
+
+        config.radial.shots = {12, 15, 18};
+        config.radial.speed = {160.0f, 190.0f, 220.0f};
+
+        config.spiral.shots = {3, 4, 5};   // Больше спиралей, медленнее
+        config.spiral.speed = {180.0f, 180.0f, 180.0f};
+        config.spiral.range = 600.0f;      // Чуть меньше для слайма (компенсация за количество)
+
+        // Серия рывков: количество зависит от фазы
+        config.dash.chain = {1, 2, 3};
+        config.dash.hopDistance = 300.0f; // was 400
+        config.dash.speedMul = 8.0f;      // was 12x
+        config.dash.phaseSpeedMul = {1.0f, 1.3f, 1.6f};
+        config.dash.telegraphRadius = 96.0f;
+
+        config.summon.type = EnemySpawnType::SLIME;
+
+        config.weightsP1 = {
+            {BossPattern::DASH_TO_PLAYER, 1.0f},  // Прыжки - основная атака
+            {BossPattern::RADIAL_SHOTS, 0.8f},    // Часто стреляет по кругу
+            {BossPattern::SUMMON_ADDS, 0.3f}      // Редко призывает миньонов
+        };
+
+        config.weightsP2 = {
+            {BossPattern::DASH_TO_PLAYER, 1.2f},  // Еще больше прыжков
+            {BossPattern::RADIAL_SHOTS, 1.0f},
+            {BossPattern::SPIRAL_SHOTS, 0.8f},    // Новая атака
+            {BossPattern::SUMMON_ADDS, 0.4f}
+        };
+
+        config.weightsEnrage = {
+            {BossPattern::DASH_TO_PLAYER, 1.5f},  // Агрессивные прыжки
+            {BossPattern::RADIAL_SHOTS, 1.2f},
+            {BossPattern::SPIRAL_SHOTS, 1.0f},
+            {BossPattern::BURST_AIM, 0.8f},       // Новая атака
+            {BossPattern::SUMMON_ADDS, 0.5f}
+        };
+        return config;
+    }
+
+    // DARK PEBBLIN - призыватель с прицельной стрельбой
+    BossConfig darkPebblin(int waveIndex) {
+        BossConfig config = baseBossConfig(waveIndex);
+        config.name = "DARK PEBBLIN";
+        config.texture = "assets/enemies/pebblin.png";
+
+        config.radial.shots = {8, 11, 14};  // defensive pattern, fewer bullets
+        config.radial.speed = {220.0f, 250.0f, 280.0f};
+
+        config.burst.shots = {4, 5, 7};     // was 5 for dark pebblin
+        config.burst.speed = {300.0f, 300.0f, 300.0f};
+        // Каждая следующая пуля очереди чуть быстрее - очередь растягивается в линию
+        config.burst.volleys = 2;
+        config.burst.volleyInterval = 0.15f;
+        config.burst.speedStep = 40.0f;
+
+        config.summon.type = EnemySpawnType::PEBBLIN;
+
+        config.weightsP1 = {
+            {BossPattern::BURST_AIM, 1.0f},     // Основная атака - прицельная стрельба
+            {BossPattern::SUMMON_ADDS, 0.8f},   // Часто призывает миньонов
+            {BossPattern::RADIAL_SHOTS, 0.4f}   // Редкие защитные залпы
+        };
+
+        config.weightsP2 = {
+            {BossPattern::BURST_AIM, 1.2f},     // Больше прицельной стрельбы
+            {BossPattern::SUMMON_ADDS, 1.0f},   // Больше миньонов
+            {BossPattern::SPIRAL_SHOTS, 0.7f},  // Добавляем спирали
+            {BossPattern::DASH_TO_PLAYER, 0.3f} // Редкие рывки для позиционирования
+        };
+
+        config.weightsEnrage = {
+            {BossPattern::BURST_AIM, 1.5f},     // Интенсивная стрельба
+            {BossPattern::SUMMON_ADDS, 1.2f},   // Много миньонов
+            {BossPattern::SPIRAL_SHOTS, 1.0f},  // Частые спирали
+            {BossPattern::RADIAL_SHOTS, 0.8f},  // Защитные залпы
+            {BossPattern::DASH_TO_PLAYER, 0.4f} // Редкие рывки
+        };
+        return config;
+    }
+
+    // MORTORHEAD PRIME - мастер спиральной стрельбы
+    BossConfig mortorheadPrime(int waveIndex) {
+        BossConfig config = baseBossConfig(waveIndex);
+        config.name = "MORTORHEAD PRIME";
+
+        config.spiral.shots = {4, 5, 6};   // Ещё больше спиралей для Mortorhead
+        config.spiral.speed = {300.0f, 300.0f, 300.0f}; // И быстрее
+        config.spiral.range = 900.0f;      // Больше для Mortorhead (он специалист по спиралям)
+        config.spiral.volleys = 12;
+        config.spiral.speedStep = -8.0f;   // Внешние витки быстрее внутренних
+
+        config.weightsP1 = {
+            {BossPattern::SPIRAL_SHOTS, 1.0f},   // Основная атака - спирали
+            {BossPattern::RADIAL_SHOTS, 0.7f},   // Дополнительные круговые атаки
+            {BossPattern::DASH_TO_PLAYER, 0.4f}  // Редкие рывки
+        };
+
+        config.weightsP2 = {
+            {BossPattern::SPIRAL_SHOTS, 1.2f},   // Больше спиралей
+            {BossPattern::BURST_AIM, 0.9f},      // Добавляем прицельную стрельбу
+            {BossPattern::RADIAL_SHOTS, 0.8f},   // Больше круговых атак
+            {BossPattern::DASH_TO_PLAYER, 0.5f}  // Чаще рывки
+        };
+
+        config.weightsEnrage = {
+            {BossPattern::SPIRAL_SHOTS, 1.5f},   // Интенсивные спирали
+            {BossPattern::BURST_AIM, 1.2f},      // Много прицельной стрельбы
+            {BossPattern::RADIAL_SHOTS, 1.0f},   // Частые круговые атаки
+            {BossPattern::DASH_TO_PLAYER, 0.8f}, // Частые рывки
+            {BossPattern::SUMMON_ADDS, 0.4f}     // Редкий призыв миньонов
+        };
+        return config;
+    }
+
+    // ANCIENT ONE и другие - сбалансированный босс
+    BossConfig ancientOne(int waveIndex) {
+        BossConfig config = baseBossConfig(waveIndex);
+        config.name = "ANCIENT ONE";
+
+        config.weightsP1 = {
+            {BossPattern::RADIAL_SHOTS, 1.0f},
+            {BossPattern::DASH_TO_PLAYER, 0.7f},
+            {BossPattern::BURST_AIM, 0.5f}
+        };
+
+        config.weightsP2 = {
+            {BossPattern::RADIAL_SHOTS, 1.1f},
+            {BossPattern::SPIRAL_SHOTS, 1.0f},
+            {BossPattern::DASH_TO_PLAYER, 0.8f},
+            {BossPattern::BURST_AIM, 0.7f}
+        };
+
+        config.weightsEnrage = {
+            {BossPattern::RADIAL_SHOTS, 1.2f},
+            {BossPattern::SPIRAL_SHOTS, 1.2f},
+            {BossPattern::BURST_AIM, 1.0f},
+            {BossPattern::DASH_TO_PLAYER, 0.9f},
+            {BossPattern::SUMMON_ADDS, 0.6f}
+        };
+        return config;
+    }
+}
+
+BossConfig makeBossConfig(int waveIndex) {
+    switch (waveIndex) {
+        case 3:  return megaSlime(waveIndex);
+        case 6:  return darkPebblin(waveIndex);
+        case 9:  return mortorheadPrime(waveIndex);
+        default: return ancientOne(waveIndex);
+    }
+}
+
+std::vector<const char*> bossTexturePaths() {
+    std::vector<const char*> paths;
+    // По одной волне на каждую ветку makeBossConfig
+    for (int waveIndex : {3, 6, 9, 12}) {
+        const char* path = makeBossConfig(waveIndex).texture;
+        bool known = false;
+        for (const char* existing : paths) {
+            known = known || std::strcmp(existing, path) == 0;
+        }
+        if (!known) paths.push_back(path);
+    }
+    return paths;
+}
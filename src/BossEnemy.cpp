@@ -1,110 +1,91 @@
 #include "BossEnemy.h"
-#include "Game.h"
+#include "BulletPattern.h"
+#include "RenderScaler.h"
+#include "World.h"
+#include "Snapshot.h"
 #include <algorithm>
-#include <SDL2/SDL_image.h>
 #include <cmath>
 
-BossEnemy::BossEnemy(const Vector2& spawnPos, SDL_Renderer* renderer, const BossConfig& cfg)
-    : Enemy(spawnPos, renderer)
+BossEnemy::BossEnemy(const Vector2& spawnPos, TextureHandle sprite, const BossConfig& cfg)
+    : Enemy(spawnPos)
     , config(cfg)
+    , texture(sprite)
     , rng(cfg.seed)
 {
-    // Загружаем текстуру в зависимости от имени босса
-    const char* texturePath = "assets/enemies/mortorhead.png";
-    if (std::string(cfg.name) == "MEGA SLIME") {
-        texturePath = "assets/enemies/slime.png";
-    } else if (std::string(cfg.name) == "DARK PEBBLIN") {
-        texturePath = "assets/enemies/pebblin.png";
-    }
-    
-    SDL_Surface* surface = IMG_Load(texturePath);
-    if (surface) {
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_FreeSurface(surface);
-        // Используем одну текстуру для всех состояний, чтобы базовый рендер работал
-        idleFrame1 = tex;
-        idleFrame2 = tex;
-        hitFrame = tex;
-    }
+    // Одна текстура для всех состояний; текстурой владеет загрузчик, Game заранее держит хэндлы
 
     // Применяем множители из конфига и масштабируем визуальные размеры
     health = static_cast<int>(health * config.hpMul);
     maxHealthValue = health;
     damage = static_cast<int>(damage * config.dmgMul);
     speed = speed * config.speedMul;
-    spriteWidth = static_cast<int>(64 * config.scale);
-    spriteHeight = static_cast<int>(64 * config.scale);
-    radius = static_cast<float>(spriteWidth / 2);
+    spriteSize = static_cast<int>(64 * config.scale);
+    radius = static_cast<float>(spriteSize / 2);
+
+    // Бюджет кадра должен вмещать самый большой залп, иначе он не выстрелит никогда
+    for (const EmitterDef* def : {&config.radial, &config.spiral, &config.burst}) {
+        for (int shots : def->shots) {
+            config.bulletsPerFrame = std::max(config.bulletsPerFrame, std::min(shots, MAX_RING_SHOTS));
+        }
+    }
+    config.maxLiveBullets = std::max(config.maxLiveBullets, config.bulletsPerFrame);
 }
 
-void BossEnemy::update(float dt, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::update(float dt, Vector2 playerPos, World& world) {
     if (!isAlive()) return;
-    
+
     // Сохраняем последнюю известную позицию игрока
     lastKnownPlayerPos = playerPos;
-    
-    // Обновляем базовую логику движения только если не в рывке
-    if (velocity.length() < speed * 4.0f) { // Увеличили порог для лучшего определения рывка
-        Enemy::update(dt, playerPos, bullets);
+    bulletsThisFrame = 0;
+
+    if (dashPending) {
+        // Замах перед рывком: стоим на месте, пока игрок видит телеграф
+        dashWindup -= dt;
+        if (dashWindup <= 0.0f) {
+            dashPending = false;
+            velocity = dashVelocity;
+        }
+    } else if (velocity.length() < speed * 4.0f) { // Увеличили порог для лучшего определения рывка
+        // Обновляем базовую логику движения только если не в рывке
+        seek(playerPos, dt);
+        animate(dt, getEnemyTypeInfo(EnemyType::BASE).frameInterval);
     } else {
         // В рывке - просто обновляем позицию
         position = position + velocity * dt;
-        
+
         // Замедляем рывок со временем (медленнее для более длинных прыжков)
         velocity = velocity * 0.97f;
     }
-    
+
     phaseTimer += dt;
     updatePhase();
-    
+
     // Обработка атак
     if (attackCooldown > 0) {
         attackCooldown -= dt;
     } else {
-        // Выбираем и выполняем паттерн атаки
-        BossPattern pattern = nextPattern();
-        
-        switch (pattern) {
-            case BossPattern::RADIAL_SHOTS:
-                patternRadialShots(bullets);
-                attackCooldown = 1.5f;
-                break;
-            case BossPattern::DASH_TO_PLAYER:
-                patternDashToPlayer();
-                attackCooldown = 2.5f;
-                break;
-            case BossPattern::SUMMON_ADDS:
-                patternSummonAdds();
-                attackCooldown = 5.0f;
-                break;
-            case BossPattern::SPIRAL_SHOTS:
-                patternSpiralShots(bullets);
-                attackCooldown = 1.8f;
-                break;
-            case BossPattern::BURST_AIM:
-                patternBurstAim(bullets);
-                attackCooldown = 1.2f;
-                break;
-        }
-        
-        // Phase modifiers (lighter)
-        if (phase == BossPhase::PHASE2) {
-            attackCooldown *= 0.9f;
-        }
-        else if (phase == BossPhase::ENRAGE) {
-            attackCooldown *= 0.8f;
-        }
+        performPattern(world);
     }
+
+    updateEmitters(dt, world);
+
+    for (TelegraphMark& mark : telegraphs) {
+        mark.remaining -= dt;
+    }
+    telegraphs.erase(std::remove_if(telegraphs.begin(), telegraphs.end(),
+                                    [](const TelegraphMark& mark) { return mark.remaining <= 0.0f; }),
+                     telegraphs.end());
 }
 
-void BossEnemy::render(SDL_Renderer* r) {
+void BossEnemy::render(RenderQueue& queue, const Viewport& view) {
     if (!isAlive()) return;
-    Enemy::render(r);
+    renderTelegraphs(queue, view);
+    renderSprite(queue, RenderLayer::BOSS, view, texture.get(), spriteSize, spriteSize, {255, 50, 50, 255});
 }
 
 void BossEnemy::updatePhase() {
     float healthPercent = getHealthPercent();
-    
+
     // Смена фаз по HP
     if (phase == BossPhase::PHASE1 && healthPercent < 0.7f) {
         phase = BossPhase::PHASE2;
@@ -116,77 +97,71 @@ void BossEnemy::updatePhase() {
 
 BossPattern BossEnemy::nextPattern() {
     auto& weights = getCurrentWeights();
-    
-    // Фильтруем паттерны с повторами
-    std::vector<std::pair<BossPattern, float>> available;
+
+    // Фильтруем паттерны с повторами (на стеке: выбор идёт во время кадра)
+    std::array<std::pair<BossPattern, float>, BOSS_PATTERN_COUNT> available;
+    size_t availableCount = 0;
     for (const auto& [pattern, weight] : weights) {
-        if (!tooManyRepeats(pattern)) {
-            available.push_back({pattern, weight});
+        if (!tooManyRepeats(pattern) && availableCount < available.size()) {
+            available[availableCount++] = {pattern, weight};
         }
     }
-    
+
     // Если все в повторах, используем все паттерны
-    if (available.empty()) {
-        available = weights;
+    if (availableCount == 0) {
+        for (const auto& entry : weights) {
+            if (availableCount < available.size()) available[availableCount++] = entry;
+        }
     }
-    
+
     // Выбираем взвешенный случайный паттерн
     float totalWeight = 0;
-    for (const auto& [_, weight] : available) {
-        totalWeight += weight;
+    for (size_t i = 0; i < availableCount; i++) {
+        totalWeight += available[i].second;
     }
-    
+
     std::uniform_real_distribution<float> dist(0, totalWeight);
     float roll = dist(rng);
-    
-    for (const auto& [pattern, weight] : available) {
-        roll -= weight;
+
+    BossPattern chosen = available[availableCount - 1].first;
+    for (size_t i = 0; i < availableCount; i++) {
+        roll -= available[i].second;
         if (roll <= 0) {
-            // Добавляем в историю
-            if (lastPatterns.size() >= MAX_PATTERN_HISTORY) {
-                lastPatterns.pop();
-            }
-            lastPatterns.push(pattern);
-            return pattern;
+            chosen = available[i].first;
+            break;
         }
     }
-    
-    return available.back().first;
+
+    // Добавляем в историю, вытесняя самый старый
+    lastPatterns[patternHistoryNext] = chosen;
+    patternHistoryNext = (patternHistoryNext + 1) % MAX_PATTERN_HISTORY;
+    patternHistoryCount = std::min(patternHistoryCount + 1, MAX_PATTERN_HISTORY);
+    return chosen;
 }
 
-void BossEnemy::performPattern(float dt, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::performPattern(World& world) {
     BossPattern pattern = nextPattern();
-    
+
     switch (pattern) {
         case BossPattern::RADIAL_SHOTS:
-            patternRadialShots(bullets);
-            attackCooldown = 1.5f; // Уменьшили кулдаун для более частой стрельбы
+            startEmitter(config.radial);
             break;
         case BossPattern::DASH_TO_PLAYER:
             patternDashToPlayer();
-            attackCooldown = 2.5f; // Увеличили кулдаун прыжков
             break;
         case BossPattern::SUMMON_ADDS:
-            patternSummonAdds();
-            attackCooldown = 5.0f;
+            patternSummonAdds(world);
             break;
         case BossPattern::SPIRAL_SHOTS:
-            patternSpiralShots(bullets);
-            attackCooldown = 1.8f; // Уменьшили кулдаун спиральной стрельбы
+            startEmitter(config.spiral);
             break;
         case BossPattern::BURST_AIM:
-            patternBurstAim(bullets);
-            attackCooldown = 1.2f; // Быстрая прицельная стрельба
+            startEmitter(config.burst);
             break;
     }
-    
-    // Phase modifiers (lighter)
-    if (phase == BossPhase::PHASE2) {
-        attackCooldown *= 0.9f;
-    }
-    else if (phase == BossPhase::ENRAGE) {
-        attackCooldown *= 0.8f;
-    }
+
+    // Кулдаун паттерна с множителем фазы
+    attackCooldown = config.cooldowns[static_cast<int>(pattern)] * config.cooldownScale[phaseIndex()];
 }
 
 std::vector<std::pair<BossPattern, float>>& BossEnemy::getCurrentWeights() {
@@ -202,168 +177,136 @@ std::vector<std::pair<BossPattern, float>>& BossEnemy::getCurrentWeights() {
 }
 
 bool BossEnemy::tooManyRepeats(BossPattern pattern) const {
-    if (lastPatterns.size() < 2) return false;
-    
+    if (patternHistoryCount < 2) return false;
+
     size_t count = 0;
-    auto temp = lastPatterns;
-    while (!temp.empty()) {
-        if (temp.front() == pattern) count++;
-        temp.pop();
+    for (size_t i = 0; i < patternHistoryCount; i++) {
+        if (lastPatterns[i] == pattern) count++;
     }
-    
+
     return count >= 2;
 }
 
-void BossEnemy::patternRadialShots(std::vector<std::unique_ptr<Bullet>>& bullets) {
-    bool isMegaSlime = std::string(config.name) == "MEGA SLIME";
-    bool isDarkPebblin = std::string(config.name) == "DARK PEBBLIN";
-    
-    // Настройки в зависимости от типа босса
-    int baseNumBullets;
-    float baseSpeed;
-    
-    if (isMegaSlime) {
-        baseNumBullets = 12;
-        baseSpeed = 160.0f;
-    } else if (isDarkPebblin) {
-        baseNumBullets = 8;    // defensive pattern, fewer bullets
-        baseSpeed = 220.0f;
-    } else {
-        baseNumBullets = 10;
-        baseSpeed = 200.0f;
+void BossEnemy::startEmitter(const EmitterDef& def) {
+    // Кольца без вращения всегда начинают вправо, вращающиеся - со случайного угла,
+    // чтобы два запуска спирали подряд не накладывались друг на друга
+    float angle = 0.0f;
+    if (def.rotationStep != 0.0f) {
+        std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * 3.14159f);
+        angle = angleDist(rng);
+    }
+    emitters.push_back({&def, def.volleys, 0.0f, angle, def.speed[phaseIndex()]});
+}
+
+void BossEnemy::updateEmitters(float dt, World& world) {
+    if (emitters.empty()) return;
+
+    // Вражеские пули уже в мире - считаем один раз за кадр
+    int liveBullets = 0;
+    world.each<TeamTag, Projectile>([&](Entity, TeamTag& tag, Projectile&) {
+        if (tag.team == Team::ENEMY) liveBullets++;
+    });
+
+    for (ActiveEmitter& emitter : emitters) {
+        emitter.timer -= dt;
+        if (emitter.timer > 0.0f) continue;
+
+        const int shots = std::min(emitter.def->shots[phaseIndex()], MAX_RING_SHOTS);
+        // Не влезает в бюджет - залп ждёт следующего кадра, а не раздувает этот
+        if (bulletsThisFrame + shots > config.bulletsPerFrame) continue;
+        if (liveBullets + shots > config.maxLiveBullets) continue;
+
+        fireVolley(emitter, world);
+        bulletsThisFrame += shots;
+        liveBullets += shots;
     }
 
-    const int numBullets = baseNumBullets + (phase == BossPhase::PHASE2 ? 3 : (phase == BossPhase::ENRAGE ? 6 : 0));
-    const float bulletSpeed = baseSpeed + (phase == BossPhase::PHASE2 ? 30.0f : (phase == BossPhase::ENRAGE ? 60.0f : 0.0f));
+    emitters.erase(std::remove_if(emitters.begin(), emitters.end(),
+                                  [](const ActiveEmitter& emitter) { return emitter.volleysLeft <= 0; }),
+                   emitters.end());
+}
+
+void BossEnemy::fireVolley(ActiveEmitter& emitter, World& world) {
+    const EmitterDef& def = *emitter.def;
+    const int shots = std::min(def.shots[phaseIndex()], MAX_RING_SHOTS);
 
-    for (int i = 0; i < numBullets; ++i) {
-        float angle = (2.0f * 3.14159f * i) / numBullets;
-        Vector2 direction(cos(angle), sin(angle));
-        Vector2 bulletVelocity = direction * bulletSpeed;
-        float bulletRange = 600.0f;
-        bullets.push_back(std::make_unique<Bullet>(position, bulletVelocity, damage, bulletRange, bulletSpeed, BulletType::PISTOL, true));
+    if (def.shape == EmitterShape::AIMED_BURST) {
+        // Случайный разброс +-0.1 рад из предрассчитанной таблицы
+        Vector2 direction = (lastKnownPlayerPos - position).normalized();
+        PatternSpec spec{aimJitter(shots, rng()), shots, emitter.speed, def.range, damage};
+        emitPattern(world, position, direction, spec);
+    } else {
+        // Кольцо из предрассчитанной таблицы, повёрнутое на текущий угол эмиттера
+        PatternSpec spec{ringRotations(shots), shots, emitter.speed, def.range, damage};
+        emitPattern(world, position, Vector2(std::cos(emitter.angle), std::sin(emitter.angle)), spec);
+        emitter.angle = std::fmod(emitter.angle + def.rotationStep, 2.0f * 3.14159f);
     }
+
+    emitter.speed += def.speedStep;
+    emitter.timer = def.volleyInterval;
+    emitter.volleysLeft--;
 }
 
 void BossEnemy::patternDashToPlayer() {
     // Вычисляем направление к последней позиции игрока
     Vector2 direction = (lastKnownPlayerPos - position).normalized();
-    
-    // Для MEGA SLIME делаем серию рывков
-    if (std::string(config.name) == "MEGA SLIME") {
-        // Количество рывков зависит от фазы
-        int numDashes = 1 + (phase == BossPhase::PHASE2 ? 1 : (phase == BossPhase::ENRAGE ? 2 : 0));
-        
-        float dashDistance = 300.0f; // was 400
+    const DashDef& dash = config.dash;
+    const float markDuration = dash.windup + 0.4f;
+
+    if (dash.hopDistance > 0.0f) {
+        // Серия прыжков: метка на каждой точке приземления
         Vector2 dashEnd = position;
-        for (int i = 0; i < numDashes; i++) {
-            dashEnd = dashEnd + direction * dashDistance;
-            telegraph(dashEnd, 96.0f, 1.0f);
+        for (int i = 0; i < dash.chain[phaseIndex()]; i++) {
+            dashEnd = dashEnd + direction * dash.hopDistance;
+            telegraph(dashEnd, dash.telegraphRadius, markDuration);
         }
-
-        float dashSpeed = speed * 8.0f; // was 12x
-        if (phase == BossPhase::PHASE2) dashSpeed *= 1.3f;
-        if (phase == BossPhase::ENRAGE) dashSpeed *= 1.6f;
-        
-        velocity = direction * dashSpeed;
     } else {
-        // Для других боссов - обычный рывок
-        telegraph(lastKnownPlayerPos, 64.0f, 1.0f);
-        
-        float dashSpeed = speed * 5.0f;  // unchanged or reduce to 4.5f if needed
-        if (phase == BossPhase::PHASE2) dashSpeed *= 1.15f;
-        if (phase == BossPhase::ENRAGE) dashSpeed *= 1.35f;
-        
-        velocity = direction * dashSpeed;
+        telegraph(lastKnownPlayerPos, dash.telegraphRadius, markDuration);
     }
+
+    dashVelocity = direction * (speed * dash.speedMul * dash.phaseSpeedMul[phaseIndex()]);
+    dashWindup = dash.windup;
+    dashPending = true;
 }
 
-void BossEnemy::patternSummonAdds() {
+void BossEnemy::patternSummonAdds(World& world) {
     // Количество миньонов зависит от фазы
-    int numAdds = 2 + (phase == BossPhase::PHASE2 ? 1 : (phase == BossPhase::ENRAGE ? 2 : 0));
-    
+    const SummonDef& summon = config.summon;
+    const int numAdds = summon.count[phaseIndex()];
+    const float margin = 40.0f;
+
     for (int i = 0; i < numAdds; ++i) {
-        // Спавним врагов по кругу вокруг босса
+        // Спавним врагов по кругу вокруг босса, через обычные индикаторы спавна
         float angle = (2.0f * 3.14159f * i) / numAdds;
-        float radius = 150.0f;
-        Vector2 spawnPos = position + Vector2(cos(angle) * radius, sin(angle) * radius);
-        
-        // Здесь можно интегрировать систему индикаторов спавна через Game позже
+        Vector2 spawnPos = position + Vector2(std::cos(angle) * summon.radius, std::sin(angle) * summon.radius);
+        spawnPos.x = std::clamp(spawnPos.x, margin, LOGICAL_WIDTH - margin);
+        spawnPos.y = std::clamp(spawnPos.y, margin, LOGICAL_HEIGHT - margin);
+        spawnEnemyTelegraph(world, spawnPos, summon.telegraphSeconds, summon.type);
     }
 }
 
-void BossEnemy::patternSpiralShots(std::vector<std::unique_ptr<Bullet>>& bullets) {
-    static float spiralAngle = 0.0f;
-    bool isMegaSlime = std::string(config.name) == "MEGA SLIME";
-    bool isMortorhead = std::string(config.name) == "MORTORHEAD PRIME";
-    
-    // Настройки в зависимости от типа босса
-    int baseSpiralCount;
-    float baseSpeed;
-    float bulletRange = 750.0f; // Увеличенный радиус полёта для всех боссов
-    
-    if (isMegaSlime) {
-        baseSpiralCount = 3;  // Больше спиралей, медленнее
-        baseSpeed = 180.0f;
-        bulletRange = 600.0f; // Чуть меньше для слайма (компенсация за количество)
-    } else if (isMortorhead) {
-        baseSpiralCount = 4;  // Ещё больше спиралей для Mortorhead
-        baseSpeed = 300.0f;   // И быстрее
-        bulletRange = 900.0f; // Больше для Mortorhead (он специалист по спиралям)
-    } else {
-        baseSpiralCount = 2;
-        baseSpeed = 250.0f;
-    }
-    
-    const int spiralsCount = baseSpiralCount + (phase == BossPhase::PHASE2 ? 1 : (phase == BossPhase::ENRAGE ? 2 : 0));
-    const float bulletSpeed = baseSpeed;
-    
-    // Создаем спиральные лучи
-    for (int spiral = 0; spiral < spiralsCount; ++spiral) {
-        float angle = spiralAngle + (2.0f * 3.14159f * spiral) / spiralsCount;
-        Vector2 direction(cos(angle), sin(angle));
-        
-        auto bullet = std::make_unique<Bullet>(
-            position,
-            direction * bulletSpeed,
-            damage,
-            true
-        );
-        bullets.push_back(std::move(bullet));
-    }
-    
-    // Увеличиваем угол для следующего кадра
-    spiralAngle += 0.2f;
-    if (spiralAngle > 2.0f * 3.14159f) {
-        spiralAngle -= 2.0f * 3.14159f;
-    }
+void BossEnemy::telegraph(const Vector2& pos, float radius, float duration) {
+    telegraphs.push_back({pos, radius, duration, duration});
 }
 
-void BossEnemy::patternBurstAim(std::vector<std::unique_ptr<Bullet>>& bullets) {
-    // Вычисляем направление к последней позиции игрока
-    Vector2 direction = (lastKnownPlayerPos - position).normalized();
-    
-    bool isDarkPebblin = std::string(config.name) == "DARK PEBBLIN";
-    
-    int baseBurstCount = isDarkPebblin ? 4 : 3;    // was 5 for dark pebblin
-    float baseBulletSpeed = isDarkPebblin ? 300.0f : 260.0f;
-
-    int burstCount = baseBurstCount + (phase == BossPhase::PHASE2 ? 1 : (phase == BossPhase::ENRAGE ? 3 : 0));
-    float bulletSpeed = baseBulletSpeed;
-
-    for (int i = 0; i < burstCount; ++i) {
-        float spread = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f;
-        float baseAngle = atan2(direction.y, direction.x);
-        float angle = baseAngle + spread;
-        Vector2 bulletDir(cos(angle), sin(angle));
-        Vector2 bulletVelocity = bulletDir * bulletSpeed;
-        float bulletRange = 650.0f; // was 750
-        bullets.push_back(std::make_unique<Bullet>(position, bulletVelocity, damage, bulletRange, bulletSpeed, BulletType::PISTOL, true));
-    }
-}
+void BossEnemy::renderTelegraphs(RenderQueue& queue, const Viewport& view) const {
+    const int segments = 48;
+    for (const TelegraphMark& mark : telegraphs) {
+        if (!view.contains(mark.position, mark.radius)) continue;
+        // Пульсирующее кольцо, которое сжимается к моменту удара
+        float elapsed = mark.duration - mark.remaining;
+        float pulse = 0.5f + 0.5f * std::sin(elapsed * 18.0f);
+        float ringRadius = mark.radius * (0.6f + 0.4f * mark.remaining / mark.duration);
+        SDL_Color color = {255, 60, 40, static_cast<Uint8>(120 + 120 * pulse)};
 
-void BossEnemy::telegraph(const Vector2& pos, float radius, float duration) {
-    // Заглушка: будущая интеграция телеграфа через Game
+        SDL_Point points[segments + 1];
+        for (int i = 0; i <= segments; i++) {
+            float a = 2.0f * 3.14159f * i / segments;
+            points[i] = {static_cast<int>(mark.position.x + std::cos(a) * ringRadius),
+                         static_cast<int>(mark.position.y + std::sin(a) * ringRadius)};
+        }
+        queue.lines(RenderLayer::BOSS, 0, points, segments + 1, color, SDL_BLENDMODE_BLEND);
+    }
 }
 
 void BossEnemy::takeDamage(int amount) {
@@ -374,4 +317,72 @@ void BossEnemy::takeDamage(int amount) {
     if (health == 0) {
         alive = false;
     }
-}
\ No newline at end of file
+}
+
+void BossEnemy::save(SnapshotWriter& out) const {
+    // Состояние Enemy копируется целиком; у потомка своя часть ниже
+    Enemy base(*this);
+    out.writeBytes(&base, sizeof(Enemy));
+
+    out.write(phase);
+    out.write(phaseTimer);
+    out.write(attackCooldown);
+    out.write(rng);
+    out.write(lastPatterns);
+    out.write(static_cast<uint32_t>(patternHistoryCount));
+    out.write(static_cast<uint32_t>(patternHistoryNext));
+    out.write(maxHealthValue);
+    out.write(lastKnownPlayerPos);
+
+    // Эмиттер ссылается на описание в конфиге; сохраняем его номер
+    const EmitterDef* defs[] = {&config.radial, &config.spiral, &config.burst};
+    out.writeCount(emitters.size());
+    for (const ActiveEmitter& emitter : emitters) {
+        uint8_t defIndex = 0;
+        for (uint8_t i = 0; i < 3; i++) {
+            if (emitter.def == defs[i]) defIndex = i;
+        }
+        out.write(defIndex);
+        out.write(emitter.volleysLeft);
+        out.write(emitter.timer);
+        out.write(emitter.angle);
+        out.write(emitter.speed);
+    }
+    out.writeVector(telegraphs);
+
+    out.write(dashPending);
+    out.write(dashWindup);
+    out.write(dashVelocity);
+}
+
+bool BossEnemy::load(SnapshotReader& in) {
+    Enemy base(*this);
+    in.readBytes(&base, sizeof(Enemy));
+    static_cast<Enemy&>(*this) = base;
+
+    in.read(phase);
+    in.read(phaseTimer);
+    in.read(attackCooldown);
+    in.read(rng);
+    in.read(lastPatterns);
+    patternHistoryCount = std::min<size_t>(in.read<uint32_t>(), MAX_PATTERN_HISTORY);
+    patternHistoryNext = in.read<uint32_t>() % MAX_PATTERN_HISTORY;
+    in.read(maxHealthValue);
+    in.read(lastKnownPlayerPos);
+
+    const EmitterDef* defs[] = {&config.radial, &config.spiral, &config.burst};
+    emitters.resize(in.readCount(256));
+    for (ActiveEmitter& emitter : emitters) {
+        emitter.def = defs[in.read<uint8_t>() % 3];
+        in.read(emitter.volleysLeft);
+        in.read(emitter.timer);
+        in.read(emitter.angle);
+        in.read(emitter.speed);
+    }
+    in.readVector(telegraphs, 1024);
+
+    in.read(dashPending);
+    in.read(dashWindup);
+    in.read(dashVelocity);
+    return in.ok();
+}
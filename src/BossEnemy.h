@@ -1,10 +1,12 @@
 #pragma once
 #include "Enemy.h"
+#include "Components.h"
+#include "Random.h"
+#include <array>
 #include <random>
 #include <vector>
-#include <queue>
 
-class Bullet;
+class World;
 
 enum class BossPhase {
     PHASE1,
@@ -12,6 +14,8 @@ enum class BossPhase {
     ENRAGE
 };
 
+static const int BOSS_PHASE_COUNT = 3;
+
 enum class BossPattern {
     RADIAL_SHOTS,
     DASH_TO_PLAYER,
@@ -20,49 +24,149 @@ enum class BossPattern {
     BURST_AIM
 };
 
+static const int BOSS_PATTERN_COUNT = 5;
+
+// Per-phase value (PHASE1, PHASE2, ENRAGE)
+template<typename T>
+using PhaseValues = std::array<T, BOSS_PHASE_COUNT>;
+
+enum class EmitterShape {
+    RING,        // evenly spaced around the boss, rotating by rotationStep per volley
+    AIMED_BURST  // at the player with a little random spread
+};
+
+// One bullet emitter. An activation fires `volleys` volleys, volleyInterval apart.
+struct EmitterDef {
+    EmitterShape shape = EmitterShape::RING;
+    PhaseValues<int> shots = {10, 10, 10};        // bullets per volley
+    PhaseValues<float> speed = {200, 200, 200};   // bullet speed at the first volley
+    float speedStep = 0.0f;                       // added per volley (speed curve within an activation)
+    int volleys = 1;
+    float volleyInterval = 0.0f;
+    float rotationStep = 0.0f;                    // radians per volley; makes rings spiral
+    float range = 600.0f;
+};
+
+struct DashDef {
+    PhaseValues<int> chain = {1, 1, 1};           // telegraphed hops shown along the dash line
+    float hopDistance = 0.0f;                     // 0 = single mark on the player's position
+    float speedMul = 5.0f;                        // times the boss's walk speed
+    PhaseValues<float> phaseSpeedMul = {1.0f, 1.15f, 1.35f};
+    float telegraphRadius = 64.0f;
+    float windup = 0.6f;                          // telegraph shows this long before the boss moves
+};
+
+// Adds arrive through the normal spawn-indicator path
+struct SummonDef {
+    PhaseValues<int> count = {2, 3, 4};
+    float radius = 150.0f;
+    EnemySpawnType type = EnemySpawnType::BASE;
+    float telegraphSeconds = 1.0f;
+};
+
 struct BossConfig {
     const char* name;
+    const char* texture = "assets/enemies/mortorhead.png";
     float scale = 2.5f;
     float hpMul = 1200.f;  // default baseline; overridden per wave below
     float dmgMul = 2.0f;
     float speedMul = 0.6f;
+
+    EmitterDef radial;
+    EmitterDef spiral;
+    EmitterDef burst;
+    DashDef dash;
+    SummonDef summon;
+
+    // Cooldown after starting each pattern, indexed by BossPattern, scaled per phase
+    std::array<float, BOSS_PATTERN_COUNT> cooldowns = {1.5f, 2.5f, 5.0f, 1.8f, 1.2f};
+    PhaseValues<float> cooldownScale = {1.0f, 0.9f, 0.8f};
+
     std::vector<std::pair<BossPattern, float>> weightsP1;
     std::vector<std::pair<BossPattern, float>> weightsP2;
     std::vector<std::pair<BossPattern, float>> weightsEnrage;
+
+    // Hard caps so the worst-case frame cost is known up front
+    int bulletsPerFrame = 48;
+    int maxLiveBullets = 320;
+
     uint32_t seed;
 };
 
+// Boss definitions live in BossDefinitions.cpp
+BossConfig makeBossConfig(int waveIndex);
+// Every sprite any definition uses, for prefetching
+std::vector<const char*> bossTexturePaths();
+
+// Reuses Enemy's state and shared movement/animation helpers; owned directly by Game, so no virtual dispatch
 class BossEnemy : public Enemy {
 public:
-    BossEnemy(const Vector2& spawnPos, SDL_Renderer* renderer, const BossConfig& config);
-    void update(float dt, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) override;
-    void render(SDL_Renderer* r) override;
+    BossEnemy(const Vector2& spawnPos, TextureHandle texture, const BossConfig& config);
+    void update(float dt, Vector2 playerPos, World& world);
+    void render(RenderQueue& queue, const Viewport& view);
     void takeDamage(int amount);
     bool isDead() const { return health <= 0; }
     const char* getName() const { return config.name; }
     float getHealthPercent() const { return maxHealthValue > 0 ? static_cast<float>(health) / static_cast<float>(maxHealthValue) : 0.0f; }
 
+    // Snapshot section (Snapshot.h). The config isn't stored: the owner rebuilds
+    // it with makeBossConfig() for the same wave before calling load()
+    void save(SnapshotWriter& out) const;
+    bool load(SnapshotReader& in);
+
 private:
+    // A running emitter activation
+    struct ActiveEmitter {
+        const EmitterDef* def;
+        int volleysLeft;
+        float timer;     // until the next volley
+        float angle;     // ring orientation
+        float speed;     // current point on the speed curve
+    };
+
+    struct TelegraphMark {
+        Vector2 position;
+        float radius;
+        float remaining;
+        float duration;
+    };
+
     BossConfig config;
+    TextureHandle texture;
+    int spriteSize;
     BossPhase phase = BossPhase::PHASE1;
     float phaseTimer = 0.f;
     float attackCooldown = 0.f;
-    std::mt19937 rng;
-    std::queue<BossPattern> lastPatterns;
+    Pcg32 rng;
+    // Последние паттерны, кольцевой буфер без аллокаций
     static constexpr size_t MAX_PATTERN_HISTORY = 3;
+    std::array<BossPattern, MAX_PATTERN_HISTORY> lastPatterns{};
+    size_t patternHistoryCount = 0;
+    size_t patternHistoryNext = 0;
     int maxHealthValue = 0;
     Vector2 lastKnownPlayerPos;
 
+    std::vector<ActiveEmitter> emitters;
+    std::vector<TelegraphMark> telegraphs;
+    int bulletsThisFrame = 0;
+
+    // Dash waiting for its telegraph to finish
+    bool dashPending = false;
+    float dashWindup = 0.0f;
+    Vector2 dashVelocity;
+
+    int phaseIndex() const { return static_cast<int>(phase); }
     void updatePhase();
     BossPattern nextPattern();
-    void performPattern(float dt, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void patternRadialShots(std::vector<std::unique_ptr<Bullet>>& bullets);
+    void performPattern(World& world);
+    void startEmitter(const EmitterDef& def);
+    void updateEmitters(float dt, World& world);
+    void fireVolley(ActiveEmitter& emitter, World& world);
     void patternDashToPlayer();
-    void patternSummonAdds();
-    void patternSpiralShots(std::vector<std::unique_ptr<Bullet>>& bullets);
-    void patternBurstAim(std::vector<std::unique_ptr<Bullet>>& bullets);
+    void patternSummonAdds(World& world);
     void telegraph(const Vector2& pos, float radius, float duration);
-    
+    void renderTelegraphs(RenderQueue& queue, const Viewport& view) const;
+
     std::vector<std::pair<BossPattern, float>>& getCurrentWeights();
     bool tooManyRepeats(BossPattern pattern) const;
 };
@@ -1,52 +1,44 @@
 #include "Bullet.h"
+#include "RenderScaler.h"
+#include "Systems.h"
 
-Bullet::Bullet(Vector2 pos, Vector2 dir, int dmg, float range, float speed, BulletType type, bool enemyOwnedFlag) 
-    : position(pos), startPosition(pos), direction(dir.normalized()), 
-      speed(speed), radius(7), maxRange(range), damage(dmg), alive(true), bulletType(type),
-      velocity(dir.normalized() * speed), gravity(550.0f), enemyOwned(enemyOwnedFlag) {
-}
-
-void Bullet::update(float deltaTime) {
-    if (bulletType == BulletType::ENEMY_LOB) {
-        // simple parabolic motion: integrate velocity with gravity downward
-        velocity.y += gravity * deltaTime;
-        position += velocity * deltaTime;
-    } else {
-        position += direction * speed * deltaTime;
+Entity spawnBullet(World& world, Vector2 pos, Vector2 dir, int damage, float range, float speed, BulletType type, bool enemyOwned) {
+    Velocity velocity{dir.normalized() * speed};
+    float maxRange = range;
+    if (type == BulletType::ENEMY_LOB) {
+        // simple parabolic motion: gravity pulls "down" on screen, so allow a longer path
+        velocity.gravity = 550.0f;
+        maxRange = range * 1.5f;
     }
     
-    // Check if bullet is out of bounds
-    if (position.x < 0 || position.x > 1920 || position.y < 0 || position.y > 1080) {
-        alive = false;
-    }
+    // Color based on ownership: red for enemies, yellow for player
+    Sprite sprite;
+    sprite.color = enemyOwned ? SDL_Color{255, 50, 50, 255} : SDL_Color{255, 255, 0, 255};
     
-    // Check if bullet has exceeded its range for non-lob; for lob, use bigger cap
-    float distanceTraveled = startPosition.distance(position);
-    float allowedRange = (bulletType == BulletType::ENEMY_LOB) ? maxRange * 1.5f : maxRange;
-    if (distanceTraveled > allowedRange) {
-        alive = false;
-    }
+    return world.create(Transform{pos}, velocity, Collider{7.0f}, Projectile{pos, maxRange, damage},
+                        TeamTag{enemyOwned ? Team::ENEMY : Team::PLAYER}, sprite);
 }
 
-void Bullet::render(SDL_Renderer* renderer) {
-    if (!alive) return;
-    
-    // Color based on ownership: red for enemies, yellow for player
-    if (enemyOwned) {
-        SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255); // Red for enemy bullets
-    } else {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Yellow for player bullets
-    }
-    
-    int centerX = (int)position.x;
-    int centerY = (int)position.y;
-    int r = (int)radius;
-    
-    for (int x = -r; x <= r; x++) {
-        for (int y = -r; y <= r; y++) {
-            if (x*x + y*y <= r*r) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
+void updateBullets(World& world, const Viewport& bounds) {
+    world.each<Transform, Projectile>([&world, &bounds](Entity entity, Transform& transform, Projectile& projectile) {
+        const Vector2& position = transform.position;
+        
+        // Check if bullet is out of the visible play area
+        if (!bounds.contains(position, 0.0f)) {
+            world.destroy(entity);
+            return;
         }
-    }
-}
\ No newline at end of file
+        
+        if (projectile.origin.distance(position) > projectile.maxRange) {
+            world.destroy(entity);
+        }
+    });
+}
+
+void renderBullets(World& world, RenderQueue& queue, const Viewport& view) {
+    world.each<Transform, Collider, Sprite>([&queue, &view](Entity, Transform& transform, Collider& collider, Sprite& sprite) {
+        if (!view.contains(transform.position, collider.radius)) return;
+        queue.fillCircle(RenderLayer::BULLETS, 0, (int)transform.position.x, (int)transform.position.y,
+                         (int)collider.radius, sprite.color);
+    }, componentMask<Projectile>());
+}
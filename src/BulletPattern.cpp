@@ -0,0 +1,52 @@
+#include "BulletPattern.h"
+#include <algorithm>
+
+namespace {
+    // Rings of 1..MAX_RING_SHOTS stored back to back; ring N starts at N*(N-1)/2
+    constexpr int RING_TABLE_SIZE = MAX_RING_SHOTS * (MAX_RING_SHOTS + 1) / 2;
+
+    constexpr std::array<Rotation, RING_TABLE_SIZE> makeRingTable() {
+        std::array<Rotation, RING_TABLE_SIZE> table{};
+        int index = 0;
+        for (int count = 1; count <= MAX_RING_SHOTS; count++) {
+            for (int i = 0; i < count; i++) {
+                table[index++] = pattern_detail::rotationFor(2.0 * pattern_detail::PI * i / count);
+            }
+        }
+        return table;
+    }
+
+    constexpr std::array<Rotation, AIM_JITTER_SIZE> makeJitterTable(double maxError) {
+        std::array<Rotation, AIM_JITTER_SIZE> table{};
+        uint32_t state = 0x9E3779B9u;
+        for (int i = 0; i < AIM_JITTER_SIZE; i++) {
+            state = state * 1664525u + 1013904223u;
+            double unit = (state >> 8) / static_cast<double>(1u << 24); // [0, 1)
+            table[i] = pattern_detail::rotationFor((unit * 2.0 - 1.0) * maxError);
+        }
+        return table;
+    }
+
+    constexpr std::array<Rotation, RING_TABLE_SIZE> RING_TABLE = makeRingTable();
+    constexpr std::array<Rotation, AIM_JITTER_SIZE> AIM_JITTER = makeJitterTable(0.1);
+}
+
+const Rotation* ringRotations(int count) {
+    count = std::max(1, std::min(count, MAX_RING_SHOTS));
+    return &RING_TABLE[count * (count - 1) / 2];
+}
+
+const Rotation* aimJitter(int count, uint32_t seed) {
+    count = std::max(1, std::min(count, AIM_JITTER_SIZE));
+    return &AIM_JITTER[seed % (AIM_JITTER_SIZE - count + 1)];
+}
+
+void emitPattern(World& world, Vector2 origin, Vector2 baseDir, const PatternSpec& spec) {
+    Vector2 dir = baseDir.normalized();
+    world.reserve<Transform, Velocity, Collider, Projectile, TeamTag, Sprite>(spec.count);
+    for (int i = 0; i < spec.count; i++) {
+        const Rotation& r = spec.rotations[i];
+        Vector2 shotDir(dir.x * r.c - dir.y * r.s, dir.x * r.s + dir.y * r.c);
+        spawnBullet(world, origin, shotDir, spec.damage, spec.range, spec.speed, spec.type, spec.enemyOwned);
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "Bullet.h"
+
+// Precomputed volley shapes. Every rotation a pattern uses is baked at compile
+// time, so firing a volley is one multiply-add per bullet instead of a cos/sin
+// pair, and the bullets go into World in one reserved batch.
+
+struct Rotation {
+    float c;
+    float s;
+};
+
+namespace pattern_detail {
+    constexpr double PI = 3.14159265358979323846;
+
+    // Taylor series after reducing to [-pi, pi]; std::sin isn't constexpr
+    constexpr double sinApprox(double x) {
+        while (x > PI) x -= 2.0 * PI;
+        while (x < -PI) x += 2.0 * PI;
+        double term = x;
+        double sum = x;
+        for (int n = 1; n < 12; n++) {
+            term *= -x * x / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr double cosApprox(double x) { return sinApprox(x + PI / 2.0); }
+
+    constexpr Rotation rotationFor(double radians) {
+        return { static_cast<float>(cosApprox(radians)), static_cast<float>(sinApprox(radians)) };
+    }
+}
+
+// Evenly spaced ring of up to MAX_RING_SHOTS shots
+static const int MAX_RING_SHOTS = 32;
+const Rotation* ringRotations(int count);
+
+// Symmetric fan of N shots, `step` radians apart, centred on the aim direction
+template<int N>
+constexpr std::array<Rotation, N> makeFan(double step) {
+    std::array<Rotation, N> rotations{};
+    for (int i = 0; i < N; i++) {
+        rotations[i] = pattern_detail::rotationFor((i - (N - 1) / 2.0) * step);
+    }
+    return rotations;
+}
+
+// Table of small random-looking aim errors (within +-maxError radians). A volley
+// takes a random window of it, so bursts still scatter without calling rand/cos/sin per shot.
+static const int AIM_JITTER_SIZE = 64;
+const Rotation* aimJitter(int count, uint32_t seed);
+
+struct PatternSpec {
+    const Rotation* rotations; // `count` rotations applied to the base direction
+    int count;
+    float speed;
+    float range;
+    int damage;
+    BulletType type = BulletType::PISTOL;
+    bool enemyOwned = true;
+};
+
+// Fires spec.count bullets from origin, each one spec.rotations[i] away from baseDir
+void emitPattern(World& world, Vector2 origin, Vector2 baseDir, const PatternSpec& spec);
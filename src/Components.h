@@ -0,0 +1,107 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <tuple>
+#include "Vector2.h"
+
+// Plain-data components stored by World. Anything with a Transform and the
+// right mix of these gets picked up by the matching systems, so a new kind of
+// world object (a hazard, a drop, a turret) is a new combination rather than a
+// new class with its own update/render/erase loops.
+
+enum class Team {
+    PLAYER,
+    ENEMY,
+    NEUTRAL
+};
+
+enum class EnemySpawnType {
+    BASE,
+    SLIME,
+    PEBBLIN
+};
+
+struct Transform {
+    Vector2 position;
+};
+
+struct Velocity {
+    Vector2 value;
+    float gravity = 0.0f; // Added to value.y every second (lobbed shots)
+};
+
+struct Collider {
+    float radius;
+};
+
+struct Lifetime {
+    float age = 0.0f;
+    float duration;
+    float fadeStart; // Age at which the entity starts fading out / warning
+
+    bool expired() const { return age >= duration; }
+    // 1 until fadeStart, then linearly down to 0 at duration
+    float fade() const {
+        if (age <= fadeStart || duration <= fadeStart) return 1.0f;
+        float t = 1.0f - (age - fadeStart) / (duration - fadeStart);
+        return t < 0.0f ? 0.0f : t;
+    }
+};
+
+struct Sprite {
+    SDL_Texture* texture = nullptr; // Optional; kinds without one draw primitives
+    SDL_Color color = {255, 255, 255, 255};
+    float scale = 1.0f;
+    int width = 0;  // Texture size, queried once at spawn
+    int height = 0;
+};
+
+struct TeamTag {
+    Team team;
+};
+
+// Vertical bobbing for pickups
+struct Bob {
+    float phase;
+    float speed;
+    float amplitude;
+};
+
+struct Projectile {
+    Vector2 origin;
+    float maxRange;
+    int damage;
+};
+
+enum class PickupKind {
+    EXPERIENCE_ORB,
+    MATERIAL
+};
+
+struct Pickup {
+    PickupKind kind;
+    int experience;
+    int materials;
+};
+
+struct BombFuse {
+    float timer;
+    float maxTimer;
+    float flashTimer = 0.0f;
+    float flashInterval = 0.2f;
+    bool showFlash = false;
+    bool exploded = false;
+    bool damageApplied = false;
+    int damage;
+};
+
+struct SpawnTelegraph {
+    EnemySpawnType enemyType;
+};
+
+// Tag: purely visual entities that keep simulating while gameplay is frozen
+struct Cosmetic {};
+
+// Every component type World can store; the position in this list is the component's bit
+using ComponentList = std::tuple<Transform, Velocity, Collider, Lifetime, Sprite, TeamTag,
+                                 Bob, Projectile, Pickup, BombFuse, SpawnTelegraph, Cosmetic>;
@@ -0,0 +1,124 @@
+#include "Definitions.h"
+#include "Weapon.h"
+#include "Enemy.h"
+#include "Item.h"
+#include "Log.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace {
+    // defs.bin as read; uint32_t elements keep every record 4-byte aligned
+    std::vector<uint32_t> image;
+    const DefsHeader* header = nullptr;
+    const WeaponDef* weapons = nullptr;
+    const EnemyDef* enemies = nullptr;
+    const ItemDef* items = nullptr;
+    const char* strings = nullptr;
+
+    bool tableFits(uint32_t offset, uint32_t count, size_t recordSize, size_t fileSize) {
+        return offset % 4 == 0 && offset <= fileSize && count <= (fileSize - offset) / recordSize;
+    }
+}
+
+namespace Defs {
+    bool load(const std::string& path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            LOG_ERROR(CORE, "Missing %s - build the defs_compiler target to generate it", path.c_str());
+            return false;
+        }
+        size_t size = static_cast<size_t>(in.tellg());
+        image.assign((size + 3) / 4, 0);
+        in.seekg(0);
+        if (size < sizeof(DefsHeader) || !in.read(reinterpret_cast<char*>(image.data()), static_cast<std::streamsize>(size))) {
+            LOG_ERROR(CORE, "%s is truncated", path.c_str());
+            return false;
+        }
+
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(image.data());
+        const DefsHeader* h = reinterpret_cast<const DefsHeader*>(base);
+        if (h->magic != DEFS_MAGIC || h->version != DEFS_VERSION) {
+            LOG_ERROR(CORE, "%s is not a version %u definitions table - rebuild it", path.c_str(), DEFS_VERSION);
+            return false;
+        }
+        // Structure only: the compiler already validated the content
+        if (!tableFits(h->weaponsOffset, h->weaponCount, sizeof(WeaponDef), size) ||
+            !tableFits(h->enemiesOffset, h->enemyCount, sizeof(EnemyDef), size) ||
+            !tableFits(h->itemsOffset, h->itemCount, sizeof(ItemDef), size) ||
+            h->stringsOffset > size || h->stringsSize == 0 || h->stringsSize > size - h->stringsOffset ||
+            base[h->stringsOffset + h->stringsSize - 1] != '\0') {
+            LOG_ERROR(CORE, "%s is corrupt", path.c_str());
+            return false;
+        }
+        if (h->weaponCount < 3 || h->weaponCount > DEFS_MAX_WEAPONS ||
+            h->enemyCount != ENEMY_TYPE_COUNT || h->itemCount != ITEM_TYPE_COUNT) {
+            LOG_ERROR(CORE, "%s doesn't match this build (%u weapons, %u enemies, %u items)",
+                      path.c_str(), h->weaponCount, h->enemyCount, h->itemCount);
+            return false;
+        }
+
+        header = h;
+        weapons = reinterpret_cast<const WeaponDef*>(base + h->weaponsOffset);
+        enemies = reinterpret_cast<const EnemyDef*>(base + h->enemiesOffset);
+        items = reinterpret_cast<const ItemDef*>(base + h->itemsOffset);
+        strings = reinterpret_cast<const char*>(base + h->stringsOffset);
+        LOG_INFO(CORE, "Loaded %s: %u weapons, %u enemies, %u items",
+                 path.c_str(), h->weaponCount, h->enemyCount, h->itemCount);
+        return true;
+    }
+
+    int weaponCount() {
+        return static_cast<int>(header->weaponCount);
+    }
+
+    const WeaponDef& weapon(WeaponType type) {
+        return weapons[static_cast<int>(type)];
+    }
+
+    const WeaponTierDef& weaponTier(WeaponType type, WeaponTier tier) {
+        return weapons[static_cast<int>(type)].tiers[static_cast<int>(tier) - 1];
+    }
+
+    const EnemyDef& enemy(EnemyType type) {
+        return enemies[static_cast<int>(type)];
+    }
+
+    const ItemDef& item(ItemType type) {
+        return items[static_cast<int>(type)];
+    }
+
+    const char* text(uint32_t offset) {
+        return offset < header->stringsSize ? strings + offset : "";
+    }
+
+    void describeItem(ItemType type, int power, char* out, size_t size) {
+        const ItemDef& def = item(type);
+        const int radius = static_cast<int>(power * def.radiusPerPower);
+        size_t length = 0;
+        for (const char* c = text(def.description); *c && length + 1 < size;) {
+            int value;
+            size_t skip;
+            if (std::strncmp(c, "{power}", 7) == 0) {
+                value = power;
+                skip = 7;
+            } else if (std::strncmp(c, "{radius}", 8) == 0) {
+                value = radius;
+                skip = 8;
+            } else {
+                out[length++] = *c++;
+                continue;
+            }
+            int written = std::snprintf(out + length, size - length, "%d", value);
+            length = std::min(size - 1, length + static_cast<size_t>(std::max(written, 0)));
+            c += skip;
+        }
+        if (size > 0) out[length] = '\0';
+    }
+}
+
+const EnemyTypeInfo& getEnemyTypeInfo(EnemyType type) {
+    return Defs::enemy(type).info;
+}
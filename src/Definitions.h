@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include "DefsFormat.h"
+
+enum class WeaponType;
+enum class WeaponTier;
+enum class EnemyType;
+enum class ItemType;
+
+// Weapon, enemy and item definitions compiled from data/*.def by defs_compiler.
+// load() reads defs.bin into memory once and checks the header; after that every
+// lookup is an array index into the file image, with no parsing at all.
+namespace Defs {
+    const char* const DEFAULT_PATH = "data/defs.bin";
+
+    bool load(const std::string& path = DEFAULT_PATH);
+
+    // Weapon ids are 0..weaponCount()-1; the named WeaponType values come first
+    int weaponCount();
+    const WeaponDef& weapon(WeaponType type);
+    const WeaponTierDef& weaponTier(WeaponType type, WeaponTier tier);
+    const EnemyDef& enemy(EnemyType type);
+    const ItemDef& item(ItemType type);
+
+    // Text fields are offsets into the string block
+    const char* text(uint32_t offset);
+
+    // An item's description with {power} and {radius} filled in
+    void describeItem(ItemType type, int power, char* out, size_t size);
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+
+// On-disk layout of the compiled gameplay definitions (defs.bin), shared by the
+// offline compiler (tools/DefsCompiler.cpp) and the runtime reader (Definitions).
+// The text sources live in data/*.def.
+//
+//   DefsHeader
+//   WeaponDef[weaponCount]        <- weaponsOffset
+//   EnemyDef[enemyCount]          <- enemiesOffset
+//   ItemDef[itemCount]            <- itemsOffset
+//   NUL-terminated strings        <- stringsOffset
+//
+// Records are used in place: ids are array indices and text fields are byte
+// offsets into the string block. Every field is 4 bytes, little-endian.
+
+constexpr uint32_t DEFS_MAGIC = 0x46454442; // "BDEF"
+constexpr uint32_t DEFS_VERSION = 1;
+constexpr int DEFS_MAX_WEAPONS = 16;
+constexpr int DEFS_TIER_COUNT = 4;
+
+enum DefsWeaponFlags : uint32_t {
+    DEFS_WEAPON_MELEE = 1u << 0,   // Swings at range instead of firing bullets
+    DEFS_WEAPON_SHOP = 1u << 1     // Offered in the shop
+};
+
+struct DefsHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t weaponCount;
+    uint32_t enemyCount;
+    uint32_t itemCount;
+    uint32_t weaponsOffset;
+    uint32_t enemiesOffset;
+    uint32_t itemsOffset;
+    uint32_t stringsOffset;
+    uint32_t stringsSize;
+};
+
+struct WeaponTierDef {
+    uint32_t name;          // "Tier 2 Pistol"
+    uint32_t sprite;        // Asset path
+    int32_t damage;
+    float cooldown;         // Seconds between shots
+    float critChance;       // 0.0 to 1.0
+};
+
+struct WeaponDef {
+    uint32_t key;           // Id in the .def source, e.g. "pistol"
+    uint32_t description;
+    uint32_t flags;         // DefsWeaponFlags
+    float range;
+    float critMultiplier;
+    int32_t knockback;
+    float lifesteal;
+    float rangedScaling;
+    float meleeScaling;
+    float elementalScaling;
+    int32_t pellets;        // Bullets per shot
+    float spread;           // Radians either side of the aim; one pellet deviates randomly, several fan out
+    float bulletSpeed;
+    WeaponTierDef tiers[DEFS_TIER_COUNT];
+};
+
+// Per-type enemy tuning; the only thing that differs between enemies of one type is their state
+struct EnemyTypeInfo {
+    float speed;
+    float radius;
+    int32_t damage;
+    int32_t health;
+    float fireCooldown;     // 0 = never shoots
+    float frameInterval;    // Idle animation frame time
+};
+
+struct EnemyDef {
+    uint32_t key;
+    EnemyTypeInfo info;
+};
+
+struct ItemDef {
+    uint32_t key;
+    uint32_t name;
+    uint32_t description;   // "{power}" and "{radius}" are filled in for the shop
+    uint32_t icon;          // Asset path
+    float fuseSeconds;      // Bombs: delay before the blast
+    float radiusPerPower;   // Bombs: blast radius per point of power
+};
+
+static_assert(sizeof(DefsHeader) == 40, "DefsHeader layout changed");
+static_assert(sizeof(WeaponTierDef) == 20, "WeaponTierDef layout changed");
+static_assert(sizeof(WeaponDef) == 52 + DEFS_TIER_COUNT * 20, "WeaponDef layout changed");
+static_assert(sizeof(EnemyDef) == 28, "EnemyDef layout changed");
+static_assert(sizeof(ItemDef) == 24, "ItemDef layout changed");
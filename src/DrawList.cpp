@@ -0,0 +1,148 @@
+#include "DrawList.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// 5x7 glyphs, one byte per row, bit 4 = leftmost column
+const uint8_t DIGIT_GLYPHS[10][7] = {
+    {0b01110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110}, // 0
+    {0b00100, 0b01100, 0b00100, 0b00100, 0b00100, 0b00100, 0b01110}, // 1
+    {0b01110, 0b10001, 0b00001, 0b00110, 0b01000, 0b10000, 0b11111}, // 2
+    {0b01110, 0b10001, 0b00001, 0b00110, 0b00001, 0b10001, 0b01110}, // 3
+    {0b00010, 0b00110, 0b01010, 0b10010, 0b11111, 0b00010, 0b00010}, // 4
+    {0b11111, 0b10000, 0b11110, 0b00001, 0b00001, 0b10001, 0b01110}, // 5
+    {0b01110, 0b10001, 0b10000, 0b11110, 0b10001, 0b10001, 0b01110}, // 6
+    {0b11111, 0b00001, 0b00010, 0b00100, 0b01000, 0b01000, 0b01000}, // 7
+    {0b01110, 0b10001, 0b10001, 0b01110, 0b10001, 0b10001, 0b01110}, // 8
+    {0b01110, 0b10001, 0b10001, 0b01111, 0b00001, 0b10001, 0b01110}  // 9
+};
+
+struct LetterGlyph {
+    char c;
+    uint8_t rows[7];
+};
+
+const LetterGlyph LETTER_GLYPHS[] = {
+    {'A', {0b01110, 0b10001, 0b10001, 0b11111, 0b10001, 0b10001, 0b10001}},
+    {'B', {0b11110, 0b10001, 0b10001, 0b11110, 0b10001, 0b10001, 0b11110}},
+    {'C', {0b01110, 0b10001, 0b10000, 0b10000, 0b10000, 0b10001, 0b01110}},
+    {'D', {0b11110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b11110}},
+    {'E', {0b11111, 0b10000, 0b10000, 0b11110, 0b10000, 0b10000, 0b11111}},
+    {'F', {0b11111, 0b10000, 0b10000, 0b11110, 0b10000, 0b10000, 0b10000}},
+    {'G', {0b01110, 0b10001, 0b10000, 0b10111, 0b10001, 0b10001, 0b01110}},
+    {'H', {0b10001, 0b10001, 0b10001, 0b11111, 0b10001, 0b10001, 0b10001}},
+    {'I', {0b01110, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b01110}},
+    {'J', {0b00111, 0b00010, 0b00010, 0b00010, 0b00010, 0b10010, 0b01100}},
+    {'K', {0b10001, 0b10010, 0b10100, 0b11000, 0b10100, 0b10010, 0b10001}},
+    {'L', {0b10000, 0b10000, 0b10000, 0b10000, 0b10000, 0b10000, 0b11111}},
+    {'M', {0b10001, 0b11011, 0b10101, 0b10101, 0b10001, 0b10001, 0b10001}},
+    {'N', {0b10001, 0b11001, 0b10101, 0b10011, 0b10001, 0b10001, 0b10001}},
+    {'O', {0b01110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110}},
+    {'P', {0b11110, 0b10001, 0b10001, 0b11110, 0b10000, 0b10000, 0b10000}},
+    {'R', {0b11110, 0b10001, 0b10001, 0b11110, 0b10010, 0b10001, 0b10001}},
+    {'S', {0b01111, 0b10000, 0b10000, 0b01110, 0b00001, 0b00001, 0b11110}},
+    {'T', {0b11111, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100}},
+    {'U', {0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110}},
+    {'V', {0b10001, 0b10001, 0b10001, 0b10001, 0b01010, 0b01010, 0b00100}},
+    {'W', {0b10001, 0b10001, 0b10001, 0b10101, 0b10101, 0b11011, 0b10001}},
+    {'X', {0b10001, 0b01010, 0b00100, 0b00100, 0b00100, 0b01010, 0b10001}},
+    {'Y', {0b10001, 0b10001, 0b01010, 0b00100, 0b00100, 0b00100, 0b00100}},
+    {'Z', {0b11111, 0b00001, 0b00010, 0b00100, 0b01000, 0b10000, 0b11111}},
+    {'.', {0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00100}},
+    {'/', {0b00001, 0b00010, 0b00010, 0b00100, 0b00100, 0b01000, 0b10000}},
+    {'|', {0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100}},
+    {'=', {0b00000, 0b00000, 0b11111, 0b00000, 0b11111, 0b00000, 0b00000}},
+    {':', {0b00000, 0b00100, 0b00000, 0b00000, 0b00000, 0b00100, 0b00000}}
+};
+
+const uint8_t* findGlyph(char c) {
+    if (c >= '0' && c <= '9') return DIGIT_GLYPHS[c - '0'];
+    for (const LetterGlyph& glyph : LETTER_GLYPHS) {
+        if (glyph.c == c) return glyph.rows;
+    }
+    return nullptr; // Spaces and unknown characters just advance
+}
+
+} // namespace
+
+void DrawList::sprite(SDL_Texture* texture, const SDL_Rect& dst, SDL_Color mod) {
+    if (!texture) return;
+    commands.push_back({CommandType::SPRITE, SDL_BLENDMODE_BLEND, mod, texture, dst, 0, 0, 0});
+}
+
+void DrawList::quad(const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend) {
+    commands.push_back({CommandType::QUAD, blend, color, nullptr, rect, 0, 0, 0});
+}
+
+void DrawList::quadOutline(const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend) {
+    commands.push_back({CommandType::QUAD_OUTLINE, blend, color, nullptr, rect, 0, 0, 0});
+}
+
+void DrawList::line(int x1, int y1, int x2, int y2, SDL_Color color, SDL_BlendMode blend) {
+    commands.push_back({CommandType::LINE, blend, color, nullptr, {x1, y1, x2, y2}, 0, 0, 0});
+}
+
+void DrawList::text(const char* text, int x, int y, SDL_Color color, int fontSize) {
+    if (!text || text[0] == '\0') return;
+    int length = static_cast<int>(std::strlen(text));
+    int offset = static_cast<int>(textPool.size());
+    textPool.insert(textPool.end(), text, text + length + 1);
+    commands.push_back({CommandType::TEXT, SDL_BLENDMODE_BLEND, color, nullptr, {x, y, 0, 0}, offset, length, fontSize});
+}
+
+void DrawList::clip(const SDL_Rect& rect) {
+    commands.push_back({CommandType::CLIP, SDL_BLENDMODE_NONE, {0, 0, 0, 0}, nullptr, rect, 0, 0, 0});
+}
+
+void DrawList::clearClip() {
+    commands.push_back({CommandType::CLIP, SDL_BLENDMODE_NONE, {0, 0, 0, 0}, nullptr, {0, 0, 0, 0}, 0, 0, 0});
+}
+
+void DrawList::fillCircle(int centerX, int centerY, int radius, SDL_Color color) {
+    // One quad per row
+    for (int dy = -radius; dy <= radius; dy++) {
+        int halfWidth = 0;
+        while ((halfWidth + 1) * (halfWidth + 1) + dy * dy <= radius * radius) halfWidth++;
+        quad({centerX - halfWidth, centerY + dy, 2 * halfWidth + 1, 1}, color);
+    }
+}
+
+void DrawList::bitmapGlyph(const uint8_t rows[7], int x, int y, int scale, SDL_Color color) {
+    // Runs of set pixels become one quad
+    for (int row = 0; row < 7; row++) {
+        int col = 0;
+        while (col < 5) {
+            if (!(rows[row] & (1 << (4 - col)))) {
+                col++;
+                continue;
+            }
+            int start = col;
+            while (col < 5 && (rows[row] & (1 << (4 - col)))) col++;
+            quad({x + start * scale, y + row * scale, (col - start) * scale, scale}, color);
+        }
+    }
+}
+
+void DrawList::bitmapText(const char* text, int x, int y, int scale, SDL_Color color) {
+    if (!text) return;
+    int currentX = x;
+    for (const char* p = text; *p; p++) {
+        if (const uint8_t* glyph = findGlyph(*p)) {
+            bitmapGlyph(glyph, currentX, y, scale, color);
+        }
+        currentX += 6 * scale; // Move to next character position
+    }
+}
+
+void DrawList::bitmapNumber(int number, int x, int y, int scale, SDL_Color color) {
+    char numStr[12];
+    std::snprintf(numStr, sizeof(numStr), "%d", number);
+    // The minus sign has no glyph and leaves a gap, as it always has
+    bitmapText(numStr, x, y, scale, color);
+}
+
+void DrawList::clear() {
+    commands.clear();
+    textPool.clear();
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+// Screen-space draws for one frame (HUD, shop, menus), recorded by game code and
+// executed by a RenderBackend in submission order. Recording touches no SDL
+// state, so it can happen on the simulation thread; text is copied in, so
+// callers may pass temporary strings.
+class DrawList {
+public:
+    enum class CommandType : uint8_t {
+        SPRITE,
+        QUAD,
+        QUAD_OUTLINE,
+        LINE,
+        TEXT,
+        CLIP
+    };
+
+    struct Command {
+        CommandType type;
+        SDL_BlendMode blend;
+        SDL_Color color;      // Draw colour, or colour/alpha mod for sprites
+        SDL_Texture* texture;
+        SDL_Rect rect;        // Destination; LINE uses x, y to w, h; CLIP with w = 0 clears the clip
+        int textOffset;       // TEXT: range in the text pool
+        int textLength;
+        int fontSize;         // TEXT: requested size; backends may draw every size with one font
+    };
+
+    void sprite(SDL_Texture* texture, const SDL_Rect& dst, SDL_Color mod = {255, 255, 255, 255});
+    void quad(const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    void quadOutline(const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    void line(int x1, int y1, int x2, int y2, SDL_Color color, SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    // Font text, drawn by the backend; nothing is drawn without a font
+    void text(const char* text, int x, int y, SDL_Color color, int fontSize = 16);
+    // Everything after is clipped to rect, until clearClip()
+    void clip(const SDL_Rect& rect);
+    void clearClip();
+
+    // Built from quads, so they draw the same on every backend
+    void fillCircle(int centerX, int centerY, int radius, SDL_Color color);
+    // 5x7 bitmap font (digits, capitals and a little punctuation), the fallback without a TTF font
+    void bitmapText(const char* text, int x, int y, int scale = 1, SDL_Color color = {255, 255, 255, 255});
+    void bitmapNumber(int number, int x, int y, int scale = 1, SDL_Color color = {255, 255, 255, 255});
+
+    void clear();
+    bool empty() const { return commands.empty(); }
+    const std::vector<Command>& getCommands() const { return commands; }
+    // TEXT commands: the string, null-terminated
+    const char* textOf(const Command& command) const { return &textPool[command.textOffset]; }
+
+private:
+    void bitmapGlyph(const uint8_t rows[7], int x, int y, int scale, SDL_Color color);
+
+    std::vector<Command> commands;
+    std::vector<char> textPool;
+};
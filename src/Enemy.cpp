@@ -1,57 +1,30 @@
 #include "Enemy.h"
-#include <cstdlib>
-#include <iostream>
-#include <vector>
-#include <memory>
-#include "Bullet.h"
+#include "SlimeEnemy.h"
+#include "PebblinEnemy.h"
+#include "Snapshot.h"
 
-Enemy::Enemy(Vector2 pos, SDL_Renderer* renderer) 
-    : position(pos), velocity(0, 0), radius(30), speed(80), 
-      health(1), damage(10), alive(true), state(EnemyState::IDLE),
-      animationTimer(0.0f), hitTimer(0.0f), currentFrame(0),
-      idleFrame1(nullptr), idleFrame2(nullptr), hitFrame(nullptr),
-      spriteWidth(64), spriteHeight(64) {
-    loadSprites(renderer);
+Entity spawnEnemyTelegraph(World& world, Vector2 position, float duration, EnemySpawnType type) {
+    return world.create(Transform{position}, Lifetime{0.0f, duration, duration}, SpawnTelegraph{type});
 }
 
-Enemy::~Enemy() {
-    if (idleFrame1) SDL_DestroyTexture(idleFrame1);
-    if (idleFrame2) SDL_DestroyTexture(idleFrame2);
-    if (hitFrame) SDL_DestroyTexture(hitFrame);
+Enemy::Enemy(Vector2 pos, EnemyType enemyType)
+    : position(pos), velocity(0, 0), alive(true), type(enemyType), state(EnemyState::IDLE),
+      animationTimer(0.0f), hitTimer(0.0f), currentFrame(0), timeSinceLastShot(0.0f) {
+    const EnemyTypeInfo& info = getEnemyTypeInfo(enemyType);
+    speed = info.speed;
+    radius = info.radius;
+    damage = info.damage;
+    health = info.health;
+    fireCooldown = info.fireCooldown;
 }
 
-void Enemy::loadSprites(SDL_Renderer* renderer) {
-    idleFrame1 = loadTexture("monsters/landmonster/Transparent PNG/idle/frame-1.png", renderer);
-    idleFrame2 = loadTexture("monsters/landmonster/Transparent PNG/idle/frame-2.png", renderer);
-    hitFrame = loadTexture("monsters/landmonster/Transparent PNG/got hit/frame.png", renderer);
-    
-    if (!idleFrame1 || !idleFrame2 || !hitFrame) {
-        std::cout << "Warning: Could not load some monster sprites!" << std::endl;
-    }
-}
-
-SDL_Texture* Enemy::loadTexture(const char* path, SDL_Renderer* renderer) {
-    SDL_Surface* surface = IMG_Load(path);
-    if (!surface) {
-        std::cout << "Unable to load image " << path << "! SDL_image Error: " << IMG_GetError() << std::endl;
-        return nullptr;
-    }
-    
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    
-    if (!texture) {
-        std::cout << "Unable to create texture from " << path << "! SDL Error: " << SDL_GetError() << std::endl;
-    }
-    
-    return texture;
-}
-
-void Enemy::update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& /*bullets*/) {
+void Enemy::seek(Vector2 playerPos, float deltaTime) {
     Vector2 direction = (playerPos - position).normalized();
     velocity = direction * speed;
     position += velocity * deltaTime;
-    
+}
+
+void Enemy::animate(float deltaTime, float frameInterval) {
     // Update animation timing
     animationTimer += deltaTime;
     
@@ -64,48 +37,110 @@ void Enemy::update(float deltaTime, Vector2 playerPos, std::vector<std::unique_p
         }
     }
     
-    // Handle idle animation (switch frames every 0.5 seconds)
-    if (state == EnemyState::IDLE && animationTimer > 0.5f) {
+    // Handle idle animation (switch frames every frameInterval seconds)
+    if (state == EnemyState::IDLE && animationTimer > frameInterval) {
         currentFrame = (currentFrame == 0) ? 1 : 0;
         animationTimer = 0.0f;
     }
 }
 
-void Enemy::render(SDL_Renderer* renderer) {
-    if (!alive) return;
-    
-    SDL_Texture* currentTexture = nullptr;
-    
-    // Choose the right texture based on state
-    if (state == EnemyState::HIT && hitFrame) {
-        currentTexture = hitFrame;
-    } else if (state == EnemyState::IDLE) {
-        currentTexture = (currentFrame == 0 && idleFrame1) ? idleFrame1 : idleFrame2;
-    }
+bool Enemy::readyToFire(float deltaTime) {
+    timeSinceLastShot += deltaTime;
+    if (timeSinceLastShot < fireCooldown) return false;
+    timeSinceLastShot = 0.0f;
+    return true;
+}
+
+void Enemy::renderSprite(RenderQueue& queue, RenderLayer layer, const Viewport& view, SDL_Texture* texture, int w, int h,
+                         SDL_Color fallback) const {
+    const float extent = texture ? std::max(w, h) * 0.5f : radius;
+    if (!view.contains(position, extent)) return;
     
-    // If we have a texture, render it; otherwise fall back to circle
-    if (currentTexture) {
+    if (texture) {
         SDL_Rect destRect = {
-            (int)(position.x - spriteWidth/2),
-            (int)(position.y - spriteHeight/2),
-            spriteWidth,
-            spriteHeight
+            (int)(position.x - w/2),
+            (int)(position.y - h/2),
+            w,
+            h
         };
-        SDL_RenderCopy(renderer, currentTexture, nullptr, &destRect);
-    } else {
-        // Fallback to original circle rendering
-        SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
-        
-        int centerX = (int)position.x;
-        int centerY = (int)position.y;
-        int r = (int)radius;
-        
-        for (int x = -r; x <= r; x++) {
-            for (int y = -r; y <= r; y++) {
-                if (x*x + y*y <= r*r) {
-                    SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-                }
-            }
+        queue.sprite(layer, 0, texture, destRect);
+        return;
+    }
+    
+    // Fallback circle while the texture is loading (or failed to)
+    queue.fillCircle(layer, 0, (int)position.x, (int)position.y, (int)radius, fallback);
+}
+
+void EnemyBatches::loadSprites(AssetLoader& assets) {
+    idleFrame1 = assets.requestTexture("monsters/landmonster/Transparent PNG/idle/frame-1.png");
+    idleFrame2 = assets.requestTexture("monsters/landmonster/Transparent PNG/idle/frame-2.png");
+    hitFrame = assets.requestTexture("monsters/landmonster/Transparent PNG/got hit/frame.png");
+    slimeTexture = assets.requestTexture("assets/enemies/slime.png");
+    pebblinTexture = assets.requestTexture("assets/enemies/pebblin.png");
+}
+
+Enemy& EnemyBatches::spawn(EnemyType type, Vector2 pos) {
+    std::vector<Enemy>& enemies = batch(type);
+    enemies.emplace_back(pos, type);
+    return enemies.back();
+}
+
+void EnemyBatches::update(float deltaTime, Vector2 playerPos, World& world) {
+    const float baseFrameInterval = getEnemyTypeInfo(EnemyType::BASE).frameInterval;
+    for (Enemy& enemy : batch(EnemyType::BASE)) {
+        enemy.seek(playerPos, deltaTime);
+        enemy.animate(deltaTime, baseFrameInterval);
+    }
+    updateSlimes(batch(EnemyType::SLIME), deltaTime, playerPos, world);
+    updatePebblins(batch(EnemyType::PEBBLIN), deltaTime, playerPos, world);
+}
+
+void EnemyBatches::render(RenderQueue& queue, const Viewport& view) const {
+    // Land monsters flip between two idle frames and flash a hit frame
+    SDL_Texture* idle[2] = { idleFrame1.get(), idleFrame2.get() };
+    SDL_Texture* hit = hitFrame.get();
+    for (const Enemy& enemy : batch(EnemyType::BASE)) {
+        if (!enemy.alive) continue;
+        SDL_Texture* texture = nullptr;
+        if (enemy.state == EnemyState::HIT && hit) {
+            texture = hit;
+        } else if (enemy.state == EnemyState::IDLE) {
+            texture = (enemy.currentFrame == 0 && idle[0]) ? idle[0] : idle[1];
         }
+        enemy.renderSprite(queue, RenderLayer::ENEMIES, view, texture, 64, 64, {255, 50, 50, 255});
+    }
+    renderSlimes(batch(EnemyType::SLIME), queue, view, slimeTexture);
+    renderPebblins(batch(EnemyType::PEBBLIN), queue, view, pebblinTexture);
+}
+
+void EnemyBatches::clear() {
+    for (auto& enemies : batches) {
+        enemies.clear();
     }
-}
\ No newline at end of file
+}
+
+static_assert(std::is_trivially_copyable<Enemy>::value, "Enemy snapshots are raw copies");
+
+void EnemyBatches::save(SnapshotWriter& out) const {
+    for (const auto& enemies : batches) {
+        out.writeVector(enemies);
+    }
+}
+
+void EnemyBatches::load(SnapshotReader& in) {
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        // Enemy has no default constructor; make the slots, then overwrite them
+        std::vector<Enemy>& enemies = batches[type];
+        uint32_t count = in.readCount(1u << 20);
+        enemies.assign(count, Enemy(Vector2(), static_cast<EnemyType>(type)));
+        in.readBytes(enemies.data(), sizeof(Enemy) * count);
+    }
+}
+
+size_t EnemyBatches::size() const {
+    size_t total = 0;
+    for (const auto& enemies : batches) {
+        total += enemies.size();
+    }
+    return total;
+}
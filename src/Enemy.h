@@ -1,9 +1,17 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_image.h>
+#include <array>
 #include <vector>
-#include <memory>
+#include <algorithm>
 #include "Vector2.h"
+#include "AssetLoader.h"
+#include "World.h"
+#include "RenderScaler.h"
+#include "RenderQueue.h"
+#include "DefsFormat.h"
+
+class SnapshotWriter;
+class SnapshotReader;
 
 enum class EnemyState {
     IDLE,
@@ -16,32 +24,42 @@ enum class EnemyType {
     PEBBLIN
 };
 
-class Bullet;
+static const int ENEMY_TYPE_COUNT = 3;
+
+// Per-type tuning (EnemyTypeInfo) comes from data/enemies.def; defined in Definitions.cpp
+const EnemyTypeInfo& getEnemyTypeInfo(EnemyType type);
 
+// Flashing X that turns into an enemy of `type` after `duration` seconds (see Game::updateSpawnIndicators)
+Entity spawnEnemyTelegraph(World& world, Vector2 position, float duration, EnemySpawnType type);
+
+// Plain value type: enemies are stored by value in per-type arrays (EnemyBatches)
+// and updated/rendered one type at a time, so nothing here is virtual.
 class Enemy {
 public:
-    Enemy(Vector2 pos, SDL_Renderer* renderer);
-    virtual ~Enemy();
-    
-    virtual void update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
-    virtual void render(SDL_Renderer* renderer);
-    
+    Enemy(Vector2 pos, EnemyType type = EnemyType::BASE);
+
     Vector2 getPosition() const { return position; }
     float getRadius() const { return radius; }
     bool isAlive() const { return alive; }
     void destroy() { alive = false; }
-    void hit() { 
-        state = EnemyState::HIT; 
-        hitTimer = 0.0f; 
+    void hit() {
+        state = EnemyState::HIT;
+        hitTimer = 0.0f;
     }
-    
+
     int getDamage() const { return damage; }
-    virtual EnemyType getEnemyType() const { return EnemyType::BASE; }
-    
-private:
-    void loadSprites(SDL_Renderer* renderer);
-    SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer);
-    
+    EnemyType getEnemyType() const { return type; }
+
+    // Shared behaviour used by every batch (and the boss)
+    void seek(Vector2 playerPos, float deltaTime);
+    void animate(float deltaTime, float frameInterval);
+    // Advances the shot timer; true when the enemy should fire this frame
+    bool readyToFire(float deltaTime);
+    // Queues `texture` centred at w x h, or a fallback disc in `fallback` while it isn't loaded.
+    // Nothing is queued when the sprite is outside `view`.
+    void renderSprite(RenderQueue& queue, RenderLayer layer, const Viewport& view, SDL_Texture* texture, int w, int h,
+                      SDL_Color fallback) const;
+
 protected:
     Vector2 position;
     Vector2 velocity;
@@ -50,17 +68,70 @@ protected:
     int health;
     int damage;
     bool alive;
-    
-    // Animation and sprites
+    EnemyType type;
+
+    // Animation state
     EnemyState state;
     float animationTimer;
     float hitTimer;
     int currentFrame;
-    
-    SDL_Texture* idleFrame1;
-    SDL_Texture* idleFrame2;
-    SDL_Texture* hitFrame;
-    
-    int spriteWidth;
-    int spriteHeight;
-};
\ No newline at end of file
+
+    // Ranged attack state (slimes, pebblins)
+    float fireCooldown;
+    float timeSinceLastShot;
+
+    friend class EnemyBatches;
+};
+
+// All regular enemies, one contiguous array per EnemyType. Each array is
+// updated and rendered by its own loop, so there is no per-enemy virtual call
+// and the sprite textures are held once per type instead of once per enemy.
+class EnemyBatches {
+public:
+    // Cached by the loader; safe to call before the textures are ready
+    void loadSprites(AssetLoader& assets);
+
+    Enemy& spawn(EnemyType type, Vector2 pos);
+    void update(float deltaTime, Vector2 playerPos, World& world);
+    void render(RenderQueue& queue, const Viewport& view) const;
+    void clear();
+    size_t size() const;
+
+    // Snapshot section (Snapshot.h); enemies are plain values, so each batch is one block
+    void save(SnapshotWriter& out) const;
+    void load(SnapshotReader& in);
+
+    template<typename Fn>
+    void forEach(Fn&& fn) {
+        for (auto& batch : batches) {
+            for (Enemy& enemy : batch) {
+                fn(enemy);
+            }
+        }
+    }
+
+    // Calls onDeath for each dead enemy, then compacts the arrays
+    template<typename Fn>
+    void removeDead(Fn&& onDeath) {
+        for (auto& batch : batches) {
+            batch.erase(std::remove_if(batch.begin(), batch.end(), [&](const Enemy& enemy) {
+                if (enemy.isAlive()) return false;
+                onDeath(enemy);
+                return true;
+            }), batch.end());
+        }
+    }
+
+private:
+    std::vector<Enemy>& batch(EnemyType type) { return batches[static_cast<int>(type)]; }
+    const std::vector<Enemy>& batch(EnemyType type) const { return batches[static_cast<int>(type)]; }
+
+    std::array<std::vector<Enemy>, ENEMY_TYPE_COUNT> batches;
+
+    // Shared, cached textures; null until the loader has uploaded them
+    TextureHandle idleFrame1;
+    TextureHandle idleFrame2;
+    TextureHandle hitFrame;
+    TextureHandle slimeTexture;
+    TextureHandle pebblinTexture;
+};
@@ -1,71 +1,38 @@
 #include "ExperienceOrb.h"
+#include "Systems.h"
 #include <cmath>
 
-ExperienceOrb::ExperienceOrb(Vector2 pos, int expValue) 
-    : position(pos), radius(8), experienceValue(expValue), alive(true),
-      lifetime(0), maxLifetime(30.0f), bobOffset(0), bobSpeed(3.0f) {
+Entity spawnExperienceOrb(World& world, Vector2 pos, int expValue) {
+    const float maxLifetime = 30.0f;
+    // Fades out over the last 20% of its lifetime
+    return world.create(Transform{pos}, Collider{8.0f}, Lifetime{0.0f, maxLifetime, maxLifetime * 0.8f},
+                        Bob{0.0f, 3.0f, 2.0f}, Pickup{PickupKind::EXPERIENCE_ORB, expValue, 0});
 }
 
-void ExperienceOrb::update(float deltaTime) {
-    lifetime += deltaTime;
-    bobOffset += bobSpeed * deltaTime;
-    
-    // Remove orb after max lifetime
-    if (lifetime > maxLifetime) {
-        alive = false;
-    }
+void renderExperienceOrbs(World& world, RenderQueue& queue, const Viewport& view, bool bobbing) {
+    world.each<Transform, Collider, Lifetime, Bob, Pickup>([&queue, &view, bobbing](Entity, Transform& transform, Collider& collider,
+                                                                      Lifetime& lifetime, Bob& bob, Pickup& pickup) {
+        if (pickup.kind != PickupKind::EXPERIENCE_ORB) return;
+        // Glow ring plus bob height around the collider
+        if (!view.contains(transform.position, collider.radius + 2.0f + bob.amplitude)) return;
+        
+        // Calculate bobbing effect
+        float bobY = bobbing ? sin(bob.phase) * bob.amplitude : 0.0f;
+        
+        // Render experience orb as a glowing circle
+        int alpha = (int)(255 * lifetime.fade());
+        
+        int centerX = (int)transform.position.x;
+        int centerY = (int)(transform.position.y + bobY);
+        int r = (int)collider.radius;
+        
+        // Draw outer glow
+        queue.ring(RenderLayer::PICKUPS, 0, centerX, centerY, r, r + 2, {100, 255, 100, (Uint8)(alpha * 0.3f)});
+        
+        // Draw main orb
+        queue.fillCircle(RenderLayer::PICKUPS, 1, centerX, centerY, r, {150, 255, 150, (Uint8)alpha});
+        
+        // Draw bright center
+        queue.fillCircle(RenderLayer::PICKUPS, 2, centerX, centerY, r/2, {255, 255, 255, (Uint8)alpha});
+    });
 }
-
-void ExperienceOrb::render(SDL_Renderer* renderer) {
-    if (!alive) return;
-    
-    // Calculate bobbing effect
-    float bob = sin(bobOffset) * 2.0f;
-    Vector2 renderPos = Vector2(position.x, position.y + bob);
-    
-    // Calculate fade effect based on lifetime
-    float fadeRatio = 1.0f;
-    if (lifetime > maxLifetime * 0.8f) {
-        fadeRatio = 1.0f - ((lifetime - maxLifetime * 0.8f) / (maxLifetime * 0.2f));
-    }
-    
-    // Render experience orb as a glowing circle
-    int alpha = (int)(255 * fadeRatio);
-    SDL_SetRenderDrawColor(renderer, 100, 255, 100, alpha); // Green glow
-    
-    int centerX = (int)renderPos.x;
-    int centerY = (int)renderPos.y;
-    int r = (int)radius;
-    
-    // Draw outer glow
-    for (int x = -r-2; x <= r+2; x++) {
-        for (int y = -r-2; y <= r+2; y++) {
-            float distance = sqrt(x*x + y*y);
-            if (distance <= r + 2 && distance > r) {
-                int glowAlpha = (int)(alpha * 0.3f);
-                SDL_SetRenderDrawColor(renderer, 100, 255, 100, glowAlpha);
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-    
-    // Draw main orb
-    SDL_SetRenderDrawColor(renderer, 150, 255, 150, alpha);
-    for (int x = -r; x <= r; x++) {
-        for (int y = -r; y <= r; y++) {
-            if (x*x + y*y <= r*r) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-    
-    // Draw bright center
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, alpha);
-    for (int x = -r/2; x <= r/2; x++) {
-        for (int y = -r/2; y <= r/2; y++) {
-            if (x*x + y*y <= (r/2)*(r/2)) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-} 
\ No newline at end of file
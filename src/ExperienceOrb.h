@@ -1,27 +1,12 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include "Vector2.h"
+#include "World.h"
+#include "RenderScaler.h"
+#include "RenderQueue.h"
 
-class ExperienceOrb {
-public:
-    ExperienceOrb(Vector2 pos, int expValue = 1);
-    
-    void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    
-    Vector2 getPosition() const { return position; }
-    float getRadius() const { return radius; }
-    int getExperienceValue() const { return experienceValue; }
-    bool isAlive() const { return alive; }
-    void collect() { alive = false; }
-    
-private:
-    Vector2 position;
-    float radius;
-    int experienceValue;
-    bool alive;
-    float lifetime;
-    float maxLifetime;
-    float bobOffset;
-    float bobSpeed;
-}; 
\ No newline at end of file
+// Experience orbs are World entities: Transform + Collider + Lifetime + Bob + Pickup
+Entity spawnExperienceOrb(World& world, Vector2 pos, int expValue = 1);
+
+// bobbing = false draws pickups at rest (low quality tiers)
+void renderExperienceOrbs(World& world, RenderQueue& queue, const Viewport& view, bool bobbing = true);
@@ -0,0 +1,118 @@
+#include "FramePacer.h"
+#include "Log.h"
+#include <algorithm>
+#include <cmath>
+
+const char* FramePacer::modeName(PacingMode pacing) {
+    switch (pacing) {
+        case PacingMode::VSYNC: return "vsync";
+        case PacingMode::TARGET_FPS: return "target";
+        case PacingMode::UNCAPPED: return "uncapped";
+    }
+    return "?";
+}
+
+void FramePacer::start(PacingMode pacing, int fps, int displayHz) {
+    frequency = SDL_GetPerformanceFrequency();
+    targetFps = std::max(1, fps);
+    refreshHz = displayHz;
+    period = frequency / static_cast<Uint64>(targetFps);
+    setMode(pacing);
+}
+
+void FramePacer::setMode(PacingMode pacing) {
+    mode = pacing;
+    // The interval across a mode switch belongs to neither mode
+    lastFrameEnd = 0;
+    scheduled = 0;
+}
+
+float FramePacer::periodMs() const {
+    switch (mode) {
+        case PacingMode::VSYNC: return refreshHz > 0 ? 1000.0f / refreshHz : 0.0f;
+        case PacingMode::TARGET_FPS: return 1000.0f / targetFps;
+        case PacingMode::UNCAPPED: return 0.0f;
+    }
+    return 0.0f;
+}
+
+void FramePacer::endFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (mode == PacingMode::TARGET_FPS) {
+        Uint64 deadline = scheduled + period;
+        if (scheduled == 0 || now > deadline + period) {
+            // First frame, or too far behind to catch up: start a new schedule from now
+            scheduled = now;
+        } else {
+            waitUntil(deadline);
+            scheduled = deadline;
+        }
+        now = SDL_GetPerformanceCounter();
+    }
+
+    if (lastFrameEnd != 0) {
+        float intervalMs = static_cast<float>((now - lastFrameEnd) * 1000.0 / frequency);
+        ModeStats& s = stats[static_cast<int>(mode)];
+        s.minMs = s.frames == 0 ? intervalMs : std::min(s.minMs, intervalMs);
+        s.maxMs = std::max(s.maxMs, intervalMs);
+        s.frames++;
+        s.totalMs += intervalMs;
+        s.totalSquaredMs += static_cast<double>(intervalMs) * intervalMs;
+        float expectedMs = periodMs();
+        if (expectedMs > 0.0f && intervalMs > expectedMs * 1.5f) {
+            s.lateFrames++;
+        }
+        s.histogram[std::min(HISTOGRAM_BINS - 1, static_cast<int>(intervalMs * 10.0f))]++;
+    }
+    lastFrameEnd = now;
+}
+
+void FramePacer::waitUntil(Uint64 deadline) {
+    while (true) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now >= deadline) return;
+        float remainingMs = static_cast<float>((deadline - now) * 1000.0 / frequency);
+        if (remainingMs <= spinMarginMs) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+
+        Uint32 sleepMs = static_cast<Uint32>(remainingMs - spinMarginMs);
+        if (sleepMs == 0) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        SDL_Delay(sleepMs);
+
+        // Track how far past the request the OS woke us: jump up to cover the
+        // worst oversleep, drift back down while sleeps stay accurate
+        float sleptMs = static_cast<float>((SDL_GetPerformanceCounter() - now) * 1000.0 / frequency);
+        float oversleepMs = sleptMs - static_cast<float>(sleepMs);
+        float wanted = oversleepMs + 0.25f;
+        spinMarginMs = wanted > spinMarginMs ? wanted : spinMarginMs + (wanted - spinMarginMs) * 0.05f;
+        spinMarginMs = std::clamp(spinMarginMs, MIN_SPIN_MARGIN_MS, MAX_SPIN_MARGIN_MS);
+    }
+}
+
+float FramePacer::ModeStats::percentile(double fraction) const {
+    uint64_t target = static_cast<uint64_t>(std::ceil(frames * fraction));
+    uint64_t seen = 0;
+    for (int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+        seen += histogram[bin];
+        if (seen >= target) return std::min(maxMs, (bin + 1) * 0.1f);
+    }
+    return maxMs;
+}
+
+void FramePacer::logSummary() const {
+    for (int m = 0; m < MODE_COUNT; m++) {
+        const ModeStats& s = stats[m];
+        if (s.frames == 0) continue;
+        double meanMs = s.totalMs / s.frames;
+        double jitterMs = std::sqrt(std::max(0.0, s.totalSquaredMs / s.frames - meanMs * meanMs));
+        LOG_INFO(RENDER, "Pacing %s: %llu frames, %.2f ms mean (%.1f fps), min %.2f p50 %.1f p99 %.1f max %.2f ms, jitter %.2f ms, %llu late",
+                 modeName(static_cast<PacingMode>(m)), static_cast<unsigned long long>(s.frames), meanMs,
+                 meanMs > 0.0 ? 1000.0 / meanMs : 0.0, s.minMs, s.percentile(0.5), s.percentile(0.99), s.maxMs,
+                 jitterMs, static_cast<unsigned long long>(s.lateFrames));
+    }
+}
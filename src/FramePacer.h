@@ -0,0 +1,68 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+
+enum class PacingMode : uint8_t {
+    VSYNC,          // Present waits for the display (SDL_RENDERER_PRESENTVSYNC)
+    TARGET_FPS,     // Sleep, then spin, to a fixed frame rate
+    UNCAPPED        // No waiting at all, for benchmarks
+};
+
+// Paces the main loop on the performance counter and keeps frame-interval
+// statistics for every mode used during the run (F8 cycles modes in game).
+//
+// TARGET_FPS sleeps in whole milliseconds until it's within a spin margin of
+// the deadline, then spins on the counter. The margin follows the worst
+// oversleep seen recently, so it stays small where the OS timer is precise.
+// Deadlines advance by exactly one period, so a slightly late frame is made up
+// on the next one; a frame more than a period late restarts the schedule
+// instead of rushing several frames out back to back.
+class FramePacer {
+public:
+    static const int MODE_COUNT = 3;
+
+    // refreshHz is the display's, for counting late frames under vsync (0 = unknown)
+    void start(PacingMode mode, int targetFps, int refreshHz);
+    void setMode(PacingMode mode);
+    PacingMode getMode() const { return mode; }
+
+    // Once per frame, after present: waits out the rest of the frame in
+    // TARGET_FPS mode, then records the interval since the previous call
+    void endFrame();
+
+    void logSummary() const;
+    static const char* modeName(PacingMode mode);
+
+private:
+    // Intervals in 0.1 ms bins; the last bin collects everything above
+    static const int HISTOGRAM_BINS = 1001;
+
+    struct ModeStats {
+        uint64_t frames = 0;
+        double totalMs = 0.0;
+        double totalSquaredMs = 0.0;
+        float minMs = 0.0f;
+        float maxMs = 0.0f;
+        uint64_t lateFrames = 0;    // Longer than 1.5 periods
+        uint32_t histogram[HISTOGRAM_BINS] = {};
+
+        float percentile(double fraction) const;
+    };
+
+    void waitUntil(Uint64 deadline);
+    float periodMs() const;
+
+    PacingMode mode = PacingMode::VSYNC;
+    int targetFps = 60;
+    int refreshHz = 0;
+    Uint64 frequency = 0;
+    Uint64 period = 0;          // TARGET_FPS, in counter ticks
+    Uint64 scheduled = 0;       // When the previous frame was due to end
+    Uint64 lastFrameEnd = 0;
+    float spinMarginMs = 2.0f;
+
+    ModeStats stats[MODE_COUNT];
+
+    static constexpr float MIN_SPIN_MARGIN_MS = 0.5f;
+    static constexpr float MAX_SPIN_MARGIN_MS = 4.0f;
+};
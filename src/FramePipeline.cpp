@@ -0,0 +1,72 @@
+#include "FramePipeline.h"
+
+FramePipeline::~FramePipeline() {
+    stop();
+}
+
+void FramePipeline::start(Producer frameProducer) {
+    if (worker.joinable()) return;
+    producer = std::move(frameProducer);
+    stopping = false;
+    busy = false;
+    finished = false;
+    worker = std::thread(&FramePipeline::workerLoop, this);
+}
+
+void FramePipeline::stop() {
+    if (!worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+    finished = false;
+}
+
+void FramePipeline::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return !busy; });
+}
+
+RenderFrame* FramePipeline::takeFinished() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (busy || !finished) return nullptr;
+    finished = false;
+    return &frames[1 - recordIndex];
+}
+
+void FramePipeline::submit(const FrameInput& input) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (busy) return;
+        pendingInput = input;
+        // A frame that was never taken is simply recorded over
+        finished = false;
+        busy = true;
+    }
+    wake.notify_one();
+}
+
+void FramePipeline::workerLoop() {
+    for (;;) {
+        int index;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || busy; });
+            if (stopping) return;
+            index = recordIndex;
+        }
+
+        // The render thread leaves pendingInput and frames[index] alone while busy
+        producer(pendingInput, frames[index]);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            recordIndex = 1 - index;
+            finished = true;
+            busy = false;
+        }
+        idle.notify_one();
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "RenderFrame.h"
+
+// Runs the simulation one frame ahead of rendering on its own thread, so a frame
+// costs max(simulate, render) instead of their sum.
+//
+// The render thread (the main thread: SDL wants window events and renderer calls
+// on the thread that created them) and the simulation thread meet once per frame:
+//
+//   render:     poll input | waitIdle | sync work | submit(input) | draw frame N    | poll input | waitIdle ...
+//   simulation:            ...record N |   parked  |  input, update, record N+1    |
+//
+// Between waitIdle() and submit() the simulation is parked, which is the only time
+// the render thread may touch game state (texture uploads, deferred asset requests).
+// Frames are double buffered: the simulation records into one RenderFrame
+// while the render thread draws the other, so there is never more than one frame
+// in flight and input is at most one frame old.
+class FramePipeline {
+public:
+    using Producer = std::function<void(const FrameInput& input, RenderFrame& frame)>;
+
+    FramePipeline() = default;
+    ~FramePipeline();
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    void start(Producer producer);
+    void stop();
+    bool isRunning() const { return worker.joinable(); }
+
+    // Render thread: blocks until the frame in flight (if any) is recorded
+    void waitIdle();
+    // The frame recorded since the last submit(), or null. Stays valid until the
+    // submit() after next; requires waitIdle()
+    RenderFrame* takeFinished();
+    // Starts recording the next frame into the buffer not handed out last
+    void submit(const FrameInput& input);
+
+private:
+    void workerLoop();
+
+    Producer producer;
+    RenderFrame frames[2];
+    int recordIndex = 0;       // Buffer the next submit() records into
+    FrameInput pendingInput;
+    bool busy = false;         // A frame is being recorded
+    bool finished = false;     // frames[1 - recordIndex] holds a frame nobody has taken
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::thread worker;
+};
@@ -1,15 +1,20 @@
 #include "Game.h"
-#include "SlimeEnemy.h"
-#include "PebblinEnemy.h"
 #include "BossEnemy.h"
+#include "Systems.h"
+#include "Log.h"
+#include "Random.h"
+#include "Snapshot.h"
+#include "Definitions.h"
+#include "SdlRenderBackend.h"
+#include "SoftwareRenderBackend.h"
 #include <cmath>
-#include <iostream>
 #include <random>
 #include <algorithm>
 #include <SDL2/SDL_image.h>
 #include <sstream>
 #include <iomanip>
 #include <cstdio> // Add for sprintf
+#include <cstring>
 #include <string>
 #include <map>
 #define _USE_MATH_DEFINES
@@ -20,10 +25,18 @@ const float Game::WAVE_COMPLETED_DURATION = 2.0f;
 const float Game::SHOP_CLOSING_DURATION = 0.2f;  // Reduced from 1.0f
 const float Game::WAVE_STARTING_DURATION = 0.8f;  // Reduced from 2.0f
 
-Game::Game() : window(nullptr), renderer(nullptr), running(false), 
+// Width of a number in the bitmap font, in glyphs
+static int countDigits(int number) {
+    int digits = number < 0 ? 2 : 1;
+    for (int n = number < 0 ? -number : number; n >= 10; n /= 10) digits++;
+    return digits;
+}
+
+Game::Game(const GameOptions& gameOptions) : window(nullptr), renderer(nullptr), running(false), options(gameOptions),
+               
                timeSinceLastSpawn(0), score(0), wave(1), mousePos(0, 0),
-               waveTimer(0), waveDuration(20.0f), waveActive(true), materialBag(0),
-               defaultFont(nullptr), starTexture(nullptr), fKeyPressed(false), rKeyPressed(false), shopJustClosed(false), gameOverShown(false),
+               waveTimer(0), waveDuration(Balance::FIRST_WAVE_DURATION), waveActive(true), materialBag(0),
+               defaultFont(nullptr), fKeyPressed(false), rKeyPressed(false), shopJustClosed(false), gameOverShown(false),
                currentState(GameState::WAVE_ACTIVE), stateTimer(0.0f), stateDuration(0.0f) {
 }
 
@@ -32,52 +45,135 @@ Game::~Game() {
 }
 
 bool Game::init() {
+    ScopedStartupPhase initPhase(startupTimeline, "Game::init");
+    
+    // Weapon, enemy and item stats; everything below may look them up
+    startupTimeline.beginPhase("Load definitions");
+    if (!Defs::load()) {
+        return false;
+    }
+    startupTimeline.endPhase();
+    
+    startupTimeline.beginPhase("SDL_Init");
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-        std::cout << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
+        LOG_ERROR(CORE, "SDL could not initialize! SDL_Error: %s", SDL_GetError());
         return false;
     }
+    startupTimeline.endPhase();
     
     // Initialize SDL_image
+    startupTimeline.beginPhase("IMG_Init");
     int imgFlags = IMG_INIT_PNG;
     if (!(IMG_Init(imgFlags) & imgFlags)) {
-        std::cout << "SDL_image could not initialize! SDL_image Error: " << IMG_GetError() << std::endl;
+        LOG_ERROR(CORE, "SDL_image could not initialize! SDL_image Error: %s", IMG_GetError());
         return false;
     }
+    startupTimeline.endPhase();
     
     // Initialize SDL_ttf
+    startupTimeline.beginPhase("TTF_Init");
     if (TTF_Init() == -1) {
-        std::cout << "SDL_ttf could not initialize! SDL_ttf Error: " << TTF_GetError() << std::endl;
+        LOG_ERROR(CORE, "SDL_ttf could not initialize! SDL_ttf Error: %s", TTF_GetError());
         return false;
     }
+    startupTimeline.endPhase();
     
+    startupTimeline.beginPhase("Create window");
+    // Headless runs still need a renderer for texture uploads, just not a visible window
+    Uint32 windowFlags = options.renderBackend != RenderBackendType::SDL
+        ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN | SDL_WINDOW_FULLSCREEN_DESKTOP;
     window = SDL_CreateWindow("Brotato MVP", 
                              SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
-                             WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_SHOWN | SDL_WINDOW_FULLSCREEN_DESKTOP);
+                             WINDOW_WIDTH, WINDOW_HEIGHT, windowFlags);
     if (window == nullptr) {
-        std::cout << "Window could not be created! SDL_Error: " << SDL_GetError() << std::endl;
+        LOG_ERROR(CORE, "Window could not be created! SDL_Error: %s", SDL_GetError());
         return false;
     }
+    startupTimeline.endPhase();
     
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    startupTimeline.beginPhase("Create renderer");
+    // The software backend only uses the renderer for uploads, so it mustn't need a GPU
+    Uint32 rendererFlags = options.renderBackend == RenderBackendType::SOFTWARE
+        ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+    // Nothing reaches the display without the SDL backend, so there's no vsync to wait for
+    if (options.pacing == PacingMode::VSYNC && options.renderBackend != RenderBackendType::SDL) {
+        options.pacing = PacingMode::TARGET_FPS;
+    }
+    if (options.pacing == PacingMode::VSYNC) {
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer = SDL_CreateRenderer(window, -1, rendererFlags);
     if (renderer == nullptr) {
-        std::cout << "Renderer could not be created! SDL_Error: " << SDL_GetError() << std::endl;
+        LOG_ERROR(CORE, "Renderer could not be created! SDL_Error: %s", SDL_GetError());
         return false;
     }
     
-    player = std::make_unique<Player>(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+    SDL_RendererInfo rendererInfo;
+    if (options.pacing == PacingMode::VSYNC &&
+        (SDL_GetRendererInfo(renderer, &rendererInfo) != 0 || !(rendererInfo.flags & SDL_RENDERER_PRESENTVSYNC))) {
+        LOG_WARN(RENDER, "Renderer has no vsync - pacing to %d fps instead", options.targetFps);
+        options.pacing = PacingMode::TARGET_FPS;
+    }
+    SDL_DisplayMode displayMode;
+    int refreshHz = SDL_GetWindowDisplayMode(window, &displayMode) == 0 ? displayMode.refresh_rate : 0;
+    framePacer.start(options.pacing, options.targetFps, refreshHz);
+    LOG_INFO(RENDER, "Frame pacing: %s (target %d fps, display %d Hz)", FramePacer::modeName(options.pacing),
+             options.targetFps, refreshHz);
     
-    // Initialize player with renderer for sprite loading
-    player->initialize(renderer);
+    // World renders at the configured internal resolution; UI stays at native resolution
+    if (!renderScaler.init(renderer, options.renderScale)) {
+        return false;
+    }
+    // An adaptive quality governor owns the internal resolution, so the scaler's
+    // own controller only runs with a fixed quality tier
+    if (options.qualityTier >= 0) {
+        qualityGovernor.lockTier(options.qualityTier);
+    }
+    qualityGovernor.configure(options.frameBudgetMs, options.simulationThread);
+    if (options.dynamicResolution && qualityGovernor.isAdaptive()) {
+        LOG_INFO(RENDER, "Adaptive quality manages resolution; --dynamic-resolution applies with a fixed --quality");
+    }
+    renderScaler.enableDynamicResolution(options.dynamicResolution && !qualityGovernor.isAdaptive(), options.frameBudgetMs);
+    startupTimeline.endPhase();
     
-    // Initialize player weapons with renderer for sprite loading
-    player->initializeWeapons(renderer);
+    // Textures decode in the background; the game loop uploads them a few per frame
+    // and entities draw their fallback shapes until then
+    startupTimeline.beginPhase("Asset loader start");
+    if (!options.assetPack.empty() && !assets.mountPack(options.assetPack)) {
+        LOG_INFO(ASSETS, "No asset pack at %s - loading loose files", options.assetPack.c_str());
+    }
+    assets.setKeepPixels(options.renderBackend == RenderBackendType::SOFTWARE);
+    assets.start(renderer);
+    startupTimeline.endPhase();
+    
+    // Only what the first frame shows is requested here; everything else waits
+    // for requestDeferredAssets() once that frame is on screen
+    startupTimeline.beginPhase("Player init");
+    player = std::make_unique<Player>(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+    player->initialize(assets);
+    player->initializeWeapons(assets);
+    startupTimeline.endPhase();
     
-    shop = std::make_unique<Shop>();
+    shop = std::make_unique<Shop>(waveArena, frameArena);
     shop->setGame(this);
-    shop->loadAssets(renderer);
     
     menu = std::make_unique<Menu>();
     menu->setGame(this);
+    applyQuality();
+    
+    if (options.autopilot) {
+        autopilot = std::make_unique<Autopilot>();
+        LOG_INFO(CORE, "Autopilot playing %d waves at %dx speed", options.autopilotWaves, options.timeScale);
+    }
+    
+    // Rewind history and live particles; a rewind budget of 0 turns recording off
+    history.setBudget(static_cast<size_t>(options.rewindBudgetMb) * 1024 * 1024);
+    particleBudget.setLimit(options.particleBudget);
+    
+    // Every gameplay roll comes from these streams, so a seed pins down the whole run
+    uint64_t seed = options.seed != 0 ? options.seed : std::random_device{}();
+    Random::seedAll(seed);
+    LOG_INFO(CORE, "Random seed: %llu", static_cast<unsigned long long>(seed));
     
     // Try to load fonts in order of preference
     const char* fontPaths[] = {
@@ -87,38 +183,59 @@ bool Game::init() {
         "C:/Windows/Fonts/consola.ttf"
     };
     
+    startupTimeline.beginPhase("Font probing");
     defaultFont = nullptr;
     for (const char* fontPath : fontPaths) {
-        defaultFont = TTF_OpenFont(fontPath, 16);
+        ScopedStartupPhase fontPhase(startupTimeline, fontPath);
+        defaultFont = assets.openFont(fontPath, 16);
         if (defaultFont) {
-            std::cout << "Loaded font: " << fontPath << std::endl;
+            LOG_INFO(CORE, "Loaded font: %s", fontPath);
             break;
         }
     }
+    startupTimeline.endPhase();
     
     if (!defaultFont) {
-        std::cout << "No TTF font available - using bitmap fallback" << std::endl;
+        LOG_WARN(CORE, "No TTF font available - using bitmap fallback");
         // Continue without TTF font - will fall back to bitmap rendering
     }
     
-    // Load particle star texture
-    starTexture = IMG_LoadTexture(renderer, "assets/particles/star.png");
-    if (!starTexture) {
-        std::cout << "Failed to load star texture: " << IMG_GetError() << std::endl;
-        std::cout << "Particle effects will be disabled" << std::endl;
-        // Continue without particles (graceful degradation)
+    if (options.renderBackend == RenderBackendType::NONE) {
+        renderBackend = std::make_unique<NullRenderBackend>();
+    } else if (options.renderBackend == RenderBackendType::SOFTWARE) {
+        auto software = std::make_unique<SoftwareRenderBackend>(WINDOW_WIDTH, WINDOW_HEIGHT, assets, defaultFont);
+        if (!options.saveFramesPath.empty()) {
+            software->saveFrames(options.saveFramesPath, options.saveFramesInterval);
+        }
+        renderBackend = std::move(software);
     } else {
-        std::cout << "Loaded particle star texture" << std::endl;
+        renderBackend = std::make_unique<SdlRenderBackend>(renderer, renderScaler, defaultFont);
     }
-    
-    // Load item icons for UI reuse
-    texHealingBox = IMG_LoadTexture(renderer, "assets/items/healing_box.png");
-    texMassBomb = IMG_LoadTexture(renderer, "assets/items/mass_bomb.png");
-    if (!texHealingBox) {
-        std::cout << "Failed to load healing box icon: " << IMG_GetError() << std::endl;
+    backend = renderBackend.get();
+    if (!options.captureDrawsPath.empty()) {
+        drawRecorder = std::make_unique<RecordingRenderBackend>(renderBackend.get());
+        backend = drawRecorder.get();
     }
-    if (!texMassBomb) {
-        std::cout << "Failed to load mass bomb icon: " << IMG_GetError() << std::endl;
+    LOG_INFO(RENDER, "Render backend: %s%s", renderBackend->getName(), drawRecorder ? " (recording)" : "");
+    if (!options.saveFramesPath.empty() && options.renderBackend != RenderBackendType::SOFTWARE) {
+        LOG_WARN(RENDER, "--save-frames needs --renderer=software; no frames will be written");
+    }
+
+    // Restart and the first wave's retry go back here
+    runStartSnapshot = saveSnapshot();
+    waveStartSnapshot = runStartSnapshot;
+    if (options.checkpointWave == 1) {
+        saveWaveCheckpoint();
+    }
+    
+    if (!options.loadCheckpoint.empty()) {
+        // Restored weapons need their sprites before requestDeferredAssets() runs
+        weaponSprites.request(assets);
+        std::vector<uint8_t> blob;
+        if (readSnapshotFile(options.loadCheckpoint, blob) && restoreSnapshot(blob)) {
+            waveStartSnapshot = blob;
+            LOG_INFO(CORE, "Loaded %s at wave %d", options.loadCheckpoint.c_str(), wave);
+        }
     }
 
     running = true;
@@ -126,36 +243,250 @@ bool Game::init() {
     return true;
 }
 
-void Game::run() {
-    Uint32 lastTime = SDL_GetTicks();
+void Game::requestDeferredAssets() {
+    ScopedStartupPhase deferredPhase(startupTimeline, "Deferred asset requests");
+    
+    // Particle star texture; particles are skipped until it's ready (or if it fails to load)
+    starTexture = assets.requestTexture("assets/particles/star.png");
+    
+    // Item icons for UI reuse
+    texHealingBox = assets.requestTexture(Defs::text(Defs::item(ItemType::HEALING_BOX).icon));
+    texMassBomb = assets.requestTexture(Defs::text(Defs::item(ItemType::MASS_BOMB).icon));
+    
+    {
+        ScopedStartupPhase shopPhase(startupTimeline, "Shop::loadAssets");
+        shop->loadAssets(assets);
+    }
+    
+    enemies.loadSprites(assets);
+    
+    // Textures first needed mid-game (shop purchases, boss waves). Warmed up now so
+    // they're decoded long before anything asks for them, and held here so a
+    // restored snapshot can rebuild weapons and bosses without the loader.
+    // Sprites nothing references (the rest of assets/weapons) are never loaded.
+    weaponSprites.request(assets);
+    for (const char* path : bossTexturePaths()) {
+        bossSprites[path] = assets.requestTexture(path);
+    }
+}
+
+TextureHandle Game::bossSprite(const char* path) {
+    auto it = bossSprites.find(path);
+    if (it != bossSprites.end()) {
+        return it->second;
+    }
+    // Boss wave before the deferred requests went out (a checkpoint loaded at startup)
+    TextureHandle handle = assets.requestTexture(path);
+    bossSprites[path] = handle;
+    return handle;
+}
+
+void Game::updateStartupReport() {
+    // drawFrame() marks the first frame; the requests go out at the next sync point
+    if (startupReported || !startupTimeline.hasFirstFrame()) return;
+    
+    if (!deferredAssetsRequested) {
+        deferredAssetsRequested = true;
+        requestDeferredAssets();
+        return;
+    }
     
-    while (running) {
-        Uint32 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
+    // Report once the deferred textures have landed so every load shows up
+    if (assets.getPendingCount() > 0) return;
+    startupReported = true;
+    startupTimeline.report(assets);
+    
+    if (options.startupBenchmark) {
+        float timeToFirstFrame = startupTimeline.getTimeToFirstFrameMs();
+        if (timeToFirstFrame > options.startupBudgetMs) {
+            LOG_ERROR(CORE, "Startup benchmark FAILED: first frame after %.1f ms, budget %.1f ms",
+                      timeToFirstFrame, options.startupBudgetMs);
+            exitCode = 1;
+        } else {
+            LOG_INFO(CORE, "Startup benchmark passed: first frame after %.1f ms, budget %.1f ms",
+                     timeToFirstFrame, options.startupBudgetMs);
+        }
+        running = false;
+    }
+}
+
+void Game::run() {
+    lastSimulationTime = SDL_GetPerformanceCounter();
+    if (options.simulationThread) {
+        pipeline.start([this](const FrameInput& input, RenderFrame& frame) { simulateFrame(input, frame); });
+        LOG_INFO(CORE, "Simulation running on its own thread");
+    }
+    
+    uint64_t frames = 0;
+    double simulationMsTotal = 0.0;
+    double frameMsTotal = 0.0;
+    float lastFrameMs = 0.0f;
+    float lastSimulationMs = 0.0f;
+    bool pacingKeyHeld = false;
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    
+    while (true) {
+        Uint64 frameStart = SDL_GetPerformanceCounter();
+        FrameInput input = pollInput();
+        // F8 cycles frame pacing; the main thread owns the renderer's vsync setting
+        if (input.keys[SDL_SCANCODE_F8] && !pacingKeyHeld) {
+            cyclePacingMode();
+        }
+        pacingKeyHeld = input.keys[SDL_SCANCODE_F8];
+        
+        // Sync point: the simulation is parked until submit(), so game state
+        // and the asset loader belong to this thread
+        pipeline.waitIdle();
+        // Upload a bounded number of freshly decoded textures so loading never stalls a frame
+        assets.pumpUploads(MAX_TEXTURE_UPLOADS_PER_FRAME);
+        updateStartupReport();
+        particleBudget.recordFrameTime(lastFrameMs - lastPresentMs, options.frameBudgetMs);
+        if (qualityGovernor.recordFrame(lastSimulationMs, lastDrawMs)) {
+            applyQuality();
+        }
+        if (!running) break;
+        
+        RenderFrame* frame;
+        if (!pipeline.isRunning()) {
+            simulateFrame(input, serialFrame);
+            frame = &serialFrame;
+        } else {
+            frame = pipeline.takeFinished();
+            if (!frame) {
+                // Nothing recorded ahead (first frame): record this frame now. Input
+                // is level-triggered, so submitting the same input twice is harmless
+                pipeline.submit(input);
+                pipeline.waitIdle();
+                frame = pipeline.takeFinished();
+            }
+            pipeline.submit(input);
+        }
+        
+        drawFrame(*frame);
         
-        handleEvents();
-        update(deltaTime);
-        render();
+        frames++;
+        lastSimulationMs = frame->simulationMs;
+        simulationMsTotal += frame->simulationMs;
+        lastFrameMs = static_cast<float>((SDL_GetPerformanceCounter() - frameStart) * 1000.0 / frequency);
+        frameMsTotal += lastFrameMs;
         
-        SDL_Delay(16);
+        framePacer.endFrame();
+    }
+    
+    pipeline.stop();
+    if (frames > 0) {
+        LOG_INFO(RENDER, "%llu frames: %.2f ms simulation, %.2f ms frame on average (%s)",
+                 static_cast<unsigned long long>(frames), simulationMsTotal / frames, frameMsTotal / frames,
+                 options.simulationThread ? "simulation thread" : "single thread");
+    }
+    framePacer.logSummary();
+    if (frames > 0 && qualityGovernor.getTierChanges() > 0) {
+        char tiers[96];
+        int length = 0;
+        for (int t = 0; t < QualityGovernor::TIER_COUNT; t++) {
+            length += std::snprintf(tiers + length, sizeof(tiers) - length, " %d:%.0f%%", t,
+                                    100.0 * qualityGovernor.getFramesAtTier(t) / frames);
+        }
+        LOG_INFO(RENDER, "Quality: %d tier changes, frames per tier%s", qualityGovernor.getTierChanges(), tiers);
+    }
+    if (particleBudget.getRequested() > 0) {
+        LOG_INFO(GAMEPLAY, "Particles: %llu of %llu requested spawned, peak %d live (budget %d)",
+                 static_cast<unsigned long long>(particleBudget.getSpawned()),
+                 static_cast<unsigned long long>(particleBudget.getRequested()),
+                 particleBudget.getPeakLive(), particleBudget.getLimit());
     }
 }
 
-void Game::handleEvents() {
+FrameInput Game::pollInput() {
+    FrameInput input;
     SDL_Event e;
     while (SDL_PollEvent(&e) != 0) {
         if (e.type == SDL_QUIT) {
-            running = false;
+            input.quit = true;
         }
     }
     
-    // Get mouse position
+    int numKeys = 0;
+    const Uint8* keyState = SDL_GetKeyboardState(&numKeys);
+    std::memcpy(input.keys, keyState, std::min(numKeys, static_cast<int>(SDL_NUM_SCANCODES)));
+    
+    // Mouse and view in logical coordinates; the scaler follows window resizes
     int mouseX, mouseY;
-    SDL_GetMouseState(&mouseX, &mouseY);
-    mousePos = Vector2(static_cast<float>(mouseX), static_cast<float>(mouseY));
+    Uint32 mouseState = SDL_GetMouseState(&mouseX, &mouseY);
+    input.mousePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
+    input.mouse = renderScaler.windowToLogical(mouseX, mouseY);
+    input.view = renderScaler.visibleWorld();
+    return input;
+}
+
+void Game::simulateFrame(const FrameInput& input, RenderFrame& frame) {
+    Uint64 simulationStart = SDL_GetPerformanceCounter();
+    float deltaTime = (simulationStart - lastSimulationTime) / static_cast<float>(SDL_GetPerformanceFrequency());
+    lastSimulationTime = simulationStart;
+    
+    // Nothing allocated from the frame arena survives the previous frame
+    frameArena.reset();
+    
+    applyInput(input);
+    if (simulationPaused) {
+        // Frame-stepping: one fixed-length tick per F6 press
+        if (stepRequested) {
+            stepRequested = false;
+            tick(STEP_SECONDS);
+        }
+    } else {
+        tick(deltaTime);
+        
+        // Accelerated time: extra simulation steps before the frame is presented.
+        // Human input is only read once per frame, so only the autopilot steers these
+        for (int step = 1; step < options.timeScale && running; step++) {
+            if (autopilot) updateAutopilot();
+            tick(deltaTime);
+        }
+    }
+    
+    recordFrame(frame);
+    frame.tick = simulationTick;
+    frame.simulationMs = (SDL_GetPerformanceCounter() - simulationStart) * 1000.0f / SDL_GetPerformanceFrequency();
+}
+
+void Game::tick(float deltaTime) {
+    particleBudget.beginTick(static_cast<int>(world.count(componentMask<Cosmetic>())));
+    update(deltaTime);
+    // Reclaim everything destroyed this step in one pass
+    world.flush();
+    if (waveCheckpointPending) saveWaveCheckpoint();
+    recordHistory();
+}
+
+void Game::applyInput(const FrameInput& input) {
+    if (input.quit) {
+        running = false;
+    }
     
-    const Uint8* keyState = SDL_GetKeyboardState(nullptr);
+    // Follows window resizes and logical size changes
+    view = input.view;
+    mousePos = input.mouse;
+    bool mousePressed = input.mousePressed;
+    int logicalMouseX = static_cast<int>(mousePos.x);
+    int logicalMouseY = static_cast<int>(mousePos.y);
+    
+    const Uint8* keyState = input.keys;
+    handleDebugKeys(keyState);
+    
+    if (autopilot) {
+        updateAutopilot();
+        return;
+    }
+    
+    // F9: retry the current wave from its start (also from the game over menu)
+    if (keyState[SDL_SCANCODE_F9] && !retryKeyPressed) {
+        retryKeyPressed = true;
+        retryWave();
+        return;
+    } else if (!keyState[SDL_SCANCODE_F9]) {
+        retryKeyPressed = false;
+    }
     
     // Ensure menu and shop are not both active
     if (menu->isMenuActive() && shop->isShopActive()) {
@@ -167,9 +498,7 @@ void Game::handleEvents() {
         menu->handleInput(keyState);
         
         // Handle mouse input for menu
-        Uint32 mouseState = SDL_GetMouseState(&mouseX, &mouseY);
-        bool mousePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
-        menu->handleMouseInput(mouseX, mouseY, mousePressed);
+        menu->handleMouseInput(logicalMouseX, logicalMouseY, mousePressed);
     }
     // Handle shop input if shop is active
     else if (shop->isShopActive()) {
@@ -182,9 +511,7 @@ void Game::handleEvents() {
         }
         
         // Handle mouse input for shop
-        Uint32 mouseState = SDL_GetMouseState(&mouseX, &mouseY);
-        bool mousePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
-        shop->handleMouseInput(mouseX, mouseY, mousePressed, *player);
+        shop->handleMouseInput(logicalMouseX, logicalMouseY, mousePressed, *player);
     } 
     // Handle game input (including ESC for pause)
     else {
@@ -205,11 +532,64 @@ void Game::handleEvents() {
             escKeyPressed = false;
         }
         
-        player->handleInput(keyState);
-        handleItemInput(keyState);
-        
-        // Update player's shoot direction to point towards mouse
-        player->updateShootDirection(mousePos);
+        PlayerInput playerInput;
+        if (keyState[SDL_SCANCODE_W] || keyState[SDL_SCANCODE_UP]) playerInput.move.y = -1.0f;
+        if (keyState[SDL_SCANCODE_S] || keyState[SDL_SCANCODE_DOWN]) playerInput.move.y = 1.0f;
+        if (keyState[SDL_SCANCODE_A] || keyState[SDL_SCANCODE_LEFT]) playerInput.move.x = -1.0f;
+        if (keyState[SDL_SCANCODE_D] || keyState[SDL_SCANCODE_RIGHT]) playerInput.move.x = 1.0f;
+        // Shoot towards the mouse
+        playerInput.aimTarget = mousePos;
+        playerInput.useHealing = keyState[SDL_SCANCODE_F];
+        playerInput.useBomb = keyState[SDL_SCANCODE_R];
+        applyPlayerInput(playerInput);
+    }
+}
+
+void Game::handleDebugKeys(const Uint8* keyState) {
+    if (keyState[SDL_SCANCODE_F5] && !pauseKeyPressed) {
+        simulationPaused = !simulationPaused;
+        LOG_INFO(CORE, "Simulation %s at tick %llu", simulationPaused ? "paused" : "resumed",
+                 static_cast<unsigned long long>(simulationTick));
+    }
+    pauseKeyPressed = keyState[SDL_SCANCODE_F5];
+    
+    if (keyState[SDL_SCANCODE_F6] && !stepKeyPressed && simulationPaused) {
+        stepRequested = true;
+    }
+    stepKeyPressed = keyState[SDL_SCANCODE_F6];
+    
+    // Held: one history entry further back every frame
+    if (keyState[SDL_SCANCODE_F7]) {
+        rewindHistory();
+    }
+}
+
+void Game::applyPlayerInput(const PlayerInput& input) {
+    player->handleInput(input);
+    handleItemInput(input);
+    player->updateShootDirection(input.aimTarget);
+}
+
+void Game::updateAutopilot() {
+    // The run is over: dead, or the requested number of waves cleared
+    if (player->getHealth() <= 0 || (currentState != GameState::WAVE_ACTIVE && wave > options.autopilotWaves)) {
+        bool survived = player->getHealth() > 0;
+        LOG_INFO(GAMEPLAY, "Autopilot run %s on wave %d: level %d, %d weapons, score %d",
+                 survived ? "finished" : "died", survived ? wave - 1 : wave,
+                 player->getLevel(), player->getWeaponCount(), score);
+        exitCode = survived ? 0 : 1;
+        running = false;
+        return;
+    }
+    
+    if (menu->isMenuActive()) {
+        menu->hideMenu();
+    }
+    
+    if (shop->isShopActive()) {
+        autopilot->shop(*shop, *player);
+    } else {
+        applyPlayerInput(autopilot->drive(*player, enemies, boss.get(), world));
     }
 }
 
@@ -221,7 +601,8 @@ void Game::update(float deltaTime) {
     if (player->getHealth() <= 0) {
         if (!gameOverShown) {
             // Add player death particle effect - red particles, medium amount, medium duration/speed
-            createParticleBurst(player->getPosition(), 15, 120.0f, 1.0f, {255, 0, 0, 255}, 0.7f); // 30% smaller
+            createParticleBurst(player->getPosition(), 15, 120.0f, 1.0f, {255, 0, 0, 255}, 0.7f, // 30% smaller
+                                ParticlePriority::CRITICAL);
             
             // Ensure shop is closed if player dies
             if (shop->isShopActive()) {
@@ -241,37 +622,30 @@ void Game::update(float deltaTime) {
     // Update state machine first
     updateState(deltaTime);
     
+    // One spatial index and one batched query aim every weapon
+    targeting.rebuild(enemies, isBossWave ? boss.get() : nullptr);
+    player->aimWeapons(targeting, options.aimMode);
+    
     // During transition states, allow limited gameplay
     if (currentState != GameState::WAVE_ACTIVE) {
         // Allow player movement and interaction during transitions
         player->update(deltaTime);
         
         // Update bullets (keep them moving)
-        for (auto& bullet : bullets) {
-            bullet->update(deltaTime);
-        }
+        moveEntities(world, deltaTime, 0, componentMask<Cosmetic>());
+        updateBullets(world, view);
         
         // Update and allow collection of items
         updateExperienceCollection();
         updateMaterialCollection();
         
         // Update experience orbs and materials for visual movement
-        for (auto& orb : experienceOrbs) {
-            orb->update(deltaTime);
-        }
-        for (auto& material : materials) {
-            material->update(deltaTime);
-        }
+        ageLifetimes(world, deltaTime, componentMask<Pickup>());
+        animateBob(world, deltaTime);
         
         // Check collisions (player invulnerable during transitions)
         checkCollisions();
-        
-        // Clean up dead bullets
-        bullets.erase(std::remove_if(bullets.begin(), bullets.end(),
-            [](const std::unique_ptr<Bullet>& bullet) {
-                return !bullet->isAlive();
-            }), bullets.end());
-        
+        retireExpiredEntities();
         return;
     }
     
@@ -282,13 +656,13 @@ void Game::update(float deltaTime) {
         // Check boss wave conditions
         if (isBossWaveIndex(wave) && !isBossWave && waveTimer < 1.0f) {
             startBossWave(wave);
-            spawnIndicators.clear();
+            clearSpawnIndicators();
             timeSinceLastSpawn = 0;
         }
         
         // Update boss if present
         if (isBossWave && boss) {
-            boss->update(deltaTime, player->getPosition(), bullets);
+            boss->update(deltaTime, player->getPosition(), world);
             
             // Check boss death
             if (boss->isDead()) {
@@ -311,270 +685,245 @@ void Game::update(float deltaTime) {
     player->update(deltaTime);
     
     // Update weapons (they will fire in aim direction)
-    player->updateWeapons(deltaTime, bullets);
+    player->updateWeapons(deltaTime, world);
     
     // Update bombs
-    updateBombs(deltaTime);
+    updateBombs(world, deltaTime);
     checkBombExplosions();
     
-    for (auto& bullet : bullets) {
-        bullet->update(deltaTime);
-    }
+    // Bullets (particles were already moved above)
+    moveEntities(world, deltaTime, 0, componentMask<Cosmetic>());
+    updateBullets(world, view);
     
-    for (auto& enemy : enemies) {
-        enemy->update(deltaTime, player->getPosition(), bullets);
-    }
+    enemies.update(deltaTime, player->getPosition(), world);
 
+    // Spawn telegraphs, orbs and materials
+    ageLifetimes(world, deltaTime, 0, componentMask<Cosmetic>());
+    animateBob(world, deltaTime);
     updateSpawnIndicators(deltaTime);
     
-    for (auto& orb : experienceOrbs) {
-        orb->update(deltaTime);
-    }
-    
-    for (auto& material : materials) {
-        material->update(deltaTime);
-    }
-    
-    spawnEnemies();
+    spawnEnemies(deltaTime);
     checkCollisions();
     checkMeleeAttacks();
     updateExperienceCollection();
     updateMaterialCollection();
     
-    bullets.erase(std::remove_if(bullets.begin(), bullets.end(),
-        [](const std::unique_ptr<Bullet>& bullet) {
-            return !bullet->isAlive();
-        }), bullets.end());
-    
-    enemies.erase(std::remove_if(enemies.begin(), enemies.end(),
-        [&](const std::unique_ptr<Enemy>& enemy) {
-            if (!enemy->isAlive()) {
-                // Add enemy death particle effect - enemy-specific color, small amount, low duration/speed
-                SDL_Color enemyColor = getEnemyParticleColor(enemy->getEnemyType());
-                createParticleBurst(enemy->getPosition(), 8, 80.0f, 0.6f, enemyColor, 0.49f); // 0.7f * 0.7f = ~30% smaller
-                
-                // Brotato-style material drop system
-                float dropChance = getMaterialDropChance();
-                static std::random_device rd;
-                static std::mt19937 gen(rd());
-                std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-                
-                if (dist(gen) < dropChance) {
-                    // Check material limit on map
-                    if (materials.size() < MAX_MATERIALS_ON_MAP) {
-                        int matValue = 1 + (wave / 3);
-                        int expValue = 1 + (wave / 5);
-                        materials.push_back(std::make_unique<Material>(
-                            enemy->getPosition(), matValue, expValue
-                        ));
-                    } else {
-                        // Add to bag if map is full
-                        materialBag += 1 + (wave / 3);
-                    }
-                }
-                
-                score += 10;
-                return true;
-            }
-            return false;
-        }), enemies.end());
-    
-    experienceOrbs.erase(std::remove_if(experienceOrbs.begin(), experienceOrbs.end(),
-        [](const std::unique_ptr<ExperienceOrb>& orb) {
-            return !orb->isAlive();
-        }), experienceOrbs.end());
-    
-    materials.erase(std::remove_if(materials.begin(), materials.end(),
-        [&](const std::unique_ptr<Material>& material) {
-            if (!material->isAlive()) {
-                // Add uncollected materials to bag
-                materialBag += material->getMaterialValue();
-                return true;
+    size_t materialsOnMap = countMaterials(world);
+    enemies.removeDead([&](const Enemy& enemy) {
+        // Add enemy death particle effect - enemy-specific color, small amount, low duration/speed
+        SDL_Color enemyColor = getEnemyParticleColor(enemy.getEnemyType());
+        createParticleBurst(enemy.getPosition(), 8, 80.0f, 0.6f, enemyColor, 0.49f); // 0.7f * 0.7f = ~30% smaller
+        
+        // Brotato-style material drop system
+        float dropChance = getMaterialDropChance();
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        
+        if (dist(Random::stream(RandomStream::DROPS)) < dropChance) {
+            // Check material limit on map
+            if (materialsOnMap < MAX_MATERIALS_ON_MAP) {
+                spawnMaterial(world, enemy.getPosition(), Balance::materialValue(wave), Balance::materialExperience(wave));
+                materialsOnMap++;
+            } else {
+                // Add to bag if map is full
+                materialBag += Balance::materialValue(wave);
             }
-            return false;
-        }), materials.end());
+        }
+        
+        score += 10;
+    });
+    
+    retireExpiredEntities();
+}
+
+void Game::retireExpiredEntities() {
+    // Add uncollected materials to bag before their lifetime runs out
+    world.each<Lifetime, Pickup>([&](Entity, Lifetime& lifetime, Pickup& pickup) {
+        if (lifetime.expired()) {
+            materialBag += pickup.materials;
+        }
+    });
+    destroyExpired(world);
 }
 
 void Game::updateExperienceCollection() {
     Vector2 playerPos = player->getPosition();
     float pickupRange = player->getStats().pickupRange;
     
-    for (auto& orb : experienceOrbs) {
-        if (orb->isAlive()) {
-            float distance = playerPos.distance(orb->getPosition());
-            if (distance <= pickupRange) {
-                player->gainExperience(orb->getExperienceValue());
-                orb->collect();
-            }
+    world.each<Transform, Pickup>([&](Entity orb, Transform& transform, Pickup& pickup) {
+        if (pickup.kind != PickupKind::EXPERIENCE_ORB) return;
+        float distance = playerPos.distance(transform.position);
+        if (distance <= pickupRange) {
+            player->gainExperience(pickup.experience);
+            world.destroy(orb);
         }
-    }
+    });
 }
 
 void Game::updateMaterialCollection() {
     Vector2 playerPos = player->getPosition();
     float pickupRange = player->getStats().pickupRange;
     
-    for (auto& material : materials) {
-        if (material->isAlive()) {
-            float distance = playerPos.distance(material->getPosition());
-            if (distance <= pickupRange) {
-                // Materials provide both experience and gold/materials
-                player->gainExperience(material->getExperienceValue());
-                player->gainMaterials(material->getMaterialValue());
-                material->collect();
-            }
+    world.each<Transform, Pickup>([&](Entity material, Transform& transform, Pickup& pickup) {
+        if (pickup.kind != PickupKind::MATERIAL) return;
+        float distance = playerPos.distance(transform.position);
+        if (distance <= pickupRange) {
+            // Materials provide both experience and gold/materials
+            player->gainExperience(pickup.experience);
+            player->gainMaterials(pickup.materials);
+            world.destroy(material);
         }
-    }
+    });
 }
 
 float Game::getMaterialDropChance() const {
-    // Brotato's material drop formula:
-    // Starts at 100%, decreases 1.5% per wave number, minimum 50%
-    float baseChance = 1.0f;
-    float reduction = (wave - 1) * 0.015f;
-    float dropChance = baseChance - reduction;
-    
-    // Minimum 50% chance
-    if (dropChance < 0.5f) dropChance = 0.5f;
-    
-    // TODO: Implement horde wave reduction (-35%)
-    
-    return dropChance;
+    return Balance::materialDropChance(wave);
 }
 
-void Game::render() {
-    SDL_SetRenderDrawColor(renderer, 120, 110, 100, 255); // Light brown/tan background for better visibility
-    SDL_RenderClear(renderer);
+void Game::recordFrame(RenderFrame& frame) {
+    RenderQueue& queue = frame.world;
+    // A frame nobody drew still holds its draws
+    queue.clear();
+    queue.setLayerEnabled(RenderLayer::MUZZLE_FLASHES, quality.muzzleFlashes);
     
-    player->render(renderer);
-    player->renderWeapons(renderer);
+    player->render(queue);
+    player->renderWeapons(queue);
     
+    // RenderLayer keeps the order below, the queue groups draws by blend mode
+    // and texture within each layer
     // Рендерим босса если он есть
     if (isBossWave && boss) {
-        boss->render(renderer);
-    }
-    for (auto& bullet : bullets) {
-        bullet->render(renderer);
+        boss->render(queue, view);
     }
+    renderBullets(world, queue, view);
     
-    for (auto& enemy : enemies) {
-        enemy->render(renderer);
-    }
+    enemies.render(queue, view);
 
     // Spawn indicators on top of background but beneath UI
-    renderSpawnIndicators();
-    
-    for (auto& orb : experienceOrbs) {
-        orb->render(renderer);
-    }
+    renderSpawnIndicators(queue);
     
-    for (auto& material : materials) {
-        material->render(renderer);
-    }
+    renderExperienceOrbs(world, queue, view, quality.pickupBobbing);
+    renderMaterials(world, queue, view, quality.pickupBobbing);
     
     // Render bombs
-    renderBombs();
+    renderBombs(world, queue, view);
     
     // Render particles (after background entities, before UI)
-    renderParticles();
+    renderParticles(world, queue, view);
     
-    renderUI();
+    // Screen-space pass, back to front
+    DrawList& overlay = frame.overlay;
+    overlay.clear();
+    renderUI(overlay);
     
     // Render shop on top if active
-    shop->render(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+    shop->render(overlay, WINDOW_WIDTH, WINDOW_HEIGHT);
     
     // Render transition state UI
-    renderStateUI();
+    renderStateUI(overlay);
     
-    // Render menu on top of everything if active
-    menu->render(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+    if (simulationPaused) {
+        renderDebugPlaybackUI(overlay);
+    }
     
-    SDL_RenderPresent(renderer);
+    // Render menu on top of everything if active
+    menu->render(overlay, WINDOW_WIDTH, WINDOW_HEIGHT);
 }
 
-void Game::renderUI() {
+void Game::cyclePacingMode() {
+    PacingMode next = static_cast<PacingMode>((static_cast<int>(framePacer.getMode()) + 1) % FramePacer::MODE_COUNT);
+    if (next == PacingMode::VSYNC && options.renderBackend != RenderBackendType::SDL) {
+        next = PacingMode::TARGET_FPS;
+    }
+    if (options.renderBackend == RenderBackendType::SDL &&
+        SDL_RenderSetVSync(renderer, next == PacingMode::VSYNC ? 1 : 0) != 0 && next == PacingMode::VSYNC) {
+        LOG_WARN(RENDER, "Could not turn vsync on: %s", SDL_GetError());
+        next = PacingMode::TARGET_FPS;
+    }
+    framePacer.setMode(next);
+    LOG_INFO(RENDER, "Frame pacing: %s", FramePacer::modeName(next));
+}
+
+void Game::applyQuality() {
+    // Sync point only: the simulation thread reads these while recording
+    quality = qualityGovernor.getSettings();
+    particleBudget.setDensity(quality.particleDensity);
+    menu->setEffects(quality.menuEffects);
+    renderScaler.setInternalScale(options.renderScale * quality.resolutionScale);
+}
+
+void Game::drawFrame(RenderFrame& frame) {
+    Uint64 renderStart = SDL_GetPerformanceCounter();
+    
+    backend->drawWorld(frame.world, {120, 110, 100, 255}); // Light brown/tan background for better visibility
+    backend->drawOverlay(frame.overlay);
+    // Frame-time consumers all leave out present, which may be waiting on the display rather than on us
+    Uint64 presentStart = SDL_GetPerformanceCounter();
+    lastDrawMs = (presentStart - renderStart) * 1000.0f / SDL_GetPerformanceFrequency();
+    renderScaler.recordFrameTime(lastDrawMs);
+    backend->present();
+    lastPresentMs = (SDL_GetPerformanceCounter() - presentStart) * 1000.0f / SDL_GetPerformanceFrequency();
+    if (!startupTimeline.hasFirstFrame()) {
+        startupTimeline.markFirstFrame();
+    }
+}
+
+void Game::renderUI(DrawList& list) {
     // === BROTATO-STYLE UI LAYOUT WITH BITMAP TEXT ===
+    SDL_Color white = {255, 255, 255, 255};
     
     // Полоса здоровья босса (если есть)
     if (isBossWave && boss) {
         // Фон полосы HP босса
-        SDL_SetRenderDrawColor(renderer, 139, 0, 0, 255);
         SDL_Rect bossHpBg = {WINDOW_WIDTH/4, 50, WINDOW_WIDTH/2, 30};
-        SDL_RenderFillRect(renderer, &bossHpBg);
+        list.quad(bossHpBg, {139, 0, 0, 255});
         
         // Заполненная часть HP
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
         int bossHpWidth = static_cast<int>((boss->getHealthPercent() * WINDOW_WIDTH/2));
-        SDL_Rect bossHpBar = {WINDOW_WIDTH/4, 50, bossHpWidth, 30};
-        SDL_RenderFillRect(renderer, &bossHpBar);
+        list.quad({WINDOW_WIDTH/4, 50, bossHpWidth, 30}, {255, 0, 0, 255});
         
         // Белая рамка
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        SDL_RenderDrawRect(renderer, &bossHpBg);
+        list.quadOutline(bossHpBg, white);
         
         // Имя босса
         if (defaultFont) {
-            SDL_Color white = {255, 255, 255, 255};
-            renderTTFText(boss->getName(), WINDOW_WIDTH/2 - 50, 20, white, 24);
+            list.text(boss->getName(), WINDOW_WIDTH/2 - 50, 20, white, 24);
         } else {
-            renderText(boss->getName(), WINDOW_WIDTH/2 - 50, 20, 2);
+            list.bitmapText(boss->getName(), WINDOW_WIDTH/2 - 50, 20, 2);
         }
     }
     
     // Top-left: Health bar with actual numbers
-    SDL_SetRenderDrawColor(renderer, 139, 0, 0, 255); // Dark red background
     SDL_Rect healthBg = {20, 20, 200, 35};
-    SDL_RenderFillRect(renderer, &healthBg);
+    list.quad(healthBg, {139, 0, 0, 255}); // Dark red background
     
-    SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255); // Red health bar
     int healthWidth = (player->getHealth() * 200) / player->getStats().maxHealth;
-    SDL_Rect healthBar = {20, 20, healthWidth, 35};
-    SDL_RenderFillRect(renderer, &healthBar);
+    list.quad({20, 20, healthWidth, 35}, {255, 0, 0, 255}); // Red health bar
     
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White border
-    SDL_RenderDrawRect(renderer, &healthBg);
+    list.quadOutline(healthBg, white); // White border
     
     // Health text "X / Y"
-    renderNumber(player->getHealth(), 30, 28, 2);
-    renderText(" / ", 30 + std::to_string(player->getHealth()).length() * 12, 28, 2);
-    renderNumber(player->getStats().maxHealth, 30 + std::to_string(player->getHealth()).length() * 12 + 24, 28, 2);
+    int healthDigits = countDigits(player->getHealth());
+    list.bitmapNumber(player->getHealth(), 30, 28, 2);
+    list.bitmapText(" / ", 30 + healthDigits * 12, 28, 2);
+    list.bitmapNumber(player->getStats().maxHealth, 30 + healthDigits * 12 + 24, 28, 2);
     
     // Top-left: Level display "LV.X"
-    SDL_SetRenderDrawColor(renderer, 64, 64, 64, 255); // Dark gray background
     SDL_Rect levelBg = {20, 65, 120, 30};
-    SDL_RenderFillRect(renderer, &levelBg);
-    
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White border
-    SDL_RenderDrawRect(renderer, &levelBg);
+    list.quad(levelBg, {64, 64, 64, 255}); // Dark gray background
+    list.quadOutline(levelBg, white); // White border
     
     // Level text
-    renderText("LV.", 30, 72, 2);
-    renderNumber(player->getLevel(), 54, 72, 2);
+    list.bitmapText("LV.", 30, 72, 2);
+    list.bitmapNumber(player->getLevel(), 54, 72, 2);
     
     // Top-left: Materials counter (green circle with actual number)
-    SDL_SetRenderDrawColor(renderer, 0, 100, 0, 255); // Dark green
-    // Draw circle
-    for (int x = -40; x <= 40; x++) {
-        for (int y = -40; y <= 40; y++) {
-            if (x*x + y*y <= 40*40) {
-                SDL_RenderDrawPoint(renderer, 70 + x, 150 + y);
-            }
-        }
-    }
-    
-    SDL_SetRenderDrawColor(renderer, 50, 200, 50, 255); // Brighter green inner circle
-    for (int x = -35; x <= 35; x++) {
-        for (int y = -35; y <= 35; y++) {
-            if (x*x + y*y <= 35*35) {
-                SDL_RenderDrawPoint(renderer, 70 + x, 150 + y);
-            }
-        }
-    }
+    list.fillCircle(70, 150, 40, {0, 100, 0, 255}); // Dark green
+    list.fillCircle(70, 150, 35, {50, 200, 50, 255}); // Brighter green inner circle
     
     // Materials number (centered in circle)
-    int materialDigits = std::to_string(player->getStats().materials).length();
+    int materialDigits = countDigits(player->getStats().materials);
     int materialX = 70 - (materialDigits * 6); // Center the number
-    renderNumber(player->getStats().materials, materialX, 142, 2);
+    list.bitmapNumber(player->getStats().materials, materialX, 142, 2);
     
     // Item slots with keybind hints
     int itemSlotSize = 40;
@@ -586,91 +935,65 @@ void Game::renderUI() {
     for (int i = 0; i < player->getItemCount(); i++) {
         SDL_Rect slotRect = {itemStartX + i * (itemSlotSize + itemSpacing), itemStartY, itemSlotSize, itemSlotSize};
         
-        // Slot background
-        SDL_SetRenderDrawColor(renderer, 40, 45, 50, 255);
-        SDL_RenderFillRect(renderer, &slotRect);
-        
-        // Border
-        SDL_SetRenderDrawColor(renderer, 100, 110, 120, 255);
-        SDL_RenderDrawRect(renderer, &slotRect);
+        list.quad(slotRect, {40, 45, 50, 255}); // Slot background
+        list.quadOutline(slotRect, {100, 110, 120, 255}); // Border
         
         // Draw item icon
         const Item* item = player->getItem(i);
         if (item) {
-            SDL_Texture* icon = nullptr;
-            switch (item->getType()) {
-                case ItemType::HEALING_BOX: icon = texHealingBox; break;
-                case ItemType::MASS_BOMB: icon = texMassBomb; break;
-            }
+            SDL_Rect iconRect = {slotRect.x + 8, slotRect.y + 8, slotRect.w - 16, slotRect.h - 16};
+            SDL_Texture* icon = getItemIcon(item->getType());
             if (icon) {
-                SDL_Rect iconRect = {slotRect.x + 8, slotRect.y + 8, slotRect.w - 16, slotRect.h - 16};
-                SDL_RenderCopy(renderer, icon, nullptr, &iconRect);
+                list.sprite(icon, iconRect);
             } else {
-                // fallback
-                SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-                SDL_Rect iconRect = {slotRect.x + 8, slotRect.y + 8, slotRect.w - 16, slotRect.h - 16};
-                SDL_RenderFillRect(renderer, &iconRect);
+                list.quad(iconRect, {200, 200, 200, 255}); // fallback
             }
             
             // Draw keybind hint
-            SDL_Color white = {255, 255, 255, 255};
             if (item->getType() == ItemType::HEALING_BOX) {
-                renderTTFText("F", slotRect.x + 4, slotRect.y + slotRect.h + 4, white, 12);
+                list.text("F", slotRect.x + 4, slotRect.y + slotRect.h + 4, white, 12);
             } else if (item->getType() == ItemType::MASS_BOMB) {
-                renderTTFText("R", slotRect.x + 4, slotRect.y + slotRect.h + 4, white, 12);
+                list.text("R", slotRect.x + 4, slotRect.y + slotRect.h + 4, white, 12);
             }
         }
     }
     
     // Center top: Wave number with TTF text
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); // Semi-transparent black
     SDL_Rect waveBg = {WINDOW_WIDTH/2 - 80, 20, 160, 40};
-    SDL_RenderFillRect(renderer, &waveBg);
-    
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White border
-    SDL_RenderDrawRect(renderer, &waveBg);
+    list.quad(waveBg, {0, 0, 0, 200}); // Semi-transparent black
+    list.quadOutline(waveBg, white); // White border
     
     // Use TTF font for cleaner wave display, fallback to bitmap if TTF fails
     if (defaultFont) {
-        SDL_Color waveColor = {255, 255, 255, 255};
-        std::string waveText = "WAVE " + std::to_string(wave);
-        renderTTFText(waveText.c_str(), WINDOW_WIDTH/2 - 40, 28, waveColor, 18);
+        list.text(frameArena.format("WAVE %d", wave), WINDOW_WIDTH/2 - 40, 28, white, 18);
     } else {
         // Fallback to bitmap rendering with better spacing
-        renderText("WAVE", WINDOW_WIDTH/2 - 50, 30, 2);
-        renderNumber(wave, WINDOW_WIDTH/2 + 10, 30, 2);
+        list.bitmapText("WAVE", WINDOW_WIDTH/2 - 50, 30, 2);
+        list.bitmapNumber(wave, WINDOW_WIDTH/2 + 10, 30, 2);
     }
     
     // Center top: Countdown timer with actual numbers
     float timeLeft = waveDuration - waveTimer;
     int seconds = (int)timeLeft;
     
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); // Semi-transparent black
     SDL_Rect timerBg = {WINDOW_WIDTH/2 - 60, 70, 120, 60};
-    SDL_RenderFillRect(renderer, &timerBg);
-    
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White border
-    SDL_RenderDrawRect(renderer, &timerBg);
+    list.quad(timerBg, {0, 0, 0, 200}); // Semi-transparent black
+    list.quadOutline(timerBg, white); // White border
     
     // Large timer numbers using TTF (centered), fallback to bitmap
     if (defaultFont) {
-        SDL_Color timerColor = {255, 255, 255, 255};
-        std::string timerText = std::to_string(seconds);
-        renderTTFText(timerText.c_str(), WINDOW_WIDTH/2 - 15, 80, timerColor, 28);
+        list.text(frameArena.format("%d", seconds), WINDOW_WIDTH/2 - 15, 80, white, 28);
     } else {
         // Fallback to bitmap rendering
-        int timerDigits = std::to_string(seconds).length();
+        int timerDigits = countDigits(seconds);
         int timerX = WINDOW_WIDTH/2 - (timerDigits * 12);
-        renderNumber(seconds, timerX, 85, 4);
+        list.bitmapNumber(seconds, timerX, 85, 4);
     }
     
     // Experience bar (bottom of screen)
-    SDL_SetRenderDrawColor(renderer, 0, 100, 0, 255); // Dark green background
-    SDL_Rect expBg = {0, WINDOW_HEIGHT - 15, WINDOW_WIDTH, 15};
-    SDL_RenderFillRect(renderer, &expBg);
+    list.quad({0, WINDOW_HEIGHT - 15, WINDOW_WIDTH, 15}, {0, 100, 0, 255}); // Dark green background
     
     // Experience progress (Brotato-style)
-    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255); // Bright green
     int expToNext = player->getExperienceToNextLevel();
     int currentExp = player->getExperience();
     
@@ -686,148 +1009,29 @@ void Game::renderUI() {
     
     if (expNeededForCurrentLevel > 0) {
         int expWidth = (expInCurrentLevel * WINDOW_WIDTH) / expNeededForCurrentLevel;
-        SDL_Rect expBar = {0, WINDOW_HEIGHT - 15, expWidth, 15};
-        SDL_RenderFillRect(renderer, &expBar);
-    }
-}
-
-void Game::renderNumber(int number, int x, int y, int scale) {
-    // Simple 5x7 bitmap font for digits 0-9
-    static int digitPatterns[10][7] = {
-        // 0
-        {0b01110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110},
-        // 1  
-        {0b00100, 0b01100, 0b00100, 0b00100, 0b00100, 0b00100, 0b01110},
-        // 2
-        {0b01110, 0b10001, 0b00001, 0b00110, 0b01000, 0b10000, 0b11111},
-        // 3
-        {0b01110, 0b10001, 0b00001, 0b00110, 0b00001, 0b10001, 0b01110},
-        // 4
-        {0b00010, 0b00110, 0b01010, 0b10010, 0b11111, 0b00010, 0b00010},
-        // 5
-        {0b11111, 0b10000, 0b11110, 0b00001, 0b00001, 0b10001, 0b01110},
-        // 6
-        {0b01110, 0b10001, 0b10000, 0b11110, 0b10001, 0b10001, 0b01110},
-        // 7
-        {0b11111, 0b00001, 0b00010, 0b00100, 0b01000, 0b01000, 0b01000},
-        // 8
-        {0b01110, 0b10001, 0b10001, 0b01110, 0b10001, 0b10001, 0b01110},
-        // 9
-        {0b01110, 0b10001, 0b10001, 0b01111, 0b00001, 0b10001, 0b01110}
-    };
-    
-    std::string numStr = std::to_string(number);
-    int currentX = x;
-    
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White text
-    
-    for (char c : numStr) {
-        if (c >= '0' && c <= '9') {
-            int digit = c - '0';
-            
-            // Draw the digit
-            for (int row = 0; row < 7; row++) {
-                for (int col = 0; col < 5; col++) {
-                    if (digitPatterns[digit][row] & (1 << (4 - col))) {
-                        SDL_Rect pixel = {currentX + col * scale, y + row * scale, scale, scale};
-                        SDL_RenderFillRect(renderer, &pixel);
-                    }
-                }
-            }
-        }
-        currentX += 6 * scale; // Move to next digit position
-    }
-}
-
-void Game::renderText(const char* text, int x, int y, int scale) {
-    // Simple letter patterns for common letters (5x7 bitmap)
-    static std::map<char, std::vector<int>> letterPatterns = {
-        {'A', {0b01110, 0b10001, 0b10001, 0b11111, 0b10001, 0b10001, 0b10001}},
-        {'B', {0b11110, 0b10001, 0b10001, 0b11110, 0b10001, 0b10001, 0b11110}},
-        {'C', {0b01110, 0b10001, 0b10000, 0b10000, 0b10000, 0b10001, 0b01110}},
-        {'D', {0b11110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b11110}},
-        {'E', {0b11111, 0b10000, 0b10000, 0b11110, 0b10000, 0b10000, 0b11111}},
-        {'F', {0b11111, 0b10000, 0b10000, 0b11110, 0b10000, 0b10000, 0b10000}},
-        {'G', {0b01110, 0b10001, 0b10000, 0b10111, 0b10001, 0b10001, 0b01110}},
-        {'H', {0b10001, 0b10001, 0b10001, 0b11111, 0b10001, 0b10001, 0b10001}},
-        {'I', {0b01110, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b01110}},
-        {'J', {0b00111, 0b00010, 0b00010, 0b00010, 0b00010, 0b10010, 0b01100}},
-        {'K', {0b10001, 0b10010, 0b10100, 0b11000, 0b10100, 0b10010, 0b10001}},
-        {'L', {0b10000, 0b10000, 0b10000, 0b10000, 0b10000, 0b10000, 0b11111}},
-        {'M', {0b10001, 0b11011, 0b10101, 0b10101, 0b10001, 0b10001, 0b10001}},
-        {'N', {0b10001, 0b11001, 0b10101, 0b10011, 0b10001, 0b10001, 0b10001}},
-        {'O', {0b01110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110}},
-        {'P', {0b11110, 0b10001, 0b10001, 0b11110, 0b10000, 0b10000, 0b10000}},
-        {'R', {0b11110, 0b10001, 0b10001, 0b11110, 0b10010, 0b10001, 0b10001}},
-        {'S', {0b01111, 0b10000, 0b10000, 0b01110, 0b00001, 0b00001, 0b11110}},
-        {'T', {0b11111, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100}},
-        {'U', {0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110}},
-        {'V', {0b10001, 0b10001, 0b10001, 0b10001, 0b01010, 0b01010, 0b00100}},
-        {'W', {0b10001, 0b10001, 0b10001, 0b10101, 0b10101, 0b11011, 0b10001}},
-        {'X', {0b10001, 0b01010, 0b00100, 0b00100, 0b00100, 0b01010, 0b10001}},
-        {'Y', {0b10001, 0b10001, 0b01010, 0b00100, 0b00100, 0b00100, 0b00100}},
-        {'Z', {0b11111, 0b00001, 0b00010, 0b00100, 0b01000, 0b10000, 0b11111}},
-        {'.', {0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00100}},
-        {'/', {0b00001, 0b00010, 0b00010, 0b00100, 0b00100, 0b01000, 0b10000}},
-        {'|', {0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100}},
-        {'=', {0b00000, 0b00000, 0b11111, 0b00000, 0b11111, 0b00000, 0b00000}},
-        {':', {0b00000, 0b00100, 0b00000, 0b00000, 0b00000, 0b00100, 0b00000}},
-        {' ', {0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000}}
-    };
-    
-    int currentX = x;
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White text
-    
-    for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        if (c >= '0' && c <= '9') {
-            // Handle numbers with renderNumber
-            int digit = c - '0';
-            renderNumber(digit, currentX, y, scale);
-            currentX += 6 * scale;
-        } else if (letterPatterns.find(c) != letterPatterns.end()) {
-            // Draw the letter
-            auto pattern = letterPatterns[c];
-            for (int row = 0; row < 7; row++) {
-                for (int col = 0; col < 5; col++) {
-                    if (pattern[row] & (1 << (4 - col))) {
-                        SDL_Rect pixel = {currentX + col * scale, y + row * scale, scale, scale};
-                        SDL_RenderFillRect(renderer, &pixel);
-                    }
-                }
-            }
-            currentX += 6 * scale; // Move to next character position
-        } else {
-            currentX += 6 * scale; // Skip unknown characters
-        }
+        list.quad({0, WINDOW_HEIGHT - 15, expWidth, 15}, {0, 255, 0, 255}); // Bright green
     }
 }
 
-void Game::renderTTFText(const char* text, int x, int y, SDL_Color color, int fontSize) {
-    if (!defaultFont) return; // Fall back to bitmap rendering if no TTF font
-    
-    // Create surface from text
-    SDL_Surface* textSurface = TTF_RenderText_Blended(defaultFont, text, color);
-    if (!textSurface) {
-        std::cout << "Unable to render text surface! SDL_ttf Error: " << TTF_GetError() << std::endl;
-        return;
-    }
-    
-    // Create texture from surface
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-    if (!textTexture) {
-        std::cout << "Unable to create texture from text! SDL Error: " << SDL_GetError() << std::endl;
-        SDL_FreeSurface(textSurface);
-        return;
+void Game::renderDebugPlaybackUI(DrawList& list) {
+    SDL_Rect bannerBg = {WINDOW_WIDTH/2 - 320, WINDOW_HEIGHT - 90, 640, 60};
+    list.quad(bannerBg, {0, 0, 0, 200}, SDL_BLENDMODE_BLEND); // Semi-transparent black
+    list.quadOutline(bannerBg, {255, 200, 0, 255}); // Yellow border
+    
+    float historySeconds = (simulationTick - history.oldestTick()) * STEP_SECONDS;
+    if (history.empty()) historySeconds = 0.0f;
+    const char* status = frameArena.format("PAUSED  tick %llu  history %.1fs / %.1f MB",
+                                           static_cast<unsigned long long>(simulationTick), historySeconds,
+                                           history.bytesUsed() / (1024.0f * 1024.0f));
+    const char* keys = "F5 resume   F6 step   F7 rewind   F9 retry wave";
+    if (defaultFont) {
+        SDL_Color yellow = {255, 200, 0, 255};
+        SDL_Color white = {255, 255, 255, 255};
+        list.text(status, bannerBg.x + 16, bannerBg.y + 8, yellow, 18);
+        list.text(keys, bannerBg.x + 16, bannerBg.y + 34, white, 14);
+    } else {
+        list.bitmapText("PAUSED", bannerBg.x + 16, bannerBg.y + 20, 2);
     }
-    
-    // Render texture
-    SDL_Rect destRect = {x, y, textSurface->w, textSurface->h};
-    SDL_RenderCopy(renderer, textTexture, nullptr, &destRect);
-    
-    // Clean up
-    SDL_FreeSurface(textSurface);
-    SDL_DestroyTexture(textTexture);
 }
 
 void Game::startBossWave(int waveIndex) {
@@ -842,155 +1046,14 @@ void Game::startBossWave(int waveIndex) {
         player->setPosition(newPlayerPos);
     }
     
-    // Создаем конфиг босса
-    BossConfig config;
-    // Boss name per wave
-    switch (waveIndex) {
-        case 3:  config.name = "MEGA SLIME"; break;
-        case 6:  config.name = "DARK PEBBLIN"; break;
-        case 9:  config.name = "MORTORHEAD PRIME"; break;
-        default: config.name = "ANCIENT ONE"; break;
-    }
-    config.seed = static_cast<uint32_t>(waveIndex);
-
-    // Wave-based boss tuning (HP is effectively absolute since base = 1)
-    config.scale = 2.8f;
-    config.speedMul = 0.6f;
-    switch (waveIndex) {
-        case 3:
-            config.hpMul = 1200.f;
-            config.dmgMul = 2.0f;
-            break;
-        case 6:
-            config.hpMul = 2400.f;
-            config.dmgMul = 2.2f;
-            break;
-        case 9:
-        default:
-            config.hpMul = 3600.f;
-            config.dmgMul = 2.5f;
-            break;
-    }
-    
-    // Настраиваем паттерны в зависимости от типа босса
-    if (waveIndex == 3) { // MEGA SLIME - прыгучий босс с круговыми атаками
-        config.weightsP1 = {
-            {BossPattern::DASH_TO_PLAYER, 1.0f},  // Прыжки - основная атака
-            {BossPattern::RADIAL_SHOTS, 0.8f},    // Часто стреляет по кругу
-            {BossPattern::SUMMON_ADDS, 0.3f}      // Редко призывает миньонов
-        };
-        
-        config.weightsP2 = {
-            {BossPattern::DASH_TO_PLAYER, 1.2f},  // Еще больше прыжков
-            {BossPattern::RADIAL_SHOTS, 1.0f},
-            {BossPattern::SPIRAL_SHOTS, 0.8f},    // Новая атака
-            {BossPattern::SUMMON_ADDS, 0.4f}
-        };
-        
-        config.weightsEnrage = {
-            {BossPattern::DASH_TO_PLAYER, 1.5f},  // Агрессивные прыжки
-            {BossPattern::RADIAL_SHOTS, 1.2f},
-            {BossPattern::SPIRAL_SHOTS, 1.0f},
-            {BossPattern::BURST_AIM, 0.8f},       // Новая атака
-            {BossPattern::SUMMON_ADDS, 0.5f}
-        };
-    }
-    else if (waveIndex == 6) { // DARK PEBBLIN - призыватель с прицельной стрельбой
-        config.weightsP1 = {
-            {BossPattern::BURST_AIM, 1.0f},     // Основная атака - прицельная стрельба
-            {BossPattern::SUMMON_ADDS, 0.8f},   // Часто призывает миньонов
-            {BossPattern::RADIAL_SHOTS, 0.4f}   // Редкие защитные залпы
-        };
-        
-        config.weightsP2 = {
-            {BossPattern::BURST_AIM, 1.2f},     // Больше прицельной стрельбы
-            {BossPattern::SUMMON_ADDS, 1.0f},   // Больше миньонов
-            {BossPattern::SPIRAL_SHOTS, 0.7f},  // Добавляем спирали
-            {BossPattern::DASH_TO_PLAYER, 0.3f} // Редкие рывки для позиционирования
-        };
-        
-        config.weightsEnrage = {
-            {BossPattern::BURST_AIM, 1.5f},     // Интенсивная стрельба
-            {BossPattern::SUMMON_ADDS, 1.2f},   // Много миньонов
-            {BossPattern::SPIRAL_SHOTS, 1.0f},  // Частые спирали
-            {BossPattern::RADIAL_SHOTS, 0.8f},  // Защитные залпы
-            {BossPattern::DASH_TO_PLAYER, 0.4f} // Редкие рывки
-        };
-    }
-    else if (waveIndex == 9) { // MORTORHEAD PRIME - мастер спиральной стрельбы
-        config.weightsP1 = {
-            {BossPattern::SPIRAL_SHOTS, 1.0f},   // Основная атака - спирали
-            {BossPattern::RADIAL_SHOTS, 0.7f},   // Дополнительные круговые атаки
-            {BossPattern::DASH_TO_PLAYER, 0.4f}  // Редкие рывки
-        };
-        
-        config.weightsP2 = {
-            {BossPattern::SPIRAL_SHOTS, 1.2f},   // Больше спиралей
-            {BossPattern::BURST_AIM, 0.9f},      // Добавляем прицельную стрельбу
-            {BossPattern::RADIAL_SHOTS, 0.8f},   // Больше круговых атак
-            {BossPattern::DASH_TO_PLAYER, 0.5f}  // Чаще рывки
-        };
-        
-        config.weightsEnrage = {
-            {BossPattern::SPIRAL_SHOTS, 1.5f},   // Интенсивные спирали
-            {BossPattern::BURST_AIM, 1.2f},      // Много прицельной стрельбы
-            {BossPattern::RADIAL_SHOTS, 1.0f},   // Частые круговые атаки
-            {BossPattern::DASH_TO_PLAYER, 0.8f}, // Частые рывки
-            {BossPattern::SUMMON_ADDS, 0.4f}     // Редкий призыв миньонов
-        };
-    }
-    else { // ANCIENT ONE и другие - сбалансированный босс
-        config.weightsP1 = {
-            {BossPattern::RADIAL_SHOTS, 1.0f},
-            {BossPattern::DASH_TO_PLAYER, 0.7f},
-            {BossPattern::BURST_AIM, 0.5f}
-        };
-        
-        config.weightsP2 = {
-            {BossPattern::RADIAL_SHOTS, 1.1f},
-            {BossPattern::SPIRAL_SHOTS, 1.0f},
-            {BossPattern::DASH_TO_PLAYER, 0.8f},
-            {BossPattern::BURST_AIM, 0.7f}
-        };
-        
-        config.weightsEnrage = {
-            {BossPattern::RADIAL_SHOTS, 1.2f},
-            {BossPattern::SPIRAL_SHOTS, 1.2f},
-            {BossPattern::BURST_AIM, 1.0f},
-            {BossPattern::DASH_TO_PLAYER, 0.9f},
-            {BossPattern::SUMMON_ADDS, 0.6f}
-        };
-    }
+    // Конфиг босса (эмиттеры, рывки, призыв, веса паттернов) описан в BossDefinitions.cpp
+    BossConfig config = makeBossConfig(waveIndex);
     
     // Создаем босса в центре верхней части экрана
     Vector2 spawnPos(WINDOW_WIDTH/2.f, WINDOW_HEIGHT/3.f);
-    SDL_Texture* bossTex = nullptr;
-    
-    // Выбираем текстуру босса в зависимости от волны
-    const char* bossTexPath;
-    switch (waveIndex) {
-        case 3:
-            bossTexPath = "assets/enemies/slime.png";
-            break;
-        case 6:
-            bossTexPath = "assets/enemies/pebblin.png";
-            break;
-        case 9:
-        default:
-            bossTexPath = "assets/enemies/mortorhead.png";
-            break;
-    }
-    SDL_Surface* surface = IMG_Load(bossTexPath);
-    if (surface) {
-        bossTex = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_FreeSurface(surface);
-    }
-    
-    if (bossTex) {
-        boss = std::make_unique<BossEnemy>(spawnPos, renderer, config);
-    } else {
-        std::cout << "Failed to load boss texture!" << std::endl;
-    }
+    // Текстуры боссов предзагружены в requestDeferredAssets(), поэтому создание не блокирует кадр;
+    // если текстура ещё не готова, босс рисуется запасным кругом
+    boss = std::make_unique<BossEnemy>(spawnPos, bossSprite(config.texture), config);
 }
 
 void Game::endBossWave(bool bossDefeated) {
@@ -1000,37 +1063,29 @@ void Game::endBossWave(bool bossDefeated) {
 
     if (bossDefeated) {
         // (unchanged) big reward
-        for (int i = 0; i < 10; i++) {
-            experienceOrbs.push_back(std::make_unique<ExperienceOrb>(rewardPos));
+        for (int i = 0; i < Balance::BOSS_REWARD_ORBS; i++) {
+            spawnExperienceOrb(world, rewardPos);
         }
-        int materialCount = 15 + (wave / 3);
+        int materialCount = Balance::bossRewardDrops(wave);
         for (int i = 0; i < materialCount; i++) {
-            materials.push_back(std::make_unique<Material>(
-                rewardPos,
-                2 + (wave / 2),
-                3 + (wave / 2)
-            ));
+            spawnMaterial(world, rewardPos, Balance::bossRewardMaterialValue(wave), Balance::bossRewardExperience(wave));
         }
     } else {
         // Consolation: small materials to keep economy flowing
-        materialBag += std::max(3, wave / 2);
+        materialBag += Balance::bossConsolationMaterials(wave);
     }
 }
 
-void Game::spawnEnemies() {
+void Game::spawnEnemies(float deltaTime) {
     // Не спавним обычных врагов во время босс-волны
     if (isBossWave || isBossWaveIndex(wave)) return;
     
-    timeSinceLastSpawn += 0.016f;
-    
-    float spawnRate = 1.0f - (wave * 0.1f);
-    if (spawnRate < 0.2f) spawnRate = 0.2f;
+    timeSinceLastSpawn += deltaTime;
     
-    if (timeSinceLastSpawn >= spawnRate) {
+    if (timeSinceLastSpawn >= Balance::spawnInterval(wave)) {
         timeSinceLastSpawn = 0;
         
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
+        Pcg32& gen = Random::stream(RandomStream::SPAWNS);
         std::uniform_real_distribution<float> xdist(0.0f, static_cast<float>(WINDOW_WIDTH));
         std::uniform_real_distribution<float> ydist(0.0f, static_cast<float>(WINDOW_HEIGHT));
         std::uniform_real_distribution<float> slimeChance(0.0f, 1.0f);
@@ -1041,110 +1096,110 @@ void Game::spawnEnemies() {
         float telegraphDuration = spawnTelegraphSeconds; // configurable
         
         // Determine enemy type based on wave
-        EnemySpawnType enemyType = EnemySpawnType::BASE;
-        if (wave >= 2) {
-            // From wave 2: 40% slime, 40% pebblin, 20% base
-            float typeRoll = slimeChance(gen);
-            if (typeRoll < 0.4f) {
-                enemyType = EnemySpawnType::SLIME;
-            } else if (typeRoll < 0.8f) {
-                enemyType = EnemySpawnType::PEBBLIN;
-            }
-        } else {
-            // Wave 1: 50% slime, 50% base (no pebblin yet)
-            if (slimeChance(gen) < 0.5f) {
-                enemyType = EnemySpawnType::SLIME;
-            }
-        }
+        EnemySpawnType enemyType = Balance::spawnType(wave, slimeChance(gen));
         
-        spawnIndicators.emplace_back(spawnPos, telegraphDuration, enemyType);
+        addSpawnIndicator(spawnPos, telegraphDuration, enemyType);
     }
 }
 
-void Game::updateSpawnIndicators(float deltaTime) {
-    for (auto& indicator : spawnIndicators) {
-        indicator.elapsed += deltaTime;
-    }
-
-    // Spawn enemies for completed indicators, then remove them
-    std::vector<SpawnIndicator> remaining;
-    remaining.reserve(spawnIndicators.size());
-    for (auto& indicator : spawnIndicators) {
-        if (indicator.isComplete()) {
-            switch (indicator.enemyType) {
-                case EnemySpawnType::SLIME:
-                    enemies.push_back(CreateSlimeEnemy(indicator.position, renderer));
-                    break;
-                case EnemySpawnType::PEBBLIN:
-                    enemies.push_back(CreatePebblinEnemy(indicator.position, renderer));
-                    break;
-                case EnemySpawnType::BASE:
-                default:
-                    enemies.push_back(std::make_unique<Enemy>(indicator.position, renderer));
-                    break;
-            }
-        } else {
-            remaining.push_back(indicator);
+void Game::updateSpawnIndicators(float /*deltaTime*/) {
+    // Telegraphs are aged with the other lifetimes; spawn enemies for the completed ones
+    world.each<Transform, Lifetime, SpawnTelegraph>([&](Entity indicator, Transform& transform, Lifetime& lifetime,
+                                                        SpawnTelegraph& telegraph) {
+        if (!lifetime.expired()) return;
+        switch (telegraph.enemyType) {
+            case EnemySpawnType::SLIME:
+                enemies.spawn(EnemyType::SLIME, transform.position);
+                break;
+            case EnemySpawnType::PEBBLIN:
+                enemies.spawn(EnemyType::PEBBLIN, transform.position);
+                break;
+            case EnemySpawnType::BASE:
+            default:
+                enemies.spawn(EnemyType::BASE, transform.position);
+                break;
         }
-    }
-    spawnIndicators.swap(remaining);
+        world.destroy(indicator);
+    });
+}
+
+void Game::clearSpawnIndicators() {
+    world.each<SpawnTelegraph>([&](Entity indicator, SpawnTelegraph&) {
+        world.destroy(indicator);
+    });
 }
 
-void Game::renderSpawnIndicators() {
-    for (auto& indicator : spawnIndicators) {
+void Game::renderSpawnIndicators(RenderQueue& queue) {
+    world.each<Transform, Lifetime, SpawnTelegraph>([&](Entity, Transform& transform, Lifetime& lifetime, SpawnTelegraph&) {
+        if (!view.contains(transform.position, 15.0f)) return;
+        
+        if (!quality.telegraphBlink) {
+            // Low quality: steady X as two lines instead of a blinking point cloud
+            int cx = static_cast<int>(transform.position.x);
+            int cy = static_cast<int>(transform.position.y);
+            SDL_Point down[2] = {{cx - 14, cy - 14}, {cx + 14, cy + 14}};
+            SDL_Point up[2] = {{cx - 14, cy + 14}, {cx + 14, cy - 14}};
+            queue.lines(RenderLayer::SPAWN_INDICATORS, 0, down, 2, {200, 0, 0, 255});
+            queue.lines(RenderLayer::SPAWN_INDICATORS, 0, up, 2, {200, 0, 0, 255});
+            return;
+        }
+        
         // Flashing red X effect, fades in/out over duration
-        float t = indicator.elapsed;
+        float t = lifetime.age;
         float flash = fmodf(t * 6.0f, 2.0f) < 1.0f ? 255.0f : 80.0f; // blink ~3 Hz
         Uint8 alpha = static_cast<Uint8>(flash);
-        SDL_SetRenderDrawColor(renderer, 200, 0, 0, alpha);
 
-        int size = 14; // cross arm length
-        int cx = static_cast<int>(indicator.position.x);
-        int cy = static_cast<int>(indicator.position.y);
+        const int size = 14; // cross arm length
+        int cx = static_cast<int>(transform.position.x);
+        int cy = static_cast<int>(transform.position.y);
         // 4 short lines to make an X
+        SDL_Point cross[2 * (2 * size + 1)];
+        int n = 0;
         for (int i = -size; i <= size; ++i) {
-            SDL_RenderDrawPoint(renderer, cx + i, cy + i);
-            SDL_RenderDrawPoint(renderer, cx + i, cy - i);
+            cross[n++] = {cx + i, cy + i};
+            cross[n++] = {cx + i, cy - i};
         }
-    }
+        queue.points(RenderLayer::SPAWN_INDICATORS, 0, cross, n, {200, 0, 0, alpha});
+    });
 }
 
 void Game::checkCollisions() {
-    for (auto& bullet : bullets) {
-        if (!bullet->isAlive()) continue;
-        if (bullet->isEnemyOwned()) {
+    world.each<Transform, Collider, Projectile, TeamTag>([&](Entity bullet, Transform& transform, Collider& collider,
+                                                            Projectile& projectile, TeamTag& tag) {
+        const Vector2& bulletPos = transform.position;
+        if (tag.team == Team::ENEMY) {
             // enemy bullets damage the player (only during active wave)
             if (currentState == GameState::WAVE_ACTIVE) {
-                float d = bullet->getPosition().distance(player->getPosition());
-                if (d < bullet->getRadius() + player->getRadius()) {
-                    player->takeDamage(bullet->getDamage());
-                    bullet->destroy();
+                float d = bulletPos.distance(player->getPosition());
+                if (d < collider.radius + player->getRadius()) {
+                    player->takeDamage(projectile.damage);
+                    world.destroy(bullet);
                 }
             }
-            continue;
+            return;
         }
         
         // Проверяем попадание по боссу
         if (isBossWave && boss && boss->isAlive()) {
-            float distance = bullet->getPosition().distance(boss->getPosition());
-            if (distance < bullet->getRadius() + boss->getRadius()) {
-                bullet->destroy();
-                boss->takeDamage(bullet->getDamage());
+            float distance = bulletPos.distance(boss->getPosition());
+            if (distance < collider.radius + boss->getRadius()) {
+                world.destroy(bullet);
+                boss->takeDamage(projectile.damage);
             }
         }
         
         // Проверяем попадание по обычным врагам
-        for (auto& enemy : enemies) {
-            if (bullet->isAlive() && enemy->isAlive()) {
-                float distance = bullet->getPosition().distance(enemy->getPosition());
-                if (distance < bullet->getRadius() + enemy->getRadius()) {
-                    bullet->destroy();
-                    enemy->hit();
-                    enemy->destroy();
+        enemies.forEach([&](Enemy& enemy) {
+            if (world.isAlive(bullet) && enemy.isAlive()) {
+                float distance = bulletPos.distance(enemy.getPosition());
+                if (distance < collider.radius + enemy.getRadius()) {
+                    world.destroy(bullet);
+                    enemy.hit();
+                    enemy.destroy();
                 }
             }
-        }
-    }
+        });
+    });
     
     // Проверяем коллизию с боссом
     if (isBossWave && boss && boss->isAlive()) {
@@ -1156,15 +1211,15 @@ void Game::checkCollisions() {
     }
 
     // Проверяем коллизии с обычными врагами
-    for (auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            float distance = player->getPosition().distance(enemy->getPosition());
-            if (distance < player->getRadius() + enemy->getRadius()) {
-                player->takeDamage(enemy->getDamage());
-                enemy->destroy();
+    enemies.forEach([&](Enemy& enemy) {
+        if (enemy.isAlive()) {
+            float distance = player->getPosition().distance(enemy.getPosition());
+            if (distance < player->getRadius() + enemy.getRadius()) {
+                player->takeDamage(enemy.getDamage());
+                enemy.destroy();
             }
         }
-    }
+    });
 }
 
 void Game::checkMeleeAttacks() {
@@ -1179,13 +1234,12 @@ void Game::checkMeleeAttacks() {
             }
             
             // Calculate weapon tip position
-            Vector2 weaponTip = weapon->getWeaponTipPosition(player->getPosition(), player->getShootDirection());
+            Vector2 weaponTip = weapon->getWeaponTipPosition(player->getPosition(), player->getWeaponAim(i));
             float damageRadius = 25.0f; // Smaller damage radius at weapon tip
             int meleeDamage = weapon->calculateDamage(*player);
             
             // Check for critical hit
-            static std::random_device rd;
-            static std::mt19937 gen(rd());
+            Pcg32& gen = Random::stream(RandomStream::COMBAT);
             std::uniform_real_distribution<float> critRoll(0.0f, 1.0f);
             
             if (critRoll(gen) < weapon->getStats().critChance) {
@@ -1193,34 +1247,33 @@ void Game::checkMeleeAttacks() {
             }
             
             // Damage all enemies within damage radius of weapon tip (Brotato-style infinite pierce)
-            for (auto& enemy : enemies) {
-                if (enemy->isAlive()) {
-                    float distance = weaponTip.distance(enemy->getPosition());
-                    if (distance <= damageRadius + enemy->getRadius()) {
-                        enemy->hit();
-                        enemy->destroy();
+            enemies.forEach([&](Enemy& enemy) {
+                if (enemy.isAlive()) {
+                    float distance = weaponTip.distance(enemy.getPosition());
+                    if (distance <= damageRadius + enemy.getRadius()) {
+                        enemy.hit();
+                        enemy.destroy();
                         
                         // Create experience orb at enemy position
-                        experienceOrbs.push_back(std::make_unique<ExperienceOrb>(enemy->getPosition()));
+                        spawnExperienceOrb(world, enemy.getPosition());
                         
                         // Chance to drop materials
-                        static std::random_device matRd;
-                        static std::mt19937 matGen(matRd());
+                        Pcg32& matGen = Random::stream(RandomStream::DROPS);
                         std::uniform_real_distribution<float> matChance(0.0f, 1.0f);
                         
                         if (matChance(matGen) < getMaterialDropChance()) {
-                            materials.push_back(std::make_unique<Material>(enemy->getPosition()));
+                            spawnMaterial(world, enemy.getPosition());
                         }
                     }
                 }
-            }
+            });
         }
     }
 }
 
-void Game::handleItemInput(const Uint8* keyState) {
+void Game::handleItemInput(const PlayerInput& input) {
     // F key for healing box
-    if (keyState[SDL_SCANCODE_F]) {
+    if (input.useHealing) {
         if (!fKeyPressed) {
             // Find first healing box
             for (int i = 0; i < player->getItemCount(); i++) {
@@ -1238,7 +1291,7 @@ void Game::handleItemInput(const Uint8* keyState) {
     }
     
     // R key for bomb
-    if (keyState[SDL_SCANCODE_R]) {
+    if (input.useBomb) {
         if (!rKeyPressed) {
             // Find first bomb
             for (int i = 0; i < player->getItemCount(); i++) {
@@ -1257,37 +1310,15 @@ void Game::handleItemInput(const Uint8* keyState) {
 }
 
 void Game::addBomb(Vector2 position, float timer, float radius, int damage) {
-    auto b = std::make_unique<Bomb>(position, timer, radius, damage);
-    if (texMassBomb) {
-        b->setTexture(texMassBomb, false);
-    }
-    bombs.push_back(std::move(b));
-}
-
-void Game::updateBombs(float deltaTime) {
-    for (auto& bomb : bombs) {
-        bomb->update(deltaTime);
-    }
-    
-    // Remove dead bombs
-    bombs.erase(std::remove_if(bombs.begin(), bombs.end(),
-        [](const std::unique_ptr<Bomb>& bomb) {
-            return !bomb->isAlive();
-        }), bombs.end());
-}
-
-void Game::renderBombs() {
-    for (auto& bomb : bombs) {
-        bomb->render(renderer);
-    }
+    spawnBomb(world, position, timer, radius, damage, texMassBomb.get());
 }
 
 void Game::checkBombExplosions() {
-    for (auto& bomb : bombs) {
-        if (bomb->isExploded() && !bomb->hasAppliedDamage()) {
-            Vector2 bombPos = bomb->getPosition();
-            float bombRadius = bomb->getRadius();
-            int bombDamage = bomb->getDamage();
+    world.each<Transform, Collider, BombFuse>([&](Entity, Transform& transform, Collider& collider, BombFuse& fuse) {
+        if (fuse.exploded && !fuse.damageApplied) {
+            Vector2 bombPos = transform.position;
+            float bombRadius = collider.radius;
+            int bombDamage = fuse.damage;
             
             // Damage boss in radius (bombs do 20x damage to bosses)
             if (isBossWave && boss && boss->isAlive()) {
@@ -1298,30 +1329,41 @@ void Game::checkBombExplosions() {
             }
 
             // Damage enemies in radius
-            for (auto& enemy : enemies) {
-                if (enemy->isAlive()) {
-                    float distance = bombPos.distance(enemy->getPosition());
-                    if (distance <= bombRadius + enemy->getRadius()) {
+            enemies.forEach([&](Enemy& enemy) {
+                if (enemy.isAlive()) {
+                    float distance = bombPos.distance(enemy.getPosition());
+                    if (distance <= bombRadius + enemy.getRadius()) {
                         // Add enemy death particle effect - enemy-specific color, small amount, low duration/speed
-                        SDL_Color enemyColor = getEnemyParticleColor(enemy->getEnemyType());
-                        createParticleBurst(enemy->getPosition(), 8, 80.0f, 0.6f, enemyColor, 0.49f); // 0.7f * 0.7f = ~30% smaller
-                        enemy->hit();
-                        enemy->destroy();
+                        SDL_Color enemyColor = getEnemyParticleColor(enemy.getEnemyType());
+                        createParticleBurst(enemy.getPosition(), 8, 80.0f, 0.6f, enemyColor, 0.49f); // 0.7f * 0.7f = ~30% smaller
+                        enemy.hit();
+                        enemy.destroy();
                     }
                 }
-            }
+            });
 
             // Ensure we only apply damage once per explosion
-            bomb->markDamageApplied();
+            fuse.damageApplied = true;
         }
-    }
+    });
 }
 
 void Game::cleanup() {
-    if (starTexture) {
-        SDL_DestroyTexture(starTexture);
-        starTexture = nullptr;
+    // Nothing may simulate while the renderer and textures go away
+    pipeline.stop();
+    
+    if (drawRecorder) {
+        drawRecorder->save(options.captureDrawsPath);
+        drawRecorder.reset();
     }
+    // Releases cached text before the font and renderer go
+    backend = nullptr;
+    renderBackend.reset();
+    
+    renderScaler.shutdown();
+    
+    // Joins the decode workers and destroys every cached texture
+    assets.shutdown();
     
     if (defaultFont) {
         TTF_CloseFont(defaultFont);
@@ -1338,8 +1380,6 @@ void Game::cleanup() {
         window = nullptr;
     }
     
-    if (texHealingBox) { SDL_DestroyTexture(texHealingBox); texHealingBox = nullptr; }
-    if (texMassBomb) { SDL_DestroyTexture(texMassBomb); texMassBomb = nullptr; }
     TTF_Quit();
     IMG_Quit();
     SDL_Quit();
@@ -1359,10 +1399,153 @@ void Game::showGameOverMenu() {
 }
 
 void Game::restartGame() {
+    // Back to the snapshot taken at startup: nothing is reallocated or reloaded.
+    // Reseeded so the new run doesn't replay the old one
+    if (runStartSnapshot.empty()) {
+        resetRun();
+    } else if (restoreSnapshot(runStartSnapshot)) {
+        Random::seedAll(options.seed != 0 ? options.seed : std::random_device{}());
+    }
+    waveStartSnapshot = runStartSnapshot;
+    history.clear();
+}
+
+void Game::retryWave() {
+    if (waveStartSnapshot.empty()) return;
+    // A different timeline from here on
+    history.clear();
+    if (restoreSnapshot(waveStartSnapshot)) {
+        LOG_INFO(GAMEPLAY, "Retrying wave %d", wave);
+    }
+}
+
+void Game::saveWaveCheckpoint() {
+    waveCheckpointPending = false;
+    waveStartSnapshot = saveSnapshot();
+    LOG_DEBUG(CORE, "Wave %d snapshot: %llu bytes", wave,
+              static_cast<unsigned long long>(waveStartSnapshot.size()));
+    
+    if (options.checkpointWave == wave) {
+        char path[64];
+        std::snprintf(path, sizeof(path), "checkpoint-wave%d.sav", wave);
+        if (writeSnapshotFile(path, waveStartSnapshot)) {
+            LOG_INFO(CORE, "Saved checkpoint %s", path);
+        }
+    }
+}
+
+void Game::recordHistory() {
+    simulationTick++;
+    // Nothing moves behind a menu; don't spend history on it
+    if (simulationTick % HISTORY_INTERVAL_TICKS != 0 || menu->isMenuActive()) return;
+    SnapshotWriter out;
+    writeSnapshot(out);
+    history.push(simulationTick, out.finish(), out.getSegments());
+}
+
+void Game::rewindHistory() {
+    std::vector<uint8_t> blob;
+    uint64_t snapshotTick;
+    if (!history.rewind(simulationTick, blob, snapshotTick)) return;
+    
+    simulationPaused = true;
+    if (restoreSnapshot(blob)) {
+        simulationTick = snapshotTick;
+    }
+}
+
+std::vector<SDL_Texture*> Game::snapshotTextures() const {
+    // World sprites reference these by index; order is part of the snapshot format
+    return {starTexture.get(), texMassBomb.get()};
+}
+
+std::vector<uint8_t> Game::saveSnapshot() const {
+    SnapshotWriter out;
+    writeSnapshot(out);
+    return out.finish();
+}
+
+void Game::writeSnapshot(SnapshotWriter& out) const {
+    // Wave state machine
+    out.write(wave);
+    out.write(score);
+    out.write(waveTimer);
+    out.write(waveDuration);
+    out.write(waveActive);
+    out.write(materialBag);
+    out.write(timeSinceLastSpawn);
+    out.write(currentState);
+    out.write(stateTimer);
+    out.write(stateDuration);
+    out.write(isBossWave);
+    
+    for (int i = 0; i < RANDOM_STREAM_COUNT; i++) {
+        out.write(Random::stream(static_cast<RandomStream>(i)));
+    }
+    
+    player->save(out);
+    enemies.save(out);
+    out.write(boss != nullptr);
+    if (boss) {
+        boss->save(out);
+    }
+    world.save(out, snapshotTextures());
+    shop->save(out);
+}
+
+bool Game::restoreSnapshot(const std::vector<uint8_t>& blob) {
+    SnapshotReader in(blob.data(), blob.size());
+    
+    in.read(wave);
+    in.read(score);
+    in.read(waveTimer);
+    in.read(waveDuration);
+    in.read(waveActive);
+    in.read(materialBag);
+    in.read(timeSinceLastSpawn);
+    in.read(currentState);
+    in.read(stateTimer);
+    in.read(stateDuration);
+    in.read(isBossWave);
+    
+    for (int i = 0; i < RANDOM_STREAM_COUNT; i++) {
+        in.read(Random::stream(static_cast<RandomStream>(i)));
+    }
+    
+    bool loaded = player->load(in, weaponSprites);
+    enemies.load(in);
+    if (in.read<bool>()) {
+        // Same wave, same definition; load() then overwrites the fresh state
+        BossConfig config = makeBossConfig(wave);
+        boss = std::make_unique<BossEnemy>(Vector2(), bossSprite(config.texture), config);
+        loaded = boss->load(in) && loaded;
+    } else {
+        boss.reset();
+    }
+    loaded = world.load(in, snapshotTextures()) && loaded;
+    loaded = shop->load(in) && loaded;
+    
+    if (!loaded || !in.ok() || !in.atEnd()) {
+        // Half-restored state is worse than none
+        LOG_ERROR(CORE, "Snapshot could not be restored - starting a new run");
+        resetRun();
+        return false;
+    }
+    
+    // Not part of the simulation
+    waveCheckpointPending = false;
+    gameOverShown = false;
+    shopJustClosed = false;
+    menu->hideMenu();
+    return true;
+}
+
+void Game::resetRun() {
     // Full game reset
+    history.clear();
     wave = 1;
     waveTimer = 0;
-    waveDuration = 20.0f;
+    waveDuration = Balance::FIRST_WAVE_DURATION;
     waveActive = true;
     materialBag = 0;
     score = 0;
@@ -1380,20 +1563,16 @@ void Game::restartGame() {
     
     // Clear all game entities
     enemies.clear();
-    bullets.clear();
-    experienceOrbs.clear();
-    materials.clear();
-    bombs.clear();
-    particles.clear();
-    spawnIndicators.clear();
+    world.clear();
     
     // Reset player to starting state
     player = std::make_unique<Player>(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
-    player->initialize(renderer);
-    player->initializeWeapons(renderer);
+    player->initialize(assets);
+    player->initializeWeapons(assets);
     
     // Close shop and menu
     shop->closeShop();
+    waveArena.reset();
     menu->hideMenu();
 }
 
@@ -1413,38 +1592,37 @@ void Game::enterState(GameState newState) {
         case GameState::WAVE_COMPLETED:
             stateDuration = WAVE_COMPLETED_DURATION;
             // Add enemy-specific colored particle effects for enemies disappearing at wave end
-            for (auto& enemy : enemies) {
-                if (enemy->isAlive()) {
-                    SDL_Color enemyColor = getEnemyParticleColor(enemy->getEnemyType());
-                    createParticleBurst(enemy->getPosition(), 15, 120.0f, 1.0f, enemyColor, 0.63f); // 0.9f * 0.7f = ~30% smaller
+            enemies.forEach([&](Enemy& enemy) {
+                if (enemy.isAlive()) {
+                    SDL_Color enemyColor = getEnemyParticleColor(enemy.getEnemyType());
+                    // Hundreds at once late in the run; these give way to everything else
+                    createParticleBurst(enemy.getPosition(), 15, 120.0f, 1.0f, enemyColor, 0.63f, // 0.9f * 0.7f = ~30% smaller
+                                        ParticlePriority::AMBIENT);
                 }
-            }
+            });
             // Clear all enemies from the map
             enemies.clear();
             // Keep bullets on screen - don't clear them
             // Clear spawn indicators to prevent late spawns
-            spawnIndicators.clear();
+            clearSpawnIndicators();
             // Distribute bagged materials to player
             if (materialBag > 0) {
                 player->gainMaterials(materialBag);
-                std::cout << "Collected " << materialBag << " materials from bag!" << std::endl;
+                LOG_INFO(GAMEPLAY, "Collected %d materials from bag!", materialBag);
                 materialBag = 0;
             }
             // Increment wave number and prepare for next wave
             wave++;
             waveTimer = 0;
             // Increase wave duration for next wave
-            if (waveDuration < 60.0f) {
-                waveDuration += 5.0f;
-                if (waveDuration > 60.0f) waveDuration = 60.0f;
-            }
-            std::cout << "Wave " << wave - 1 << " completed!" << std::endl;
+            waveDuration = Balance::nextWaveDuration(waveDuration);
+            LOG_INFO(GAMEPLAY, "Wave %d completed!", wave - 1);
             break;
             
         case GameState::SHOP_ACTIVE:
             stateDuration = 0.0f; // Indefinite until player closes shop
             shop->openShop(wave);
-            std::cout << "Shop opened after wave " << wave << std::endl;
+            LOG_INFO(GAMEPLAY, "Shop opened after wave %d", wave);
             break;
             
         case GameState::SHOP_CLOSING:
@@ -1454,18 +1632,22 @@ void Game::enterState(GameState newState) {
             
         case GameState::WAVE_STARTING:
             stateDuration = WAVE_STARTING_DURATION;
+            // The shop closed in SHOP_CLOSING; its wave data can go
+            waveArena.reset();
             // Reset spawn timer
             timeSinceLastSpawn = 0;
             // Reload all weapons at wave start
             if (player) {
                 player->reloadAllWeapons();
             }
-            std::cout << "Wave " << wave << " starting..." << std::endl;
+            // Retry point for this wave, taken once the tick finishes
+            waveCheckpointPending = true;
+            LOG_INFO(GAMEPLAY, "Wave %d starting...", wave);
             break;
             
         case GameState::WAVE_ACTIVE:
             stateDuration = 0.0f; // Indefinite until wave completes
-            std::cout << "Wave " << wave << " active!" << std::endl;
+            LOG_INFO(GAMEPLAY, "Wave %d active!", wave);
             break;
     }
 }
@@ -1506,7 +1688,7 @@ void Game::updateState(float deltaTime) {
     }
 }
 
-void Game::renderStateUI() {
+void Game::renderStateUI(DrawList& list) {
     if (currentState == GameState::WAVE_ACTIVE || currentState == GameState::SHOP_ACTIVE) {
         return; // No special state UI during active gameplay or shop
     }
@@ -1519,10 +1701,10 @@ void Game::renderStateUI() {
     
     switch (currentState) {
         case GameState::WAVE_COMPLETED: {
-            std::string message = "WAVE " + std::to_string(wave - 1) + " COMPLETED!";
+            const char* message = frameArena.format("WAVE %d COMPLETED!", wave - 1);
             // Draw text with black outline for better visibility
-            renderTTFText(message.c_str(), centerX - 149, centerY - 19, black, 36); // Shadow
-            renderTTFText(message.c_str(), centerX - 150, centerY - 20, white, 36); // Main text
+            list.text(message, centerX - 149, centerY - 19, black, 36); // Shadow
+            list.text(message, centerX - 150, centerY - 20, white, 36); // Main text
             break;
         }
             
@@ -1531,7 +1713,7 @@ void Game::renderStateUI() {
             break;
             
         case GameState::WAVE_STARTING: {
-            std::string message;
+            const char* message;
             if (isBossWaveIndex(wave)) {
                 // For boss waves, show the boss name
                 if (boss) {
@@ -1540,10 +1722,10 @@ void Game::renderStateUI() {
                     message = "BOSS WAVE STARTING...";
                 }
             } else {
-                message = "WAVE " + std::to_string(wave) + " STARTING...";
+                message = frameArena.format("WAVE %d STARTING...", wave);
             }
-            renderTTFText(message.c_str(), centerX - 149, centerY - 9, black, 32); // Shadow
-            renderTTFText(message.c_str(), centerX - 150, centerY - 10, white, 32); // Main text
+            list.text(message, centerX - 149, centerY - 9, black, 32); // Shadow
+            list.text(message, centerX - 150, centerY - 10, white, 32); // Main text
             break;
         }
         
@@ -1569,29 +1751,29 @@ SDL_Color Game::getEnemyParticleColor(EnemyType enemyType) {
 }
 
 void Game::updateParticles(float deltaTime) {
-    for (auto& particle : particles) {
-        particle->update(deltaTime);
-    }
-}
-
-void Game::renderParticles() {
-    if (!starTexture) return;
-    
-    for (auto& particle : particles) {
-        if (particle->isAlive()) {
-            particle->render(renderer, starTexture);
+    // Cosmetic entities only; gameplay entities stay frozen while paused or dead
+    const ComponentMask cosmetic = componentMask<Cosmetic>();
+    moveEntities(world, deltaTime, cosmetic);
+    ageLifetimes(world, deltaTime, cosmetic);
+    // Particles only fly outward, so one that left the view is never seen again
+    world.each<Transform, Lifetime>([&](Entity particle, Transform& transform, Lifetime& lifetime) {
+        if (lifetime.expired() || !view.contains(transform.position, PARTICLE_CULL_MARGIN)) {
+            world.destroy(particle);
         }
-    }
+    }, cosmetic);
 }
 
 void Game::createParticleBurst(Vector2 position, int particleCount, float particleSpeed,
-                              float normalDuration, SDL_Color color, float scale) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+                              float normalDuration, SDL_Color color, float scale,
+                              ParticlePriority priority) {
+    ParticleBudget::Burst burst = particleBudget.plan(priority, particleCount, scale);
+    scale = burst.scale;
+    
+    Pcg32& gen = Random::stream(RandomStream::EFFECTS);
     std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * M_PI);
     std::uniform_real_distribution<float> speedVariation(0.8f, 1.2f);
     
-    for (int i = 0; i < particleCount; ++i) {
+    for (int i = 0; i < burst.count; ++i) {
         // Random direction (360 degrees)
         float angle = angleDist(gen);
         float speed = particleSpeed * speedVariation(gen);
@@ -1601,15 +1783,13 @@ void Game::createParticleBurst(Vector2 position, int particleCount, float partic
             std::sin(angle) * speed
         );
         
-        particles.push_back(std::make_unique<Particle>(
-            position, velocity, normalDuration, color, scale
-        ));
+        spawnParticle(world, position, velocity, normalDuration, color, starTexture.get(), scale);
     }
 }
 
 void Game::createExplosionEffect(Vector2 position, SDL_Color color) {
     // Large burst with high-speed particles
-    createParticleBurst(position, 50, 200.0f, 1.5f, color, 1.0f);
+    createParticleBurst(position, 50, 200.0f, 1.5f, color, 1.0f, ParticlePriority::HIGH);
 }
 
 void Game::createDeathEffect(Vector2 position, SDL_Color color) {
@@ -1619,5 +1799,5 @@ void Game::createDeathEffect(Vector2 position, SDL_Color color) {
 
 void Game::createImpactEffect(Vector2 position, SDL_Color color) {
     // Small burst with low-speed particles
-    createParticleBurst(position, 15, 100.0f, 0.5f, color, 0.6f);
+    createParticleBurst(position, 15, 100.0f, 0.5f, color, 0.6f, ParticlePriority::HIGH);
 }
\ No newline at end of file
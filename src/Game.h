@@ -3,6 +3,8 @@
 #include <SDL2/SDL_ttf.h>
 #include <vector>
 #include <memory>
+#include <map>
+#include <string>
 #include "Player.h"
 #include "Enemy.h"
 #include "Bullet.h"
@@ -14,18 +16,26 @@
 #include "Menu.h"
 #include "Particle.h"
 #include "Item.h"
+#include "World.h"
+#include "GameOptions.h"
+#include "RenderScaler.h"
+#include "RenderQueue.h"
+#include "RenderFrame.h"
+#include "FramePipeline.h"
+#include "RenderBackend.h"
+#include "RecordingRenderBackend.h"
+#include "Arena.h"
+#include "Balance.h"
+#include "Autopilot.h"
+#include "Targeting.h"
+#include "SnapshotHistory.h"
+#include "AssetLoader.h"
+#include "StartupTimeline.h"
+#include "QualityGovernor.h"
 
 // Forward declarations
-class SlimeEnemy;
-class PebblinEnemy;
 class BossEnemy;
 
-enum class EnemySpawnType {
-    BASE,
-    SLIME,
-    PEBBLIN
-};
-
 enum class GameState {
     WAVE_ACTIVE,        // Normal wave gameplay
     WAVE_COMPLETED,     // Wave just ended, showing completion message
@@ -34,37 +44,23 @@ enum class GameState {
     WAVE_STARTING       // Brief pause before next wave begins
 };
 
-struct SpawnIndicator {
-    Vector2 position;
-    float elapsed;
-    float duration; // seconds
-    EnemySpawnType enemyType;
-    
-    SpawnIndicator(const Vector2& pos, float dur, EnemySpawnType type)
-        : position(pos), elapsed(0.0f), duration(dur), enemyType(type) {}
-    
-    bool isComplete() const { return elapsed >= duration; }
-};
-
 class Game {
 public:
-    Game();
+    explicit Game(const GameOptions& options = GameOptions());
     ~Game();
     
     bool init();
     void run();
     void cleanup();
+    int getExitCode() const { return exitCode; }
     
-    void renderNumber(int number, int x, int y, int scale = 1);
-    void renderText(const char* text, int x, int y, int scale = 1);
-    void renderTTFText(const char* text, int x, int y, SDL_Color color, int fontSize = 16);
     int getPlayerMaterials() const { return player ? player->getStats().materials : 0; }
     const Player* getPlayer() const { return player.get(); }
-    SDL_Renderer* getRenderer() const { return renderer; }
+    AssetLoader& getAssets() { return assets; }
     SDL_Texture* getItemIcon(ItemType type) const {
         switch (type) {
-            case ItemType::HEALING_BOX: return texHealingBox;
-            case ItemType::MASS_BOMB: return texMassBomb;
+            case ItemType::HEALING_BOX: return texHealingBox.get();
+            case ItemType::MASS_BOMB: return texMassBomb.get();
         }
         return nullptr;
     }
@@ -72,15 +68,17 @@ public:
     // Bomb management (public for item usage)
     void addBomb(Vector2 position, float timer, float radius, int damage);
     void addBullet(const Vector2& pos, const Vector2& vel, int dmg, bool isEnemy = false) {
-        bullets.push_back(std::make_unique<Bullet>(pos, vel, dmg, isEnemy));
+        spawnBullet(world, pos, vel, dmg, 200.0f, vel.length(), BulletType::PISTOL, isEnemy);
     }
     void addSpawnIndicator(const Vector2& pos, float duration, EnemySpawnType type) {
-        spawnIndicators.emplace_back(pos, duration, type);
+        spawnEnemyTelegraph(world, pos, duration, type);
     }
     
     // Particle system (public for effect creation)
+    // particleCount is what the effect asks for; the particle budget may spawn fewer, larger ones
     void createParticleBurst(Vector2 position, int particleCount, float particleSpeed,
-                            float normalDuration, SDL_Color color, float scale = 1.0f);
+                            float normalDuration, SDL_Color color, float scale = 1.0f,
+                            ParticlePriority priority = ParticlePriority::NORMAL);
     void createExplosionEffect(Vector2 position, SDL_Color color = {255, 255, 255, 255});
     void createDeathEffect(Vector2 position, SDL_Color color = {255, 0, 0, 255});
     void createImpactEffect(Vector2 position, SDL_Color color = {255, 255, 0, 255});
@@ -92,51 +90,127 @@ public:
     void exitGame();
     bool isGamePaused() const;
     
+    // Whole-run snapshots (Snapshot.h): player, enemies, boss, world, shop, wave
+    // state and RNG streams. Restoring swaps the run in place without touching
+    // the asset loader; a blob that fails to restore starts a fresh run instead
+    std::vector<uint8_t> saveSnapshot() const;
+    void writeSnapshot(SnapshotWriter& out) const;
+    bool restoreSnapshot(const std::vector<uint8_t>& blob);
+    // Back to the start of the current wave (F9)
+    void retryWave();
+    
 private:
-    void handleEvents();
+    // Frame loop (FramePipeline.h). The main thread polls input, draws and owns
+    // every SDL call; simulateFrame() runs on the simulation thread, or inline
+    // with --single-thread
+    FrameInput pollInput();
+    void simulateFrame(const FrameInput& input, RenderFrame& frame);
+    void applyInput(const FrameInput& input);
+    void handleDebugKeys(const Uint8* keyState);
+    // F8: vsync -> target fps -> uncapped; main thread only, it owns the renderer
+    void cyclePacingMode();
+    // Pushes the governor's current tier out to particles, menus and resolution
+    void applyQuality();
+    // One simulation step: update, entity flush, snapshot bookkeeping
+    void tick(float deltaTime);
     void update(float deltaTime);
-    void render();
-    void spawnEnemies();
+    // World pass and UI into a frame's command lists; touches no SDL state
+    void recordFrame(RenderFrame& frame);
+    // Hands a recorded frame to the render backend and presents it
+    void drawFrame(RenderFrame& frame);
+    void spawnEnemies(float deltaTime);
     void updateSpawnIndicators(float deltaTime);
-    void renderSpawnIndicators();
+    void renderSpawnIndicators(RenderQueue& queue);
+    void clearSpawnIndicators();
     void checkCollisions();
     void checkMeleeAttacks();
     void updateExperienceCollection();
+    void retireExpiredEntities();
     
     // Bomb management (private internal methods)
-    void updateBombs(float deltaTime);
-    void renderBombs();
     void checkBombExplosions();
     
     // Particle system (private internal methods)
     void updateParticles(float deltaTime);
-    void renderParticles();
+    static constexpr float PARTICLE_CULL_MARGIN = 64.0f; // Larger than any particle sprite's half-size
     SDL_Color getEnemyParticleColor(EnemyType enemyType);
     
-    // Item input handling
-    void handleItemInput(const Uint8* keyState);
+    // Player controls: keyboard and mouse, or the autopilot
+    void applyPlayerInput(const PlayerInput& input);
+    void updateAutopilot();
+    void handleItemInput(const PlayerInput& input);
     void updateMaterialCollection();
     float getMaterialDropChance() const;
-    void renderUI();
-    SDL_Texture* loadTexture(const char* path);
+    void renderUI(DrawList& list);
+    void requestDeferredAssets();
+    void updateStartupReport();
+    
+    // Snapshot support
+    void resetRun();
+    void saveWaveCheckpoint();
+    void recordHistory();
+    void rewindHistory();
+    void renderDebugPlaybackUI(DrawList& list);
+    std::vector<SDL_Texture*> snapshotTextures() const;
+    TextureHandle bossSprite(const char* path);
     
     // Wave transition state machine
     void enterState(GameState newState);
     void updateState(float deltaTime);
-    void renderStateUI();
+    void renderStateUI(DrawList& list);
+    
+    // Declared first so it starts timing before anything else is constructed
+    StartupTimeline startupTimeline;
+    bool deferredAssetsRequested = false;
+    bool startupReported = false;
+    int exitCode = 0;
     
     SDL_Window* window;
     SDL_Renderer* renderer;
     bool running;
     
+    // Logical-resolution rendering (world offscreen target + native-resolution UI)
+    GameOptions options;
+    RenderScaler renderScaler;
+    // Executes recorded frames: SDL, or nothing (--renderer=null), optionally
+    // through the draw recorder (--capture-draws)
+    std::unique_ptr<RenderBackend> renderBackend;
+    std::unique_ptr<RecordingRenderBackend> drawRecorder;
+    RenderBackend* backend = nullptr;
+    // Simulation one frame ahead of drawing; serialFrame is used with --single-thread
+    FramePipeline pipeline;
+    RenderFrame serialFrame;
+    Uint64 lastSimulationTime = 0; // Performance counter
+    
+    // Waits out the rest of each frame (--pacing); main thread only
+    FramePacer framePacer;
+    
+    // Adaptive quality (--quality). Tiers change only at the frame sync point;
+    // `quality` is what recording and drawing use until the next change
+    QualityGovernor qualityGovernor;
+    QualitySettings quality = QualityGovernor::tierSettings(0);
+    float lastDrawMs = 0.0f;
+    float lastPresentMs = 0.0f;  // Under vsync mostly waiting for the display
+    // Visible logical rectangle, taken from each frame's input; render and bullet bounds cull against it
+    Viewport view = {0.0f, 0.0f, static_cast<float>(LOGICAL_WIDTH), static_cast<float>(LOGICAL_HEIGHT)};
+    
+    // Scratch memory for transient data: HUD strings, per-frame lists (reset every
+    // frame) and shop contents (reset when a new wave starts). Declared before the
+    // shop so they outlive it
+    Arena frameArena{"frame", 64 * 1024};
+    Arena waveArena{"wave", 16 * 1024};
+    
+    // Background texture loading; declared before the entities that hold its handles
+    AssetLoader assets;
+    static const int MAX_TEXTURE_UPLOADS_PER_FRAME = 4;
+    
     std::unique_ptr<Player> player;
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::vector<std::unique_ptr<Bullet>> bullets;
-    std::vector<SpawnIndicator> spawnIndicators;
-    std::vector<std::unique_ptr<ExperienceOrb>> experienceOrbs;
-    std::vector<std::unique_ptr<Material>> materials;
-    std::vector<std::unique_ptr<Bomb>> bombs;
-    std::vector<std::unique_ptr<Particle>> particles;
+    EnemyBatches enemies;
+    // Enemy positions binned once per tick for weapon auto-aim
+    Targeting targeting;
+    
+    // Bullets, pickups, bombs, particles and spawn telegraphs
+    World world;
     
     float timeSinceLastSpawn;
     
@@ -164,29 +238,54 @@ private:
     std::unique_ptr<Menu> menu;
     bool gameOverShown; // Flag to prevent repeated game over menu calls
     
+    // Snapshots taken when the run and the current wave started. The wave one is
+    // taken between ticks once WAVE_STARTING has been entered
+    std::vector<uint8_t> runStartSnapshot;
+    std::vector<uint8_t> waveStartSnapshot;
+    bool waveCheckpointPending = false;
+    bool retryKeyPressed = false;
+    
+    // Debug playback: F5 pauses the simulation, F6 steps one tick while paused and
+    // F7 (held) rewinds through a rolling history snapshotted every few ticks
+    SnapshotHistory history;
+    uint64_t simulationTick = 0;
+    bool simulationPaused = false;
+    bool stepRequested = false;
+    bool pauseKeyPressed = false;
+    bool stepKeyPressed = false;
+    static const int HISTORY_INTERVAL_TICKS = 6;
+    static constexpr float STEP_SECONDS = 1.0f / 60.0f;
+    
+    // Unattended play (--autopilot); null when a person is at the keyboard
+    std::unique_ptr<Autopilot> autopilot;
+    
     // TTF Font system
     TTF_Font* defaultFont;
     
     // Particle system
-    SDL_Texture* starTexture;
+    TextureHandle starTexture;
+    ParticleBudget particleBudget;
 
     // Item icons for UI and bombs
-    SDL_Texture* texHealingBox = nullptr;
-    SDL_Texture* texMassBomb = nullptr;
+    TextureHandle texHealingBox;
+    TextureHandle texMassBomb;
+    
+    // Sprites for anything a snapshot can rebuild, requested with the deferred assets
+    WeaponSprites weaponSprites;
+    std::map<std::string, TextureHandle> bossSprites;
     
     // Telegraph duration for spawn indicators (seconds)
     float spawnTelegraphSeconds = 2.0f;
     
-    static const int WINDOW_WIDTH = 1920;
-    static const int WINDOW_HEIGHT = 1080;
-    static const int BOSS_WAVE_INTERVAL = 3;
+    static const int WINDOW_WIDTH = LOGICAL_WIDTH;
+    static const int WINDOW_HEIGHT = LOGICAL_HEIGHT;
 
     // Boss wave system
     bool isBossWave = false;
     std::unique_ptr<BossEnemy> boss;
     void startBossWave(int waveIndex);
     void endBossWave(bool bossDefeated);
-    bool isBossWaveIndex(int wave) const { return wave > 0 && (wave % BOSS_WAVE_INTERVAL) == 0; }
+    bool isBossWaveIndex(int wave) const { return Balance::isBossWave(wave); }
     
     // Wave transition state machine
     GameState currentState;
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "Targeting.h"
+#include "RenderBackend.h"
+#include "FramePacer.h"
+
+// Command-line tunables. Parsed in main.cpp and handed to Game before init().
+struct GameOptions {
+    // Internal world resolution as a fraction of the 1920x1080 logical size
+    float renderScale = 1.0f;
+
+    // Lower the internal resolution automatically when frames run over budget
+    bool dynamicResolution = false;
+    float frameBudgetMs = 16.6f;
+
+    // Packed asset archive built by asset_packer; loose files are used when it's missing
+    std::string assetPack = "assets.pak";
+
+    // Exit after the startup report, failing (exit code 1) if the first frame took longer than the budget
+    bool startupBenchmark = false;
+    float startupBudgetMs = 1000.0f;
+
+    // Weapon aiming: at the mouse, or auto-aim at the nearest enemy in each weapon's range
+    AimMode aimMode = AimMode::NEAREST;
+
+    // Unattended play for soak tests and late-game benchmarks. The session ends after
+    // autopilotWaves waves (exit code 0) or when the player dies (exit code 1)
+    bool autopilot = false;
+    int autopilotWaves = 20;
+
+    // Simulation steps per presented frame; above 1 the game runs that many times faster
+    int timeScale = 1;
+
+    // Seed for every gameplay RNG stream (0 = random). Same seed and inputs, same run
+    uint64_t seed = 0;
+
+    // Snapshots: write checkpoint-wave<n>.sav when wave n starts (0 = never), and/or
+    // start from a saved snapshot instead of wave 1
+    int checkpointWave = 0;
+    std::string loadCheckpoint;
+
+    // Memory for the in-game rewind history (F7), in MB; 0 disables it
+    int rewindBudgetMb = 8;
+
+    // How the main loop waits between frames. Vsync needs the SDL renderer and a
+    // driver that supports it; otherwise the game paces to targetFps instead
+    PacingMode pacing = PacingMode::VSYNC;
+    int targetFps = 60;
+
+    // Quality tier 0 (full) to 5 (lowest); -1 adapts to the frame budget
+    int qualityTier = -1;
+
+    // Most particles alive at once (0 = unlimited); shrinks further while frames run over frameBudgetMs
+    int particleBudget = 2000;
+
+    // Simulate the next frame on a worker thread while the main thread draws this one;
+    // off runs both on the main thread, one after the other
+    bool simulationThread = true;
+    
+    // What draws the frames: SDL, the CPU rasterizer, or nothing. The window stays
+    // hidden for the last two, so headless benchmarks don't need a display
+    RenderBackendType renderBackend = RenderBackendType::SDL;
+    // Software renderer only: write every saveFramesInterval-th frame as a PNG into this directory
+    std::string saveFramesPath;
+    int saveFramesInterval = 60;
+    // Record every frame's draw commands and write a text capture here on exit (empty = off)
+    std::string captureDrawsPath;
+};
@@ -1,7 +1,8 @@
 #include "Item.h"
 #include "Player.h"
 #include "Game.h"
-#include <sstream>
+#include "Snapshot.h"
+#include "Definitions.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 
@@ -9,6 +10,40 @@ Item::Item(ItemType type, int power, int price)
     : type(type), power(power), price(price), itemTexture(nullptr) {
 }
 
+std::string Item::getName() const {
+    return Defs::text(Defs::item(type).name);
+}
+
+std::string Item::getDescription() const {
+    char description[96];
+    Defs::describeItem(type, power, description, sizeof(description));
+    return description;
+}
+
+void Item::save(SnapshotWriter& out) const {
+    out.write(type);
+    out.write(power);
+    out.write(price);
+    saveExtra(out);
+}
+
+std::unique_ptr<Item> Item::load(SnapshotReader& in) {
+    ItemType type = in.read<ItemType>();
+    int power = in.read<int>();
+    int price = in.read<int>();
+    switch (type) {
+        case ItemType::HEALING_BOX:
+            return std::make_unique<HealingBox>(power, price);
+        case ItemType::MASS_BOMB: {
+            float timer = in.read<float>();
+            float radius = in.read<float>();
+            return std::make_unique<MassBomb>(power, timer, radius, price);
+        }
+    }
+    in.fail();
+    return nullptr;
+}
+
 // HealingBox Implementation
 HealingBox::HealingBox(int healAmount, int cost)
     : Item(ItemType::HEALING_BOX, healAmount, cost) {
@@ -19,25 +54,18 @@ bool HealingBox::use(Player& player, Game& game) {
     return true; // Item consumed
 }
 
-std::string HealingBox::getDescription() const {
-    std::stringstream ss;
-    ss << "Restores " << power << " health";
-    return ss.str();
-}
-
 // MassBomb Implementation
 MassBomb::MassBomb(int damage, float timer, float radius, int cost)
     : Item(ItemType::MASS_BOMB, damage, cost), timer(timer), radius(radius) {
 }
 
+void MassBomb::saveExtra(SnapshotWriter& out) const {
+    out.write(timer);
+    out.write(radius);
+}
+
 bool MassBomb::use(Player& player, Game& game) {
     Vector2 position = player.getPosition();
     game.addBomb(position, timer, radius, power);
     return true; // Item consumed
 }
-
-std::string MassBomb::getDescription() const {
-    std::stringstream ss;
-    ss << "Deals " << power << " damage\nRadius: " << radius;
-    return ss.str();
-}
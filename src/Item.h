@@ -1,32 +1,44 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_image.h>
 #include <string>
 #include <memory>
 #include "Vector2.h"
 
 class Player;
 class Game;
+class SnapshotWriter;
+class SnapshotReader;
 
+// Behaviour lives in the subclasses below; names, descriptions, icons and bomb
+// tuning come from data/items.def, one section per type in enum order
 enum class ItemType {
     HEALING_BOX,
     MASS_BOMB
 };
 
+static const int ITEM_TYPE_COUNT = 2;
+
 class Item {
 public:
     Item(ItemType type, int power, int price);
     virtual ~Item() = default;
     
     virtual bool use(Player& player, Game& game) = 0;
-    virtual std::string getName() const = 0;
-    virtual std::string getDescription() const = 0;
+    std::string getName() const;
+    std::string getDescription() const;
     
     ItemType getType() const { return type; }
     int getPower() const { return power; }
     int getPrice() const { return price; }
     
+    // Snapshots: type, power and price, then whatever the subclass adds
+    void save(SnapshotWriter& out) const;
+    static std::unique_ptr<Item> load(SnapshotReader& in);
+    
 protected:
+    virtual void saveExtra(SnapshotWriter&) const {}
+    
+
     ItemType type;
     int power;    // healing amount or bomb damage
     int price;    // shop cost
@@ -37,16 +49,15 @@ class HealingBox : public Item {
 public:
     HealingBox(int healAmount, int cost);
     bool use(Player& player, Game& game) override;
-    std::string getName() const override { return "HEALING BOX"; }
-    std::string getDescription() const override;
 };
 
 class MassBomb : public Item {
 public:
     MassBomb(int damage, float timer, float radius, int cost);
     bool use(Player& player, Game& game) override;
-    std::string getName() const override { return "MASS BOMB"; }
-    std::string getDescription() const override;
+    
+protected:
+    void saveExtra(SnapshotWriter& out) const override;
     
 private:
     float timer;
@@ -0,0 +1,210 @@
+#include "Log.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace log_detail {
+    std::atomic<uint8_t> minLevel{static_cast<uint8_t>(LogLevel::INFO)};
+    std::atomic<uint32_t> categoryMask{(1u << LOG_CATEGORY_COUNT) - 1};
+}
+
+namespace {
+    const size_t RING_CAPACITY = 1024; // Power of two
+    const size_t RING_MASK = RING_CAPACITY - 1;
+    const size_t SLOT_TEXT = 232;      // Longer messages are truncated
+
+    const char* LEVEL_NAMES[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+    const char* CATEGORY_NAMES[LOG_CATEGORY_COUNT] = {"core", "assets", "render", "gameplay", "shop"};
+
+    // Bounded multi-producer queue (per-slot sequence numbers, Vyukov style).
+    // A slot is free for position p when sequence == p and holds a message
+    // for p when sequence == p + 1.
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        LogCategory category;
+        float seconds;
+        char text[SLOT_TEXT];
+    };
+
+    Slot ring[RING_CAPACITY];
+    std::atomic<size_t> enqueuePos{0};
+    size_t dequeuePos = 0; // Writer thread only
+
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> dropped{0};
+    std::thread writer;
+    const auto startTime = std::chrono::steady_clock::now();
+
+    float secondsSinceStart() {
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    void appendLine(std::string& out, float seconds, LogLevel level, LogCategory category, const char* text) {
+        char prefix[48];
+        std::snprintf(prefix, sizeof(prefix), "[%9.3f] %-5s %-8s ", seconds,
+                      LEVEL_NAMES[static_cast<int>(level)], CATEGORY_NAMES[static_cast<int>(category)]);
+        out += prefix;
+        out += text;
+        out += '\n';
+    }
+
+    void writeDirect(LogLevel level, LogCategory category, const char* format, va_list args) {
+        char text[SLOT_TEXT];
+        std::vsnprintf(text, sizeof(text), format, args);
+        std::string line;
+        appendLine(line, secondsSinceStart(), level, category, text);
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        std::fflush(stdout);
+    }
+
+    // Writer thread side: moves every ready message into `out`
+    bool drain(std::string& out) {
+        bool any = false;
+        for (;;) {
+            Slot& slot = ring[dequeuePos & RING_MASK];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1) break;
+            appendLine(out, slot.seconds, slot.level, slot.category, slot.text);
+            slot.sequence.store(dequeuePos + RING_CAPACITY, std::memory_order_release);
+            dequeuePos++;
+            any = true;
+        }
+        return any;
+    }
+
+    void writerLoop() {
+        std::string batch;
+        batch.reserve(16 * 1024);
+        uint64_t reportedDrops = 0;
+        for (;;) {
+            bool stopping = !running.load(std::memory_order_acquire);
+            bool wrote = drain(batch);
+
+            uint64_t drops = dropped.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                char text[64];
+                std::snprintf(text, sizeof(text), "%llu log message(s) dropped, ring full",
+                              static_cast<unsigned long long>(drops - reportedDrops));
+                appendLine(batch, secondsSinceStart(), LogLevel::WARN, LogCategory::CORE, text);
+                reportedDrops = drops;
+            }
+
+            if (!batch.empty()) {
+                std::fwrite(batch.data(), 1, batch.size(), stdout);
+                std::fflush(stdout);
+                batch.clear();
+            }
+            if (stopping) break;
+            if (!wrote) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+    }
+}
+
+namespace Log {
+    void start() {
+        if (running.exchange(true)) return;
+        for (size_t i = 0; i < RING_CAPACITY; i++) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos = 0;
+        dropped.store(0, std::memory_order_relaxed);
+        writer = std::thread(writerLoop);
+    }
+
+    void shutdown() {
+        if (!running.exchange(false)) return;
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
+
+    void setLevel(LogLevel level) {
+        log_detail::minLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+    }
+
+    void setCategoryEnabled(LogCategory category, bool enabled) {
+        uint32_t bit = 1u << static_cast<unsigned>(category);
+        if (enabled) {
+            log_detail::categoryMask.fetch_or(bit, std::memory_order_relaxed);
+        } else {
+            log_detail::categoryMask.fetch_and(~bit, std::memory_order_relaxed);
+        }
+    }
+
+    void setAllCategoriesEnabled(bool enabled) {
+        log_detail::categoryMask.store(enabled ? (1u << LOG_CATEGORY_COUNT) - 1 : 0u, std::memory_order_relaxed);
+    }
+
+    void write(LogLevel level, LogCategory category, const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+
+        if (!running.load(std::memory_order_acquire)) {
+            // No writer thread: print directly
+            writeDirect(level, category, format, args);
+            va_end(args);
+            return;
+        }
+
+        // Claim a slot; never wait for the writer
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &ring[pos & RING_MASK];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // Full. Warnings and errors are rare and matter, so they bypass the ring
+                if (level >= LogLevel::WARN) {
+                    writeDirect(level, category, format, args);
+                } else {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                va_end(args);
+                return;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->category = category;
+        slot->seconds = secondsSinceStart();
+        std::vsnprintf(slot->text, SLOT_TEXT, format, args);
+        va_end(args);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    bool parseLevel(const char* name, LogLevel& level) {
+        static const char* const names[] = {"debug", "info", "warn", "error"};
+        for (int i = 0; i < 4; i++) {
+            if (std::strcmp(name, names[i]) == 0) {
+                level = static_cast<LogLevel>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool parseCategory(const char* name, LogCategory& category) {
+        for (int i = 0; i < LOG_CATEGORY_COUNT; i++) {
+            if (std::strcmp(name, CATEGORY_NAMES[i]) == 0) {
+                category = static_cast<LogCategory>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint64_t droppedCount() {
+        return dropped.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Asynchronous logger. A log call formats straight into a preallocated slot of
+// a lock-free ring buffer and returns; a background thread does the terminal
+// I/O. When the ring is full the message is dropped (and counted) rather than
+// stalling the caller. Before start() and after shutdown() messages are
+// written synchronously, so nothing logged during startup or teardown is lost.
+//
+// Use the macros: LOG_INFO(GAMEPLAY, "Level up! Now level %d", level);
+// Level and category are checked before any formatting happens.
+
+enum class LogLevel : uint8_t {
+    DEBUG,
+    INFO,
+    WARN,
+    ERR   // Not ERROR: windows.h defines that as a macro
+};
+
+enum class LogCategory : uint8_t {
+    CORE,
+    ASSETS,
+    RENDER,
+    GAMEPLAY,
+    SHOP
+};
+
+static const int LOG_CATEGORY_COUNT = 5;
+
+#if defined(__GNUC__)
+#define LOG_PRINTF_FORMAT(fmt, args) __attribute__((format(printf, fmt, args)))
+#else
+#define LOG_PRINTF_FORMAT(fmt, args)
+#endif
+
+namespace log_detail {
+    extern std::atomic<uint8_t> minLevel;
+    extern std::atomic<uint32_t> categoryMask;
+}
+
+namespace Log {
+    void start();
+    // Drains everything still queued and stops the writer thread
+    void shutdown();
+
+    // Runtime filters; safe to change from any thread
+    void setLevel(LogLevel level);
+    void setCategoryEnabled(LogCategory category, bool enabled);
+    void setAllCategoriesEnabled(bool enabled);
+
+    inline bool enabled(LogLevel level, LogCategory category) {
+        return static_cast<uint8_t>(level) >= log_detail::minLevel.load(std::memory_order_relaxed) &&
+               (log_detail::categoryMask.load(std::memory_order_relaxed) & (1u << static_cast<unsigned>(category)));
+    }
+
+    void write(LogLevel level, LogCategory category, const char* format, ...) LOG_PRINTF_FORMAT(3, 4);
+
+    // "debug", "info", "warn", "error" / "core", "assets", "render", "gameplay", "shop"
+    bool parseLevel(const char* name, LogLevel& level);
+    bool parseCategory(const char* name, LogCategory& category);
+
+    // Messages lost to a full ring since start()
+    uint64_t droppedCount();
+}
+
+#define LOG_AT(level, category, ...) \
+    do { \
+        if (Log::enabled(level, LogCategory::category)) Log::write(level, LogCategory::category, __VA_ARGS__); \
+    } while (0)
+
+#define LOG_DEBUG(category, ...) LOG_AT(LogLevel::DEBUG, category, __VA_ARGS__)
+#define LOG_INFO(category, ...) LOG_AT(LogLevel::INFO, category, __VA_ARGS__)
+#define LOG_WARN(category, ...) LOG_AT(LogLevel::WARN, category, __VA_ARGS__)
+#define LOG_ERROR(category, ...) LOG_AT(LogLevel::ERR, category, __VA_ARGS__)
@@ -1,73 +1,57 @@
 #include "Material.h"
+#include "Random.h"
+#include "Systems.h"
 #include <cmath>
 #include <random>
 
-Material::Material(Vector2 pos, int matValue, int expValue)
-    : position(pos), radius(6), materialValue(matValue), experienceValue(expValue),
-      alive(true), lifetime(0), maxLifetime(60.0f), bobOffset(0), bobSpeed(2.0f) {
-    
+Entity spawnMaterial(World& world, Vector2 pos, int matValue, int expValue) {
     // Random bob offset so materials don't all bob in sync
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    Pcg32& gen = Random::stream(RandomStream::EFFECTS);
     std::uniform_real_distribution<float> dist(0, 2 * M_PI);
-    bobOffset = dist(gen);
+    
+    const float maxLifetime = 60.0f;
+    // Warns the player over the last 20% of its lifetime
+    return world.create(Transform{pos}, Collider{6.0f}, Lifetime{0.0f, maxLifetime, maxLifetime * 0.8f},
+                        Bob{dist(gen), 2.0f, 3.0f}, Pickup{PickupKind::MATERIAL, expValue, matValue});
 }
 
-void Material::update(float deltaTime) {
-    if (!alive) return;
-    
-    lifetime += deltaTime;
-    if (lifetime >= maxLifetime) {
-        alive = false;
-    }
-    
-    // Bob up and down slightly
-    bobOffset += bobSpeed * deltaTime;
+size_t countMaterials(World& world) {
+    size_t count = 0;
+    world.each<Pickup>([&count](Entity, Pickup& pickup) {
+        if (pickup.kind == PickupKind::MATERIAL) count++;
+    });
+    return count;
 }
 
-void Material::render(SDL_Renderer* renderer) {
-    if (!alive) return;
-    
-    // Calculate bobbing position
-    float bobY = sin(bobOffset) * 3.0f;
-    
-    // Render as green blob (materials in Brotato are green)
-    SDL_SetRenderDrawColor(renderer, 0, 200, 0, 255);
-    
-    int centerX = (int)position.x;
-    int centerY = (int)position.y + (int)bobY;
-    int r = (int)radius;
-    
-    // Draw filled circle for material
-    for (int x = -r; x <= r; x++) {
-        for (int y = -r; y <= r; y++) {
-            if (x*x + y*y <= r*r) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-    
-    // Add a lighter green center
-    SDL_SetRenderDrawColor(renderer, 100, 255, 100, 255);
-    r = r / 2;
-    for (int x = -r; x <= r; x++) {
-        for (int y = -r; y <= r; y++) {
-            if (x*x + y*y <= r*r) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-    
-    // Fade out near end of lifetime
-    if (lifetime > maxLifetime * 0.8f) {
+void renderMaterials(World& world, RenderQueue& queue, const Viewport& view, bool bobbing) {
+    world.each<Transform, Collider, Lifetime, Bob, Pickup>([&queue, &view, bobbing](Entity, Transform& transform, Collider& collider,
+                                                                      Lifetime& lifetime, Bob& bob, Pickup& pickup) {
+        if (pickup.kind != PickupKind::MATERIAL) return;
+        // Warning ring plus bob height around the collider
+        if (!view.contains(transform.position, collider.radius + 2.0f + bob.amplitude)) return;
+        
+        // Calculate bobbing position
+        float bobY = bobbing ? sin(bob.phase) * bob.amplitude : 0.0f;
+        
+        int centerX = (int)transform.position.x;
+        int centerY = (int)transform.position.y + (int)bobY;
+        int r = (int)collider.radius;
+        
+        // Render as green blob (materials in Brotato are green)
+        queue.fillCircle(RenderLayer::PICKUPS, 3, centerX, centerY, r, {0, 200, 0, 255});
+        
+        // Add a lighter green center
+        queue.fillCircle(RenderLayer::PICKUPS, 4, centerX, centerY, r / 2, {100, 255, 100, 255});
+        
         // Visual indicator that material will disappear soon
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 100);
-        r = (int)radius + 2;
-        for (int angle = 0; angle < 360; angle += 20) {
-            float rad = angle * M_PI / 180.0f;
-            int x = centerX + cos(rad) * r;
-            int y = centerY + sin(rad) * r;
-            SDL_RenderDrawPoint(renderer, x, y);
+        if (lifetime.age > lifetime.fadeStart) {
+            SDL_Point dots[18];
+            r = (int)collider.radius + 2;
+            for (int i = 0; i < 18; i++) {
+                float rad = i * 20 * M_PI / 180.0f;
+                dots[i] = {(int)(centerX + cos(rad) * r), (int)(centerY + sin(rad) * r)};
+            }
+            queue.points(RenderLayer::PICKUPS, 5, dots, 18, {255, 255, 0, 100});
         }
-    }
-}
\ No newline at end of file
+    });
+}
@@ -1,29 +1,13 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include "Vector2.h"
+#include "World.h"
+#include "RenderScaler.h"
+#include "RenderQueue.h"
 
-class Material {
-public:
-    Material(Vector2 pos, int materialValue = 1, int expValue = 1);
-    
-    void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    
-    Vector2 getPosition() const { return position; }
-    float getRadius() const { return radius; }
-    int getMaterialValue() const { return materialValue; }
-    int getExperienceValue() const { return experienceValue; }
-    bool isAlive() const { return alive; }
-    void collect() { alive = false; }
-    
-private:
-    Vector2 position;
-    float radius;
-    int materialValue;
-    int experienceValue;
-    bool alive;
-    float lifetime;
-    float maxLifetime;
-    float bobOffset;
-    float bobSpeed;
-};
\ No newline at end of file
+// Materials are World entities: Transform + Collider + Lifetime + Bob + Pickup
+Entity spawnMaterial(World& world, Vector2 pos, int materialValue = 1, int expValue = 1);
+
+size_t countMaterials(World& world);
+// Without bobbing, materials are drawn where they lie
+void renderMaterials(World& world, RenderQueue& queue, const Viewport& view, bool bobbing = true);
@@ -1,5 +1,6 @@
 #include "Menu.h"
 #include "Game.h"
+#include "RenderScaler.h"
 #include <iostream>
 #include <string>
 
@@ -40,33 +41,35 @@ void Menu::hideMenu() {
     active = false;
 }
 
-void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
+void Menu::render(DrawList& list, int windowWidth, int windowHeight) {
     if (!active) return;
     
-    // Get actual renderer size (handles fullscreen desktop mode correctly)
-    int actualWidth, actualHeight;
-    SDL_GetRendererOutputSize(renderer, &actualWidth, &actualHeight);
+    // Menu is laid out in logical coordinates; the renderer scales to the window
+    int actualWidth = windowWidth;
+    int actualHeight = windowHeight;
     
     // Render blur background
-    renderBlurBackground(renderer, actualWidth, actualHeight);
+    if (effects) {
+        renderBlurBackground(list, actualWidth, actualHeight);
+    }
     
     // Calculate menu position (centered) using actual dimensions
     int menuX = (actualWidth - MENU_WIDTH) / 2;
     int menuY = (actualHeight - MENU_HEIGHT) / 2;
     
     // Draw menu background with colored rectangles
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 25, 30, 40, 230);
     SDL_Rect bgRect = {menuX, menuY, MENU_WIDTH, MENU_HEIGHT};
-    SDL_RenderFillRect(renderer, &bgRect);
-    SDL_SetRenderDrawColor(renderer, 80, 120, 180, 255);
-    SDL_RenderDrawRect(renderer, &bgRect);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    if (effects) {
+        list.quad(bgRect, {25, 30, 40, 230}, SDL_BLENDMODE_BLEND);
+    } else {
+        list.quad(bgRect, {25, 30, 40, 255});
+    }
+    list.quadOutline(bgRect, {80, 120, 180, 255});
     
     // Render title
     SDL_Color white = {255, 255, 255, 255};
     std::string title = getMenuTitle();
-    renderTTFText(renderer, title.c_str(), menuX + MENU_WIDTH / 2 - (title.length() * 6), menuY + 40, white, 32);
+    list.text(title.c_str(), menuX + MENU_WIDTH / 2 - (title.length() * 6), menuY + 40, white, 32);
     
     // Calculate button positions
     int buttonStartY = menuY + 120;
@@ -80,46 +83,41 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
         bool highlighted = (i == selectedButton) || (i == hoveredButton);
         bool disabled = !isButtonEnabled(button);
         
-        renderButton(renderer, button, buttonX, buttonY, highlighted, disabled);
+        renderButton(list, button, buttonX, buttonY, highlighted, disabled);
     }
     
     // Render controls help text
     SDL_Color helpTextColor = {160, 170, 185, 255};
-    renderTTFText(renderer, "Use arrow keys and ENTER, or click with mouse", 
-                  menuX + 20, menuY + MENU_HEIGHT - 40, helpTextColor, 14);
+    list.text("Use arrow keys and ENTER, or click with mouse",
+              menuX + 20, menuY + MENU_HEIGHT - 40, helpTextColor, 14);
 }
 
-void Menu::renderBlurBackground(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
+void Menu::renderBlurBackground(DrawList& list, int windowWidth, int windowHeight) {
     // Create a semi-transparent dark overlay with subtle color tint
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 10, 15, 25, 160); // Dark blue-tinted overlay
     SDL_Rect fullScreen = {0, 0, windowWidth, windowHeight};
-    SDL_RenderFillRect(renderer, &fullScreen);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    list.quad(fullScreen, {10, 15, 25, 160}, SDL_BLENDMODE_BLEND); // Dark blue-tinted overlay
 }
 
-void Menu::renderButton(SDL_Renderer* renderer, MenuButton button, int x, int y, bool highlighted, bool disabled) {
+void Menu::renderButton(DrawList& list, MenuButton button, int x, int y, bool highlighted, bool disabled) {
     // Draw button background with colored rectangles
     SDL_Rect buttonRect = {x, y, BUTTON_WIDTH, BUTTON_HEIGHT};
     
     if (disabled) {
-        SDL_SetRenderDrawColor(renderer, 45, 45, 50, 255);
+        list.quad(buttonRect, {45, 45, 50, 255});
     } else if (highlighted) {
-        SDL_SetRenderDrawColor(renderer, 70, 120, 200, 255);
+        list.quad(buttonRect, {70, 120, 200, 255});
     } else {
-        SDL_SetRenderDrawColor(renderer, 55, 65, 80, 255);
+        list.quad(buttonRect, {55, 65, 80, 255});
     }
-    SDL_RenderFillRect(renderer, &buttonRect);
     
     // Draw button border
     if (disabled) {
-        SDL_SetRenderDrawColor(renderer, 80, 80, 85, 255);
+        list.quadOutline(buttonRect, {80, 80, 85, 255});
     } else if (highlighted) {
-        SDL_SetRenderDrawColor(renderer, 120, 160, 220, 255);
+        list.quadOutline(buttonRect, {120, 160, 220, 255});
     } else {
-        SDL_SetRenderDrawColor(renderer, 100, 120, 150, 255);
+        list.quadOutline(buttonRect, {100, 120, 150, 255});
     }
-    SDL_RenderDrawRect(renderer, &buttonRect);
     
     // Draw button text
     SDL_Color textColor;
@@ -134,13 +132,7 @@ void Menu::renderButton(SDL_Renderer* renderer, MenuButton button, int x, int y,
     std::string buttonText = getButtonText(button);
     int textX = x + (BUTTON_WIDTH - buttonText.length() * 8) / 2; // Rough centering
     int textY = y + (BUTTON_HEIGHT - 16) / 2;
-    renderTTFText(renderer, buttonText.c_str(), textX, textY, textColor, 18);
-}
-
-void Menu::renderTTFText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color, int fontSize) {
-    if (gameRef) {
-        gameRef->renderTTFText(text, x, y, color, fontSize);
-    }
+    list.text(buttonText.c_str(), textX, textY, textColor, 18);
 }
 
 bool Menu::isButtonEnabled(MenuButton button) const {
@@ -239,11 +231,9 @@ void Menu::handleMouseInput(int mouseX, int mouseY, bool mousePressed) {
     
     hoveredButton = -1;
     
-    // Get actual renderer size (same as render method)
-    if (!gameRef) return;
-    SDL_Renderer* renderer = gameRef->getRenderer();
-    int actualWidth, actualHeight;
-    SDL_GetRendererOutputSize(renderer, &actualWidth, &actualHeight);
+    // Mouse coordinates arrive in logical space, same as render()
+    int actualWidth = LOGICAL_WIDTH;
+    int actualHeight = LOGICAL_HEIGHT;
     
     // Calculate menu position using actual dimensions
     int menuX = (actualWidth - MENU_WIDTH) / 2;
@@ -1,6 +1,7 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include <string>
+#include "DrawList.h"
 
 class Player;
 class Game;
@@ -22,8 +23,6 @@ public:
     ~Menu();
     
     void setGame(Game* game) { gameRef = game; }
-    void loadAssets(SDL_Renderer* renderer) { /* No assets to load - using colored rectangles */ }
-    void unloadAssets() { /* No assets to unload */ }
     
     void showMenu(MenuType type);
     void hideMenu();
@@ -33,7 +32,9 @@ public:
     // State synchronization with Game
     void setEscKeyPressed(bool pressed) { escKeyPressed = pressed; }
     
-    void render(SDL_Renderer* renderer, int windowWidth, int windowHeight);
+    void render(DrawList& list, int windowWidth, int windowHeight);
+    // Off (low quality tiers): no full-screen dim, opaque panel
+    void setEffects(bool enabled) { effects = enabled; }
     void handleInput(const Uint8* keyState);
     void handleMouseInput(int mouseX, int mouseY, bool mousePressed);
     
@@ -59,6 +60,7 @@ private:
     bool justShown; // Flag to prevent immediate ESC handling after menu is shown
     
     Game* gameRef;
+    bool effects = true;
     
 
     
@@ -71,9 +73,8 @@ private:
     static const int TOTAL_BUTTONS = 3;
     
     // Helper methods
-    void renderButton(SDL_Renderer* renderer, MenuButton button, int x, int y, bool highlighted, bool disabled);
-    void renderBlurBackground(SDL_Renderer* renderer, int windowWidth, int windowHeight);
-    void renderTTFText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color, int fontSize = 16);
+    void renderButton(DrawList& list, MenuButton button, int x, int y, bool highlighted, bool disabled);
+    void renderBlurBackground(DrawList& list, int windowWidth, int windowHeight);
     bool isButtonEnabled(MenuButton button) const;
     std::string getButtonText(MenuButton button) const;
     std::string getMenuTitle() const;
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+
+// On-disk layout of the packed asset archive (.pak), shared by the offline
+// packer (tools/AssetPacker.cpp) and the runtime reader (AssetPack).
+//
+//   PakHeader
+//   pixel / font blocks, each aligned to PAK_DATA_ALIGNMENT
+//   PakEntry[entryCount]          <- tocOffset
+//   entry names (not terminated)  <- namesOffset
+//
+// All integers are little-endian.
+
+constexpr uint32_t PAK_MAGIC = 0x4B415042; // "BPAK"
+constexpr uint32_t PAK_VERSION = 1;
+constexpr uint32_t PAK_DATA_ALIGNMENT = 16;
+
+enum PakEntryType : uint32_t {
+    PAK_ENTRY_IMAGE = 0, // Raw pixels, ready for SDL_UpdateTexture
+    PAK_ENTRY_FONT = 1,  // TTF file bytes, opened with TTF_OpenFontRW
+    PAK_ENTRY_RAW = 2
+};
+
+enum PakEntryFlags : uint32_t {
+    PAK_FLAG_PREMULTIPLIED = 1u << 0 // Color channels already multiplied by alpha
+};
+
+struct PakHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t tocOffset;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+};
+
+struct PakEntry {
+    uint32_t nameOffset;  // Relative to namesOffset; names are asset paths like "assets/enemies/slime.png"
+    uint32_t nameLength;
+    uint32_t type;        // PakEntryType
+    uint32_t flags;       // PakEntryFlags
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint32_t width;       // Images only
+    uint32_t height;
+    uint32_t pitch;
+    uint32_t pixelFormat; // SDL_PixelFormatEnum
+};
+
+static_assert(sizeof(PakHeader) == 40, "PakHeader layout changed");
+static_assert(sizeof(PakEntry) == 48, "PakEntry layout changed");
@@ -1,82 +1,100 @@
 #include "Particle.h"
-#include <random>
+#include "Random.h"
 #include <algorithm>
+#include <cmath>
+#include <random>
 
-Particle::Particle(Vector2 position, Vector2 velocity, float normalDuration, 
-                   SDL_Color color, float scale)
-    : position(position), velocity(velocity), color(color), scale(scale),
-      alive(true), lifetime(0.0f), normalDuration(normalDuration),
-      phase(Phase::NORMAL), alpha(255.0f) {
-    
+Entity spawnParticle(World& world, Vector2 position, Vector2 velocity, float normalDuration,
+                     SDL_Color color, SDL_Texture* texture, float scale) {
     // Add 10% randomization to normal duration
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    Pcg32& gen = Random::stream(RandomStream::EFFECTS);
     std::uniform_real_distribution<float> dist(0.9f, 1.1f);
-    this->normalDuration = normalDuration * dist(gen);
+    normalDuration *= dist(gen);
     
     // Disappear duration is 20% of normal phase
-    disappearDuration = this->normalDuration * 0.2f;
-    totalDuration = this->normalDuration + disappearDuration;
-}
-
-void Particle::update(float deltaTime) {
-    if (!alive) return;
-    
-    // Update position
-    position.x += velocity.x * deltaTime;
-    position.y += velocity.y * deltaTime;
+    float totalDuration = normalDuration * 1.2f;
     
-    // Update lifetime
-    lifetime += deltaTime;
-    
-    // Handle phase transitions and alpha calculation
-    if (lifetime >= totalDuration) {
-        alive = false;
-        return;
+    Sprite sprite;
+    sprite.texture = texture;
+    sprite.color = color;
+    sprite.scale = scale;
+    if (texture) {
+        SDL_QueryTexture(texture, nullptr, nullptr, &sprite.width, &sprite.height);
     }
-    
-    if (lifetime >= normalDuration) {
-        // Disappearing phase
-        phase = Phase::DISAPPEARING;
+    return world.create(Transform{position}, Velocity{velocity}, Lifetime{0.0f, totalDuration, normalDuration},
+                        sprite, Cosmetic{});
+}
+
+void renderParticles(World& world, RenderQueue& queue, const Viewport& view) {
+    world.each<Transform, Lifetime, Sprite>([&queue, &view](Entity, Transform& transform, Lifetime& lifetime, Sprite& sprite) {
+        SDL_Texture* texture = sprite.texture;
+        if (!texture) return;
+        
+        int scaledWidth = static_cast<int>(sprite.width * sprite.scale);
+        int scaledHeight = static_cast<int>(sprite.height * sprite.scale);
+        if (!view.contains(transform.position, std::max(scaledWidth, scaledHeight) * 0.5f)) return;
+        
+        SDL_Rect destRect = {
+            static_cast<int>(transform.position.x - scaledWidth / 2),
+            static_cast<int>(transform.position.y - scaledHeight / 2),
+            scaledWidth,
+            scaledHeight
+        };
         
-        // Calculate fade-out alpha (linear fade from 255 to 0)
-        float disappearProgress = (lifetime - normalDuration) / disappearDuration;
-        alpha = 255.0f * (1.0f - disappearProgress);
-        alpha = std::max(0.0f, alpha); // Clamp to minimum 0
-    } else {
-        // Normal phase
-        phase = Phase::NORMAL;
-        alpha = 255.0f;
+        // Additive, tinted and faded; the queue only touches texture state when it changes and resets it after
+        SDL_Color mod = {sprite.color.r, sprite.color.g, sprite.color.b, static_cast<Uint8>(255.0f * lifetime.fade())};
+        queue.sprite(RenderLayer::PARTICLES, 0, texture, destRect, mod, SDL_BLENDMODE_ADD);
+    }, componentMask<Cosmetic>());
+}
+
+void ParticleBudget::recordFrameTime(float frameMs, float budgetMs) {
+    if (budgetMs <= 0.0f || frameMs <= 0.0f) return;
+    // Smoothed over ~10 frames so one hitch doesn't cut the next burst in half
+    smoothedFrameMs = smoothedFrameMs == 0.0f ? frameMs : smoothedFrameMs + (frameMs - smoothedFrameMs) * 0.1f;
+    pressure = std::clamp(budgetMs / smoothedFrameMs, MIN_PRESSURE, 1.0f);
+}
+
+ParticleBudget::Burst ParticleBudget::plan(ParticlePriority priority, int requested, float scale) {
+    requestedTotal += requested;
+    if (priority == ParticlePriority::CRITICAL || requested <= 1) {
+        return merge(requested, requested, scale);
+    }
+
+    int wanted = requested;
+    if (density < 1.0f) {
+        wanted = std::max(1, static_cast<int>(std::ceil(requested * density)));
+    }
+    if (limit <= 0) {
+        return merge(requested, wanted, scale);
+    }
+
+    // Share of the (pressure-scaled) limit each class may fill
+    float share = 1.0f;
+    switch (priority) {
+        case ParticlePriority::AMBIENT: share = 0.5f; break;
+        case ParticlePriority::NORMAL: share = 0.85f; break;
+        default: break;
+    }
+    float ceiling = limit * pressure * share;
+    float room = ceiling - static_cast<float>(live);
+    if (room < 1.0f) return {0, scale};
+
+    // Full bursts while the class is under half full, then shrinking linearly
+    float fill = live / ceiling;
+    int count = wanted;
+    if (fill > 0.5f) {
+        count = static_cast<int>(std::ceil(wanted * (1.0f - fill) * 2.0f));
     }
+    return merge(requested, std::clamp(count, 1, static_cast<int>(room)), scale);
 }
 
-void Particle::render(SDL_Renderer* renderer, SDL_Texture* starTexture) {
-    if (!alive || !starTexture) return;
-    
-    // Set up texture blending and color modulation
-    SDL_SetTextureBlendMode(starTexture, SDL_BLENDMODE_ADD);
-    SDL_SetTextureColorMod(starTexture, color.r, color.g, color.b);
-    SDL_SetTextureAlphaMod(starTexture, static_cast<Uint8>(alpha));
-    
-    // Calculate render position and size
-    int texWidth, texHeight;
-    SDL_QueryTexture(starTexture, nullptr, nullptr, &texWidth, &texHeight);
-    
-    int scaledWidth = static_cast<int>(texWidth * scale);
-    int scaledHeight = static_cast<int>(texHeight * scale);
-    
-    SDL_Rect destRect = {
-        static_cast<int>(position.x - scaledWidth / 2),
-        static_cast<int>(position.y - scaledHeight / 2),
-        scaledWidth,
-        scaledHeight
-    };
-    
-    // Render the particle
-    SDL_RenderCopy(renderer, starTexture, nullptr, &destRect);
-    
-    // Reset texture modulation to prevent affecting other renders
-    SDL_SetTextureColorMod(starTexture, 255, 255, 255);
-    SDL_SetTextureAlphaMod(starTexture, 255);
-    SDL_SetTextureBlendMode(starTexture, SDL_BLENDMODE_BLEND);
+ParticleBudget::Burst ParticleBudget::merge(int requested, int count, float scale) {
+    if (count < requested) {
+        // Same total sprite area, spread over fewer particles
+        scale *= std::min(MAX_MERGE_SCALE, std::sqrt(static_cast<float>(requested) / count));
+    }
+    spawnedTotal += count;
+    live += count;
+    peakLive = std::max(peakLive, live);
+    return {count, scale};
 }
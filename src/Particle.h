@@ -1,31 +1,73 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include "Vector2.h"
+#include "World.h"
+#include "RenderScaler.h"
+#include "RenderQueue.h"
 
-class Particle {
+// Particles are Cosmetic World entities: Transform + Velocity + Lifetime + Sprite.
+// They live for normalDuration (+-10%) and then fade out over another 20%.
+Entity spawnParticle(World& world, Vector2 position, Vector2 velocity, float normalDuration,
+                     SDL_Color color, SDL_Texture* texture, float scale = 1.0f);
+
+void renderParticles(World& world, RenderQueue& queue, const Viewport& view);
+
+// Who keeps their particles when there are too many. Lower classes give way first
+enum class ParticlePriority : uint8_t {
+    AMBIENT,    // Mass effects, e.g. every enemy vanishing at the end of a wave
+    NORMAL,     // Enemy deaths, bomb kills
+    HIGH,       // Explosions and impacts
+    CRITICAL    // Player death; always spawns in full
+};
+
+// Global cap on live particles. Each priority class may fill the budget up to
+// its own share; as a class's share fills up, bursts shrink, then collapse into
+// a single larger particle, then are dropped. Shrunk bursts get bigger
+// particles so a burst keeps roughly the same footprint.
+//
+// When recent frames run over the frame budget, the limit shrinks with them,
+// so a slow machine gets fewer particles before it gets fewer frames.
+class ParticleBudget {
 public:
-    Particle(Vector2 position, Vector2 velocity, float normalDuration, 
-             SDL_Color color, float scale = 1.0f);
-    
-    void update(float deltaTime);
-    void render(SDL_Renderer* renderer, SDL_Texture* starTexture);
-    
-    bool isAlive() const { return alive; }
-    Vector2 getPosition() const { return position; }
-    
+    struct Burst {
+        int count;      // Particles to spawn
+        float scale;    // Sprite scale for each of them
+    };
+
+    // 0 = unlimited
+    void setLimit(int maxParticles) { limit = maxParticles; }
+    int getLimit() const { return limit; }
+    // Quality tiers: fraction of each burst's particles, applied before the limit
+    void setDensity(float fraction) { density = fraction; }
+
+    // Main thread, once per frame: CPU time of the last frame against its budget
+    void recordFrameTime(float frameMs, float budgetMs);
+
+    // Once per simulation tick: the live count this tick's bursts are planned
+    // against. Each plan() adds what it hands out, so a tick full of bursts
+    // doesn't recount the world for every one of them
+    void beginTick(int liveParticles) { live = liveParticles; }
+
+    Burst plan(ParticlePriority priority, int requested, float scale);
+
+    // Totals over the run, for the exit summary
+    uint64_t getRequested() const { return requestedTotal; }
+    uint64_t getSpawned() const { return spawnedTotal; }
+    int getPeakLive() const { return peakLive; }
+
 private:
-    Vector2 position;
-    Vector2 velocity;
-    SDL_Color color;
-    float scale;
-    
-    // Lifecycle management
-    bool alive;
-    float lifetime;
-    float normalDuration;        // Base duration for normal phase
-    float disappearDuration;     // 20% of normal phase
-    float totalDuration;         // normalDuration + disappearDuration
-    
-    enum class Phase { NORMAL, DISAPPEARING } phase;
-    float alpha;                 // For fade-out effect (0-255)
+    Burst merge(int requested, int count, float scale);
+
+    int limit = 0;
+    int live = 0;
+    float density = 1.0f;
+    float pressure = 1.0f;          // Fraction of the limit currently allowed
+    float smoothedFrameMs = 0.0f;
+
+    uint64_t requestedTotal = 0;
+    uint64_t spawnedTotal = 0;
+    int peakLive = 0;
+
+    static constexpr float MAX_MERGE_SCALE = 2.0f;  // Keeps merged particles inside Game's cull margin
+    static constexpr float MIN_PRESSURE = 0.25f;
 };
@@ -0,0 +1,270 @@
+#include "PixelBlend.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PIXELBLEND_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PIXELBLEND_SSE2 1
+#endif
+
+namespace {
+    const uint32_t RGB_MASK = 0x00FFFFFF;
+
+    // x / 255 rounded, exact for x <= 255 * 255
+    inline uint32_t div255(uint32_t x) {
+        x += 128;
+        return (x + (x >> 8)) >> 8;
+    }
+
+    inline uint32_t channel(uint32_t pixel, int shift) {
+        return (pixel >> shift) & 0xFF;
+    }
+
+    uint32_t blendPixel(uint32_t dst, uint32_t src, SDL_BlendMode blend) {
+        uint32_t inverseAlpha = 255 - (src >> 24);
+        uint32_t out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            uint32_t s = channel(src, shift);
+            uint32_t d = channel(dst, shift);
+            uint32_t c;
+            switch (blend) {
+                case SDL_BLENDMODE_NONE:
+                    c = s;
+                    break;
+                case SDL_BLENDMODE_ADD:
+                    // Destination alpha stays; colour saturates
+                    c = shift == 24 ? d : std::min<uint32_t>(255, s + d);
+                    break;
+                case SDL_BLENDMODE_MOD:
+                    c = std::min<uint32_t>(255, div255(s * d) + div255(d * inverseAlpha));
+                    break;
+                default:
+                    c = std::min<uint32_t>(255, s + div255(d * inverseAlpha));
+                    break;
+            }
+            out |= c << shift;
+        }
+        return out;
+    }
+
+#if PIXELBLEND_SSE2
+    inline __m128i div255x8(__m128i x) {
+        x = _mm_add_epi16(x, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+    }
+
+    // Each pixel's alpha in all four of its 16-bit lanes
+    inline __m128i broadcastAlpha(__m128i wide) {
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(wide, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    // dst * factor / 255 per channel, factor as 16-bit lanes for two pixels
+    inline __m128i scale4(__m128i pixels, __m128i factorLo, __m128i factorHi) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lo = div255x8(_mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), factorLo));
+        __m128i hi = div255x8(_mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), factorHi));
+        return _mm_packus_epi16(lo, hi);
+    }
+
+    inline __m128i over4(__m128i src, __m128i dst) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i full = _mm_set1_epi16(255);
+        __m128i inverseLo = _mm_sub_epi16(full, broadcastAlpha(_mm_unpacklo_epi8(src, zero)));
+        __m128i inverseHi = _mm_sub_epi16(full, broadcastAlpha(_mm_unpackhi_epi8(src, zero)));
+        return _mm_adds_epu8(src, scale4(dst, inverseLo, inverseHi));
+    }
+#endif
+
+#if PIXELBLEND_AVX2
+    inline __m256i div255x16(__m256i x) {
+        x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+    }
+
+    // Unpack and pack work per 128-bit lane, so pixel order comes back unchanged
+    inline __m256i scale8(__m256i pixels, __m256i factorLo, __m256i factorHi) {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i lo = div255x16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(pixels, zero), factorLo));
+        __m256i hi = div255x16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(pixels, zero), factorHi));
+        return _mm256_packus_epi16(lo, hi);
+    }
+
+    inline __m256i over8(__m256i src, __m256i dst) {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i full = _mm256_set1_epi16(255);
+        const int all = _MM_SHUFFLE(3, 3, 3, 3);
+        __m256i alphaLo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(_mm256_unpacklo_epi8(src, zero), all), all);
+        __m256i alphaHi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(_mm256_unpackhi_epi8(src, zero), all), all);
+        return _mm256_adds_epu8(src, scale8(dst, _mm256_sub_epi16(full, alphaLo), _mm256_sub_epi16(full, alphaHi)));
+    }
+#endif
+}
+
+namespace PixelBlend {
+
+const char* kernelName() {
+#if PIXELBLEND_AVX2
+    return "avx2";
+#elif PIXELBLEND_SSE2
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+uint32_t pack(SDL_Color color) {
+    return (uint32_t(color.a) << 24) | (uint32_t(color.r) << 16) | (uint32_t(color.g) << 8) | uint32_t(color.b);
+}
+
+uint32_t premultiplied(SDL_Color color) {
+    return (uint32_t(color.a) << 24) | (div255(color.r * color.a) << 16) |
+           (div255(color.g * color.a) << 8) | div255(color.b * color.a);
+}
+
+void premultiplyImage(uint32_t* pixels, int count) {
+    for (int i = 0; i < count; i++) {
+        uint32_t p = pixels[i];
+        uint32_t a = p >> 24;
+        if (a == 255) continue;
+        pixels[i] = (a << 24) | (div255(channel(p, 16) * a) << 16) | (div255(channel(p, 8) * a) << 8) | div255(channel(p, 0) * a);
+    }
+}
+
+void fill(uint32_t* dst, int count, SDL_Color color, SDL_BlendMode blend) {
+    if (count <= 0) return;
+    if (blend == SDL_BLENDMODE_NONE) {
+        std::fill_n(dst, count, pack(color));
+        return;
+    }
+
+    uint32_t src = premultiplied(color);
+    if (blend == SDL_BLENDMODE_BLEND && color.a == 255) {
+        std::fill_n(dst, count, src);
+        return;
+    }
+    if ((blend == SDL_BLENDMODE_BLEND || blend == SDL_BLENDMODE_ADD) && color.a == 0) return;
+
+    int i = 0;
+    if (blend == SDL_BLENDMODE_BLEND) {
+        uint16_t inverse = static_cast<uint16_t>(255 - color.a);
+#if PIXELBLEND_AVX2
+        const __m256i src8 = _mm256_set1_epi32(static_cast<int>(src));
+        const __m256i inverse8 = _mm256_set1_epi16(static_cast<short>(inverse));
+        for (; i + 8 <= count; i += 8) {
+            __m256i* p = reinterpret_cast<__m256i*>(dst + i);
+            _mm256_storeu_si256(p, _mm256_adds_epu8(src8, scale8(_mm256_loadu_si256(p), inverse8, inverse8)));
+        }
+#endif
+#if PIXELBLEND_SSE2
+        const __m128i src4 = _mm_set1_epi32(static_cast<int>(src));
+        const __m128i inverse4 = _mm_set1_epi16(static_cast<short>(inverse));
+        for (; i + 4 <= count; i += 4) {
+            __m128i* p = reinterpret_cast<__m128i*>(dst + i);
+            _mm_storeu_si128(p, _mm_adds_epu8(src4, scale4(_mm_loadu_si128(p), inverse4, inverse4)));
+        }
+#endif
+    } else if (blend == SDL_BLENDMODE_ADD) {
+        uint32_t add = src & RGB_MASK;
+#if PIXELBLEND_AVX2
+        const __m256i add8 = _mm256_set1_epi32(static_cast<int>(add));
+        for (; i + 8 <= count; i += 8) {
+            __m256i* p = reinterpret_cast<__m256i*>(dst + i);
+            _mm256_storeu_si256(p, _mm256_adds_epu8(_mm256_loadu_si256(p), add8));
+        }
+#endif
+#if PIXELBLEND_SSE2
+        const __m128i add4 = _mm_set1_epi32(static_cast<int>(add));
+        for (; i + 4 <= count; i += 4) {
+            __m128i* p = reinterpret_cast<__m128i*>(dst + i);
+            _mm_storeu_si128(p, _mm_adds_epu8(_mm_loadu_si128(p), add4));
+        }
+#endif
+    }
+
+    for (; i < count; i++) {
+        dst[i] = blendPixel(dst[i], src, blend);
+    }
+}
+
+void blend(uint32_t* dst, const uint32_t* src, int count, SDL_BlendMode blend) {
+    if (count <= 0) return;
+    if (blend == SDL_BLENDMODE_NONE) {
+        std::copy_n(src, count, dst);
+        return;
+    }
+
+    int i = 0;
+    if (blend == SDL_BLENDMODE_BLEND) {
+#if PIXELBLEND_AVX2
+        for (; i + 8 <= count; i += 8) {
+            __m256i* p = reinterpret_cast<__m256i*>(dst + i);
+            __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(p, over8(s, _mm256_loadu_si256(p)));
+        }
+#endif
+#if PIXELBLEND_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128i* p = reinterpret_cast<__m128i*>(dst + i);
+            __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(p, over4(s, _mm_loadu_si128(p)));
+        }
+#endif
+    } else if (blend == SDL_BLENDMODE_ADD) {
+#if PIXELBLEND_AVX2
+        const __m256i mask8 = _mm256_set1_epi32(static_cast<int>(RGB_MASK));
+        for (; i + 8 <= count; i += 8) {
+            __m256i* p = reinterpret_cast<__m256i*>(dst + i);
+            __m256i s = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), mask8);
+            _mm256_storeu_si256(p, _mm256_adds_epu8(_mm256_loadu_si256(p), s));
+        }
+#endif
+#if PIXELBLEND_SSE2
+        const __m128i mask4 = _mm_set1_epi32(static_cast<int>(RGB_MASK));
+        for (; i + 4 <= count; i += 4) {
+            __m128i* p = reinterpret_cast<__m128i*>(dst + i);
+            __m128i s = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), mask4);
+            _mm_storeu_si128(p, _mm_adds_epu8(_mm_loadu_si128(p), s));
+        }
+#endif
+    }
+
+    // MOD is rare enough to stay scalar
+    for (; i < count; i++) {
+        dst[i] = blendPixel(dst[i], src[i], blend);
+    }
+}
+
+void modulate(uint32_t* pixels, int count, SDL_Color mod) {
+    if (count <= 0) return;
+    // Premultiplied, so the alpha mod scales the colour channels too
+    uint16_t b = static_cast<uint16_t>(div255(mod.b * mod.a));
+    uint16_t g = static_cast<uint16_t>(div255(mod.g * mod.a));
+    uint16_t r = static_cast<uint16_t>(div255(mod.r * mod.a));
+    uint16_t a = mod.a;
+
+    int i = 0;
+#if PIXELBLEND_AVX2
+    const __m256i factor8 = _mm256_setr_epi16(b, g, r, a, b, g, r, a, b, g, r, a, b, g, r, a);
+    for (; i + 8 <= count; i += 8) {
+        __m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+        _mm256_storeu_si256(p, scale8(_mm256_loadu_si256(p), factor8, factor8));
+    }
+#endif
+#if PIXELBLEND_SSE2
+    const __m128i factor4 = _mm_setr_epi16(b, g, r, a, b, g, r, a);
+    for (; i + 4 <= count; i += 4) {
+        __m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+        _mm_storeu_si128(p, scale4(_mm_loadu_si128(p), factor4, factor4));
+    }
+#endif
+    for (; i < count; i++) {
+        uint32_t p = pixels[i];
+        pixels[i] = (div255(channel(p, 24) * a) << 24) | (div255(channel(p, 16) * r) << 16) |
+                    (div255(channel(p, 8) * g) << 8) | div255(channel(p, 0) * b);
+    }
+}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+
+// Span kernels for the software renderer. Pixels are 32-bit ARGB8888
+// (0xAARRGGBB, i.e. B, G, R, A in memory), and image sources are premultiplied
+// so BLEND is one multiply per channel: dst = src + dst * (255 - srcA) / 255.
+//
+// Each kernel has an SSE2 path (always available on x64), an AVX2 path when
+// the file is compiled with AVX2 enabled (BROTATO_AVX2 in CMake), and a scalar
+// fallback that also handles the tail of every span.
+namespace PixelBlend {
+    // "avx2", "sse2" or "scalar", whichever this build uses
+    const char* kernelName();
+
+    uint32_t pack(SDL_Color color);
+    uint32_t premultiplied(SDL_Color color);
+
+    // In place: straight alpha to premultiplied
+    void premultiplyImage(uint32_t* pixels, int count);
+
+    // Solid colour over a span. NONE writes the colour as is; BLEND and ADD
+    // weight it by its alpha
+    void fill(uint32_t* dst, int count, SDL_Color color, SDL_BlendMode blend);
+
+    // Premultiplied source span onto dst
+    void blend(uint32_t* dst, const uint32_t* src, int count, SDL_BlendMode blend);
+
+    // In place: premultiplied pixels times a colour/alpha mod, as SDL's
+    // texture colour and alpha mods would apply them
+    void modulate(uint32_t* pixels, int count, SDL_Color mod);
+}
@@ -1,15 +1,22 @@
 #include "Player.h"
 #include <cmath>
-#include <iostream>
-#include <SDL2/SDL_image.h>
 #include "Game.h"
+#include "RenderScaler.h"
+#include "Log.h"
+#include "Balance.h"
+#include "Random.h"
+#include "Snapshot.h"
+#include "Definitions.h"
 
 Player::Player(float x, float y) 
     : position(x, y), velocity(0, 0), shootDirection(1, 0), 
       radius(20), health(100), shootCooldown(0.15f), timeSinceLastShot(0),
-      experience(0), level(1), healthRegenTimer(0), playerTexture(nullptr) {
+      experience(0), level(1), healthRegenTimer(0) {
     // Initialize health to match max health
     health = stats.maxHealth;
+    for (Vector2& aim : weaponAim) {
+        aim = shootDirection;
+    }
     
     // Start with a brick on stick melee weapon for testing
     addWeapon(std::make_unique<Weapon>(WeaponType::MELEE_STICK, WeaponTier::TIER_1));
@@ -17,31 +24,18 @@ Player::Player(float x, float y)
     addWeapon(std::make_unique<Weapon>(WeaponType::PISTOL, WeaponTier::TIER_1));
 }
 
-void Player::initialize(SDL_Renderer* renderer) {
-    // Load brick character sprite
-    SDL_Surface* surface = IMG_Load("assets/character/brick.png");
-    if (!surface) {
-        std::cout << "Failed to load brick.png! SDL_image Error: " << IMG_GetError() << std::endl;
-        return;
-    }
-    
-    playerTexture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    
-    if (!playerTexture) {
-        std::cout << "Failed to create texture from brick.png! SDL Error: " << SDL_GetError() << std::endl;
-    } else {
-        std::cout << "Successfully loaded brick character sprite!" << std::endl;
-    }
+void Player::initialize(AssetLoader& assets) {
+    // Brick character sprite; the orange circle stands in until it's uploaded
+    playerTexture = assets.requestTexture("assets/character/brick.png");
 }
 
 void Player::update(float deltaTime) {
     position += velocity * deltaTime;
     
     if (position.x < radius) position.x = radius;
-    if (position.x > 1920 - radius) position.x = 1920 - radius;
+    if (position.x > LOGICAL_WIDTH - radius) position.x = LOGICAL_WIDTH - radius;
     if (position.y < radius) position.y = radius;
-    if (position.y > 1080 - radius) position.y = 1080 - radius;
+    if (position.y > LOGICAL_HEIGHT - radius) position.y = LOGICAL_HEIGHT - radius;
     
     velocity = Vector2(0, 0);
     
@@ -58,14 +52,14 @@ void Player::update(float deltaTime) {
     }
 }
 
-void Player::render(SDL_Renderer* renderer) {
+void Player::render(RenderQueue& queue) const {
     int centerX = (int)position.x;
     int centerY = (int)position.y;
     
-    if (playerTexture) {
+    if (playerTexture.get()) {
         // Get texture dimensions
-        int textureWidth, textureHeight;
-        SDL_QueryTexture(playerTexture, nullptr, nullptr, &textureWidth, &textureHeight);
+        int textureWidth = playerTexture.getWidth();
+        int textureHeight = playerTexture.getHeight();
         
         // Scale the brick sprite appropriately
         float scale = 0.8f; // Adjust size as needed
@@ -81,53 +75,24 @@ void Player::render(SDL_Renderer* renderer) {
         };
         
         // Render the brick sprite
-        SDL_RenderCopy(renderer, playerTexture, nullptr, &destRect);
+        queue.sprite(RenderLayer::PLAYER, 0, playerTexture.get(), destRect);
     } else {
         // Fallback to orange circle if texture fails to load
-        SDL_SetRenderDrawColor(renderer, 255, 200, 100, 255);
-        int r = (int)radius;
-        
-        for (int x = -r; x <= r; x++) {
-            for (int y = -r; y <= r; y++) {
-                if (x*x + y*y <= r*r) {
-                    SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-                }
-            }
-        }
+        queue.fillCircle(RenderLayer::PLAYER, 0, centerX, centerY, (int)radius, {255, 200, 100, 255});
     }
     
-    // Remove the orange direction line - user doesn't want it
-    // SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255);
-    // SDL_RenderDrawLine(renderer, centerX, centerY, 
-    //                   centerX + shootDirection.x * 30, 
-    //                   centerY + shootDirection.y * 30);
-    
     // Draw pickup range indicator (faint circle)
-    SDL_SetRenderDrawColor(renderer, 100, 255, 100, 30);
+    SDL_Point ring[36];
     int pickupR = (int)stats.pickupRange;
-    for (int angle = 0; angle < 360; angle += 10) {
-        float rad = angle * M_PI / 180.0f;
-        int x1 = centerX + cos(rad) * pickupR;
-        int y1 = centerY + sin(rad) * pickupR;
-        SDL_RenderDrawPoint(renderer, x1, y1);
+    for (int i = 0; i < 36; i++) {
+        float rad = i * 10 * M_PI / 180.0f;
+        ring[i] = {(int)(centerX + cos(rad) * pickupR), (int)(centerY + sin(rad) * pickupR)};
     }
+    queue.points(RenderLayer::PLAYER, 1, ring, 36, {100, 255, 100, 30});
 }
 
-void Player::handleInput(const Uint8* keyState) {
-    float currentSpeed = stats.moveSpeed;
-    
-    if (keyState[SDL_SCANCODE_W] || keyState[SDL_SCANCODE_UP]) {
-        velocity.y = -currentSpeed;
-    }
-    if (keyState[SDL_SCANCODE_S] || keyState[SDL_SCANCODE_DOWN]) {
-        velocity.y = currentSpeed;
-    }
-    if (keyState[SDL_SCANCODE_A] || keyState[SDL_SCANCODE_LEFT]) {
-        velocity.x = -currentSpeed;
-    }
-    if (keyState[SDL_SCANCODE_D] || keyState[SDL_SCANCODE_RIGHT]) {
-        velocity.x = currentSpeed;
-    }
+void Player::handleInput(const PlayerInput& input) {
+    velocity = input.move * stats.moveSpeed;
 }
 
 void Player::updateShootDirection(const Vector2& mousePosition) {
@@ -151,7 +116,7 @@ void Player::gainExperience(int exp) {
 
 void Player::levelUp() {
     level++;
-    std::cout << "Level up! Now level " << level << std::endl;
+    LOG_INFO(GAMEPLAY, "Level up! Now level %d", level);
     
     // Brotato-style: +1 Max HP per level
     stats.maxHealth += 1;
@@ -159,13 +124,13 @@ void Player::levelUp() {
     // Add weapons at certain levels for testing
     if (level == 2 && weapons.size() < MAX_WEAPONS) {
         addWeapon(std::make_unique<Weapon>(WeaponType::MELEE_STICK, WeaponTier::TIER_1));
-        std::cout << "Got Brick on Stick!" << std::endl;
+        LOG_INFO(GAMEPLAY, "Got Brick on Stick!");
     } else if (level == 3 && weapons.size() < MAX_WEAPONS) {
         addWeapon(std::make_unique<Weapon>(WeaponType::SMG, WeaponTier::TIER_1));
-        std::cout << "Got SMG!" << std::endl;
+        LOG_INFO(GAMEPLAY, "Got SMG!");
     } else if (level == 5 && weapons.size() < MAX_WEAPONS) {
         addWeapon(std::make_unique<Weapon>(WeaponType::PISTOL, WeaponTier::TIER_2));
-        std::cout << "Got Tier 2 Pistol!" << std::endl;
+        LOG_INFO(GAMEPLAY, "Got Tier 2 Pistol!");
     }
     
     // In Brotato, upgrades are chosen by the player at wave end
@@ -177,20 +142,18 @@ void Player::levelUp() {
 
 int Player::getExperienceToNextLevel() const {
     // Brotato's experience formula: (Level + 3) * (Level + 3)
-    int nextLevel = level + 1;
-    return (nextLevel + 3) * (nextLevel + 3);
+    return Balance::experienceForLevel(level + 1);
 }
 
 void Player::takeDamage(int damage) {
     // Apply armor reduction
-    int actualDamage = damage - stats.armor;
-    if (actualDamage < 1) actualDamage = 1; // Always take at least 1 damage
+    int actualDamage = Balance::damageAfterArmor(damage, stats.armor);
     
     // Check dodge chance
     if (stats.dodgeChance > 0) {
-        float dodgeRoll = (rand() % 100) / 100.0f;
+        float dodgeRoll = (Random::stream(RandomStream::COMBAT)() % 100) / 100.0f;
         if (dodgeRoll < stats.dodgeChance / 100.0f) {
-            std::cout << "Dodged!" << std::endl;
+            LOG_DEBUG(GAMEPLAY, "Dodged!");
             return; // Dodged the attack
         }
     }
@@ -213,57 +176,61 @@ void Player::addWeapon(std::unique_ptr<Weapon> weapon) {
     }
 }
 
-void Player::addWeapon(std::unique_ptr<Weapon> weapon, SDL_Renderer* renderer) {
+void Player::addWeapon(std::unique_ptr<Weapon> weapon, AssetLoader& assets) {
     if (weapons.size() < MAX_WEAPONS) {
-        weapon->initialize(renderer);
+        weapon->initialize(assets);
         weapons.push_back(std::move(weapon));
     }
 }
 
-void Player::initializeWeapons(SDL_Renderer* renderer) {
+void Player::initializeWeapons(AssetLoader& assets) {
     for (auto& weapon : weapons) {
-        weapon->initialize(renderer);
+        weapon->initialize(assets);
     }
 }
 
-void Player::updateWeapons(float deltaTime, std::vector<std::unique_ptr<Bullet>>& bullets) {
-    if (weapons.empty()) return;
-    
-    // Calculate circular positioning for multiple weapons (same as renderWeapons)
+// Weapons sit on a circle around the player, evenly spaced
+Vector2 Player::weaponPosition(int index) const {
+    float radius = 50.0f; // Increased distance from player center
+    float positionAngle = (2.0f * M_PI * index) / weapons.size();
+    Vector2 offsetDirection(cos(positionAngle), sin(positionAngle));
+    return position + offsetDirection * radius;
+}
+
+void Player::aimWeapons(const Targeting& targeting, AimMode aimMode) {
     int numWeapons = weapons.size();
-    float radius = 50.0f; // Same radius as in renderWeapons
+    if (numWeapons == 0) return;
     
+    float ranges[MAX_WEAPONS];
     for (int i = 0; i < numWeapons; i++) {
-        // Calculate weapon position in circle around player (same logic as renderWeapons)
-        float angleOffset = (2.0f * M_PI * i) / numWeapons;
-        float positionAngle = angleOffset;
-        Vector2 offsetDirection(cos(positionAngle), sin(positionAngle));
-        Vector2 weaponPos = position + offsetDirection * radius;
-        
-        // Update weapon with its actual position
-        weapons[i]->update(deltaTime, weaponPos, shootDirection, bullets, *this);
+        ranges[i] = weapons[i]->getStats().range;
     }
-}
-
-void Player::renderWeapons(SDL_Renderer* renderer) {
-    if (weapons.empty()) return;
-    
-    // Calculate circular positioning for multiple weapons
-    int numWeapons = weapons.size();
-    float radius = 50.0f; // Increased distance from player center
+    WeaponTarget targets[MAX_WEAPONS];
+    targeting.assign(position, ranges, numWeapons, aimMode, targets);
     
     for (int i = 0; i < numWeapons; i++) {
-        // Calculate weapon position in circle around player (position only)
-        float angleOffset = (2.0f * M_PI * i) / numWeapons;
-        float positionAngle = angleOffset; // Just spread positions around circle
-        Vector2 offsetDirection(cos(positionAngle), sin(positionAngle));
-        Vector2 weaponPos = position + offsetDirection * radius;
+        // Nothing in reach (or mouse aiming): fall back to the player's aim
+        weaponAim[i] = shootDirection;
+        if (!targets[i].valid) continue;
         
-        // All weapons point toward mouse (same direction)
-        Vector2 weaponDirection = shootDirection;
-        
-        // Render weapon at calculated position but pointing at mouse
-        weapons[i]->render(renderer, weaponPos, weaponDirection);
+        // Melee swings extend from the player's center, shots leave from the weapon
+        Vector2 origin = weapons[i]->isMeleeWeapon() ? position : weaponPosition(i);
+        Vector2 toTarget = targets[i].position - origin;
+        if (toTarget.length() > 0.1f) {
+            weaponAim[i] = toTarget.normalized();
+        }
+    }
+}
+
+void Player::updateWeapons(float deltaTime, World& world) {
+    for (int i = 0; i < static_cast<int>(weapons.size()); i++) {
+        weapons[i]->update(deltaTime, weaponPosition(i), weaponAim[i], world, *this);
+    }
+}
+
+void Player::renderWeapons(RenderQueue& queue) const {
+    for (int i = 0; i < static_cast<int>(weapons.size()); i++) {
+        weapons[i]->render(queue, weaponPosition(i), weaponAim[i]);
     }
 }
 
@@ -272,6 +239,69 @@ void Player::removeWeaponAt(int index) {
     weapons.erase(weapons.begin() + index);
 }
 
+void Player::save(SnapshotWriter& out) const {
+    out.write(position);
+    out.write(velocity);
+    out.write(shootDirection);
+    out.write(health);
+    out.write(timeSinceLastShot);
+    out.write(stats);
+    out.write(experience);
+    out.write(level);
+    out.write(healthRegenTimer);
+    
+    out.writeCount(weapons.size());
+    for (size_t i = 0; i < weapons.size(); i++) {
+        out.write(weapons[i]->getType());
+        out.write(weapons[i]->getTier());
+        out.write(weaponAim[i]);
+        weapons[i]->saveState(out);
+    }
+    
+    out.writeCount(items.size());
+    for (const auto& item : items) {
+        item->save(out);
+    }
+}
+
+bool Player::load(SnapshotReader& in, const WeaponSprites& sprites) {
+    in.read(position);
+    in.read(velocity);
+    in.read(shootDirection);
+    in.read(health);
+    in.read(timeSinceLastShot);
+    in.read(stats);
+    in.read(experience);
+    in.read(level);
+    in.read(healthRegenTimer);
+    
+    weapons.clear();
+    uint32_t weaponCount = in.readCount(MAX_WEAPONS);
+    for (uint32_t i = 0; i < weaponCount; i++) {
+        WeaponType type = in.read<WeaponType>();
+        WeaponTier tier = in.read<WeaponTier>();
+        if (static_cast<int>(type) < 0 || static_cast<int>(type) >= Defs::weaponCount() || static_cast<int>(tier) < 1 ||
+            static_cast<int>(tier) > WEAPON_TIER_COUNT) {
+            in.fail();
+            break;
+        }
+        auto weapon = std::make_unique<Weapon>(type, tier);
+        weapon->setTexture(sprites.get(type, tier));
+        in.read(weaponAim[i]);
+        weapon->loadState(in);
+        weapons.push_back(std::move(weapon));
+    }
+    
+    items.clear();
+    uint32_t itemCount = in.readCount(MAX_ITEMS);
+    for (uint32_t i = 0; i < itemCount; i++) {
+        if (auto item = Item::load(in)) {
+            items.push_back(std::move(item));
+        }
+    }
+    return in.ok();
+}
+
 // Item Management Implementation
 void Player::addItem(std::unique_ptr<Item> item) {
     if (items.size() < MAX_ITEMS) {
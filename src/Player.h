@@ -5,6 +5,7 @@
 #include "Vector2.h"
 #include "Weapon.h"
 #include "Item.h"
+#include "Targeting.h"
 
 struct PlayerStats {
     // Brotato-like stats
@@ -25,26 +26,37 @@ struct PlayerStats {
                    armor(0), healthRegen(0), dodgeChance(0), luck(0), materials(50) {}
 };
 
+// One frame of player controls. Game fills it from the keyboard and mouse, or
+// from the Autopilot when running unattended.
+struct PlayerInput {
+    Vector2 move;          // Each axis -1, 0 or 1, like the WASD keys
+    Vector2 aimTarget;     // Logical coordinates the weapons point at
+    bool useHealing = false;
+    bool useBomb = false;
+};
+
 class Player {
 public:
     Player(float x, float y);
     
     // Initialize player with renderer for texture loading
-    void initialize(SDL_Renderer* renderer);
+    void initialize(AssetLoader& assets);
     
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    void handleInput(const Uint8* keyState);
+    void render(RenderQueue& queue) const;
+    void handleInput(const PlayerInput& input);
     void updateShootDirection(const Vector2& mousePosition);
     void gainExperience(int exp);
     void levelUp();
     
     // Weapon management
     void addWeapon(std::unique_ptr<Weapon> weapon);
-    void addWeapon(std::unique_ptr<Weapon> weapon, SDL_Renderer* renderer);
-    void updateWeapons(float deltaTime, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void renderWeapons(SDL_Renderer* renderer);
-    void initializeWeapons(SDL_Renderer* renderer);
+    void addWeapon(std::unique_ptr<Weapon> weapon, AssetLoader& assets);
+    // Batched auto-aim: one Targeting query picks every weapon's direction
+    void aimWeapons(const Targeting& targeting, AimMode aimMode);
+    void updateWeapons(float deltaTime, World& world);
+    void renderWeapons(RenderQueue& queue) const;
+    void initializeWeapons(AssetLoader& assets);
     void removeWeaponAt(int index);
     void reloadAllWeapons();
     
@@ -75,16 +87,30 @@ public:
         }
         return nullptr;
     }
+    Vector2 getWeaponAim(int index) const {
+        if (index >= 0 && index < static_cast<int>(weapons.size())) {
+            return weaponAim[index];
+        }
+        return shootDirection;
+    }
     
     // Item management
     void addItem(std::unique_ptr<Item> item);
     bool useItem(int slot, Game& game);
     bool hasItemType(ItemType type) const;
     int getItemCount() const { return items.size(); }
+    bool hasWeaponSlot() const { return weapons.size() < MAX_WEAPONS; }
+    bool hasItemSlot() const { return items.size() < MAX_ITEMS; }
+    static const int MAX_ITEMS = 6;
     const Item* getItem(int index) const;
     void removeItem(int index);
     void heal(int amount);
     
+    // Snapshot section (Snapshot.h). Weapons are rebuilt with sprites from
+    // `sprites`; the player's own texture is kept
+    void save(SnapshotWriter& out) const;
+    bool load(SnapshotReader& in, const WeaponSprites& sprites);
+    
 private:
     Vector2 position;
     Vector2 velocity;
@@ -103,11 +129,12 @@ private:
     // Weapon inventory (max 6 weapons like Brotato)
     std::vector<std::unique_ptr<Weapon>> weapons;
     static const int MAX_WEAPONS = 6;
+    Vector2 weaponAim[MAX_WEAPONS];   // Set by aimWeapons()
+    Vector2 weaponPosition(int index) const;
     
     // Item inventory (max 6 items like weapons)
     std::vector<std::unique_ptr<Item>> items;
-    static const int MAX_ITEMS = 6;
     
     // Player sprite
-    SDL_Texture* playerTexture;
+    TextureHandle playerTexture;
 };
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "QualityGovernor.h"
+#include "Log.h"
+#include <algorithm>
+
+namespace {
+    // particles, bobbing, blink, muzzle flashes, menu effects, resolution
+    const QualitySettings TIERS[QualityGovernor::TIER_COUNT] = {
+        {1.0f,  true,  true,  true,  true,  1.0f},
+        {0.5f,  true,  true,  true,  true,  1.0f},
+        {0.5f,  false, false, true,  true,  1.0f},
+        {0.25f, false, false, false, false, 1.0f},
+        {0.25f, false, false, false, false, 0.75f},
+        {0.25f, false, false, false, false, 0.5f},
+    };
+}
+
+const QualitySettings& QualityGovernor::tierSettings(int t) {
+    return TIERS[std::clamp(t, 0, TIER_COUNT - 1)];
+}
+
+void QualityGovernor::configure(float frameBudgetMs, bool overlappedFrames) {
+    budgetMs = frameBudgetMs;
+    overlapped = overlappedFrames;
+    smoothedMs = 0.0f;
+    framesSinceChange = 0;
+    framesUnder = 0;
+}
+
+void QualityGovernor::lockTier(int t) {
+    locked = true;
+    tier = std::clamp(t, 0, TIER_COUNT - 1);
+}
+
+bool QualityGovernor::recordFrame(float updateMs, float renderMs) {
+    framesAtTier[tier]++;
+    if (locked || budgetMs <= 0.0f) return false;
+
+    float frameMs = overlapped ? std::max(updateMs, renderMs) : updateMs + renderMs;
+    if (frameMs <= 0.0f) return false;
+
+    // Exponential moving average so single spikes don't trigger a change
+    smoothedMs = smoothedMs == 0.0f ? frameMs : smoothedMs * 0.9f + frameMs * 0.1f;
+    framesSinceChange++;
+    framesUnder = smoothedMs < budgetMs * RAISE_THRESHOLD ? framesUnder + 1 : 0;
+
+    if (smoothedMs > budgetMs && framesSinceChange >= SETTLE_FRAMES && tier < TIER_COUNT - 1) {
+        // Raised into a tier we couldn't hold: wait longer before trying again
+        if (lastChangeWasRaise && framesSinceChange < raiseHoldFrames) {
+            raiseHoldFrames = std::min(MAX_RAISE_FRAMES, raiseHoldFrames * 2);
+        }
+        setTier(tier + 1);
+        lastChangeWasRaise = false;
+        LOG_INFO(RENDER, "Quality: down to tier %d (%.1f ms against %.1f ms budget)", tier, smoothedMs, budgetMs);
+        return true;
+    }
+    if (framesUnder >= raiseHoldFrames && tier > 0) {
+        // Two raises in a row: the last one held, so back to the short hold
+        if (lastChangeWasRaise) {
+            raiseHoldFrames = RAISE_FRAMES;
+        }
+        setTier(tier - 1);
+        lastChangeWasRaise = true;
+        LOG_INFO(RENDER, "Quality: up to tier %d (%.1f ms against %.1f ms budget)", tier, smoothedMs, budgetMs);
+        return true;
+    }
+    return false;
+}
+
+void QualityGovernor::setTier(int newTier) {
+    tier = newTier;
+    tierChanges++;
+    framesSinceChange = 0;
+    framesUnder = 0;
+}
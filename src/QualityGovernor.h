@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+
+// What a quality tier allows. Tier 0 has everything on
+struct QualitySettings {
+    float particleDensity;   // Fraction of each burst's particles (the rest merge into bigger ones)
+    bool pickupBobbing;
+    bool telegraphBlink;     // Off: spawn telegraphs draw as a steady two-line cross
+    bool muzzleFlashes;
+    bool menuEffects;        // Off: menus skip the translucent full-screen dim
+    float resolutionScale;   // Fraction of the configured internal resolution
+};
+
+// Adaptive quality. Fed each frame's update and render time, it steps down one
+// tier after SETTLE_FRAMES over budget, and back up one tier only after
+// raiseHoldFrames in a row under RAISE_THRESHOLD of the budget. Cheap effects
+// go first and internal resolution last.
+//
+// A tier that has to be dropped again soon after being raised doubles the
+// hold before the next raise, so a load sitting right at the budget doesn't
+// flip-flop between two tiers.
+class QualityGovernor {
+public:
+    static const int TIER_COUNT = 6;
+
+    // overlapped: update runs on the simulation thread while the previous frame
+    // renders, so a frame costs the longer of the two rather than their sum
+    void configure(float frameBudgetMs, bool overlapped);
+    // Stay at this tier and ignore timings
+    void lockTier(int tier);
+
+    // Once per frame; true when the tier changed
+    bool recordFrame(float updateMs, float renderMs);
+
+    int getTier() const { return tier; }
+    bool isAdaptive() const { return !locked; }
+    const QualitySettings& getSettings() const { return tierSettings(tier); }
+    static const QualitySettings& tierSettings(int tier);
+
+    // Frames spent at each tier, for the exit summary
+    uint64_t getFramesAtTier(int t) const { return framesAtTier[t]; }
+    int getTierChanges() const { return tierChanges; }
+
+private:
+    void setTier(int newTier);
+
+    float budgetMs = 16.6f;
+    bool overlapped = true;
+    bool locked = false;
+    int tier = 0;
+
+    float smoothedMs = 0.0f;
+    int framesSinceChange = 0;
+    int framesUnder = 0;
+    int raiseHoldFrames = RAISE_FRAMES;
+    bool lastChangeWasRaise = false;
+
+    uint64_t framesAtTier[TIER_COUNT] = {};
+    int tierChanges = 0;
+
+    static constexpr int SETTLE_FRAMES = 30;        // Frames to wait after a change before stepping down again
+    static constexpr int RAISE_FRAMES = 120;        // Headroom needed in a row before stepping back up
+    static constexpr int MAX_RAISE_FRAMES = 1920;
+    static constexpr float RAISE_THRESHOLD = 0.7f;  // Headroom means under 70% of the budget
+};
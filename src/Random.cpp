@@ -0,0 +1,35 @@
+#include "Random.h"
+
+Pcg32::Pcg32(uint64_t seedValue, uint64_t stream) {
+    seed(seedValue, stream);
+}
+
+void Pcg32::seed(uint64_t seedValue, uint64_t stream) {
+    state = 0;
+    increment = (stream << 1) | 1; // Must be odd
+    (*this)();
+    state += seedValue;
+    (*this)();
+}
+
+Pcg32::result_type Pcg32::operator()() {
+    uint64_t old = state;
+    state = old * 6364136223846793005ULL + increment;
+    uint32_t xorShifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+    uint32_t rotation = static_cast<uint32_t>(old >> 59);
+    return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+}
+
+namespace Random {
+    static Pcg32 streams[RANDOM_STREAM_COUNT];
+
+    Pcg32& stream(RandomStream stream) {
+        return streams[static_cast<int>(stream)];
+    }
+
+    void seedAll(uint64_t seed) {
+        for (int i = 0; i < RANDOM_STREAM_COUNT; i++) {
+            streams[i].seed(seed, static_cast<uint64_t>(i));
+        }
+    }
+}
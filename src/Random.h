@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+
+// PCG32 (XSH-RR): 64-bit state plus a stream selector, 32-bit output. Sixteen
+// bytes per generator, so simulation snapshots can carry every stream. Satisfies
+// UniformRandomBitGenerator, so the <random> distributions accept it.
+class Pcg32 {
+public:
+    using result_type = uint32_t;
+
+    explicit Pcg32(uint64_t seed = 0x853c49e6748fea9bULL, uint64_t stream = 0);
+    void seed(uint64_t seed, uint64_t stream = 0);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+    result_type operator()();
+
+    // Raw state, for snapshots
+    uint64_t state;
+    uint64_t increment;
+};
+
+// Independent streams, so extra draws in one system (more particles, a
+// shop reroll) don't shift what every other system rolls
+enum class RandomStream : uint8_t {
+    SPAWNS,     // Spawn positions and enemy types
+    DROPS,      // Material drop rolls
+    COMBAT,     // Crits, spread, dodge
+    SHOP,       // Shop stock
+    EFFECTS     // Particles and pickup bob phases
+};
+
+static const int RANDOM_STREAM_COUNT = 5;
+
+namespace Random {
+    Pcg32& stream(RandomStream stream);
+    void seedAll(uint64_t seed);
+}
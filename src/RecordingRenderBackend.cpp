@@ -0,0 +1,74 @@
+#include "RecordingRenderBackend.h"
+#include "Log.h"
+#include <cstdio>
+
+RecordingRenderBackend::RecordingRenderBackend(RenderBackend* innerBackend) : inner(innerBackend) {
+}
+
+void RecordingRenderBackend::drawWorld(RenderQueue& world, SDL_Color clearColor) {
+    current.worldCommands = world.size();
+    if (inner) {
+        inner->drawWorld(world, clearColor);
+    } else {
+        world.clear();
+    }
+}
+
+void RecordingRenderBackend::drawOverlay(const DrawList& overlay) {
+    current.overlayCommands = static_cast<int>(overlay.getCommands().size());
+    current.textCommands = 0;
+    for (const DrawList::Command& command : overlay.getCommands()) {
+        if (command.type == DrawList::CommandType::TEXT) current.textCommands++;
+    }
+    lastOverlay = overlay;
+    if (inner) inner->drawOverlay(overlay);
+}
+
+void RecordingRenderBackend::present() {
+    frames.push_back(current);
+    current = FrameRecord();
+    if (inner) inner->present();
+}
+
+static const char* commandName(DrawList::CommandType type) {
+    switch (type) {
+        case DrawList::CommandType::SPRITE: return "sprite";
+        case DrawList::CommandType::QUAD: return "quad";
+        case DrawList::CommandType::QUAD_OUTLINE: return "outline";
+        case DrawList::CommandType::LINE: return "line";
+        case DrawList::CommandType::TEXT: return "text";
+        case DrawList::CommandType::CLIP: return "clip";
+    }
+    return "?";
+}
+
+bool RecordingRenderBackend::save(const std::string& path) const {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        LOG_ERROR(RENDER, "Could not write draw capture %s", path.c_str());
+        return false;
+    }
+
+    std::fprintf(file, "# %zu frames: world, overlay and text commands per frame\n", frames.size());
+    for (size_t i = 0; i < frames.size(); i++) {
+        const FrameRecord& record = frames[i];
+        std::fprintf(file, "frame %zu %d %d %d\n", i, record.worldCommands, record.overlayCommands, record.textCommands);
+    }
+
+    // Texture pointers differ between runs and are left out
+    std::fprintf(file, "# last frame overlay: type x y w h rgba blend [text]\n");
+    for (const DrawList::Command& command : lastOverlay.getCommands()) {
+        const SDL_Rect& r = command.rect;
+        const SDL_Color& c = command.color;
+        std::fprintf(file, "%s %d %d %d %d %02x%02x%02x%02x %d", commandName(command.type),
+                     r.x, r.y, r.w, r.h, c.r, c.g, c.b, c.a, static_cast<int>(command.blend));
+        if (command.type == DrawList::CommandType::TEXT) {
+            std::fprintf(file, " %d \"%s\"", command.fontSize, lastOverlay.textOf(command));
+        }
+        std::fputc('\n', file);
+    }
+
+    std::fclose(file);
+    LOG_INFO(RENDER, "Wrote %zu frames of draw capture to %s", frames.size(), path.c_str());
+    return true;
+}
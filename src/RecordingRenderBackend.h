@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "RenderBackend.h"
+
+// Records what every frame submits, then hands the frame on to another backend
+// (or drops it when there is none). save() writes a plain-text capture: command
+// counts per frame and the last frame's overlay command by command, so a seeded
+// autopilot run can be diffed against a known-good capture.
+class RecordingRenderBackend : public RenderBackend {
+public:
+    // inner may be null; it must outlive the recorder
+    explicit RecordingRenderBackend(RenderBackend* inner);
+
+    const char* getName() const override { return "recording"; }
+    void drawWorld(RenderQueue& world, SDL_Color clearColor) override;
+    void drawOverlay(const DrawList& overlay) override;
+    void present() override;
+
+    bool save(const std::string& path) const;
+
+private:
+    struct FrameRecord {
+        int worldCommands = 0;
+        int overlayCommands = 0;
+        int textCommands = 0;
+    };
+
+    RenderBackend* inner;
+    std::vector<FrameRecord> frames;
+    FrameRecord current;
+    DrawList lastOverlay;
+};
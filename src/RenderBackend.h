@@ -0,0 +1,35 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include "RenderQueue.h"
+#include "DrawList.h"
+
+enum class RenderBackendType {
+    SDL,        // SdlRenderBackend
+    SOFTWARE,   // SoftwareRenderBackend
+    NONE        // NullRenderBackend
+};
+
+// Executes a recorded frame. Game code only ever records (RenderQueue for the
+// world, DrawList for screen-space UI); how the commands get batched, sorted
+// and submitted, or whether they're drawn at all, is up to the backend.
+// Backends are driven from the render thread only (see FramePipeline.h).
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+    virtual const char* getName() const = 0;
+
+    // World pass in logical coordinates; consumes (clears) the queue
+    virtual void drawWorld(RenderQueue& world, SDL_Color clearColor) = 0;
+    // Screen-space pass on top of the world, in submission order
+    virtual void drawOverlay(const DrawList& overlay) = 0;
+    virtual void present() = 0;
+};
+
+// Drops everything: headless benchmarks and soak tests pay only for recording
+class NullRenderBackend : public RenderBackend {
+public:
+    const char* getName() const override { return "null"; }
+    void drawWorld(RenderQueue& world, SDL_Color) override { world.clear(); }
+    void drawOverlay(const DrawList&) override {}
+    void present() override {}
+};
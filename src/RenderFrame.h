@@ -0,0 +1,27 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include "RenderQueue.h"
+#include "DrawList.h"
+#include "Vector2.h"
+#include "RenderScaler.h"
+
+// What the render thread samples for the simulation each frame: raw device state
+// plus the mapping to logical coordinates, which belongs to the renderer
+struct FrameInput {
+    Uint8 keys[SDL_NUM_SCANCODES] = {};
+    Vector2 mouse;                // Logical coordinates
+    bool mousePressed = false;
+    bool quit = false;            // Window closed
+    Viewport view = {0.0f, 0.0f, static_cast<float>(LOGICAL_WIDTH), static_cast<float>(LOGICAL_HEIGHT)};
+};
+
+// One immutable gameplay frame: the recorded world pass (unsorted until the
+// backend flushes it) and the screen-space UI on top. Recorded by the simulation
+// thread and drawn by the render thread; see FramePipeline
+struct RenderFrame {
+    RenderQueue world;
+    DrawList overlay;
+    uint64_t tick = 0;
+    float simulationMs = 0.0f;      // Input, update and recording time for this frame
+};
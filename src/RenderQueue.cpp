@@ -0,0 +1,394 @@
+#include "RenderQueue.h"
+#include <cmath>
+
+namespace {
+    // Key layout, most significant first:
+    // layer 8 | blend 4 | texture 12 | depth 16 | sequence 24
+    constexpr int SEQUENCE_BITS = 24;
+    constexpr int DEPTH_SHIFT = 24;
+    constexpr int TEXTURE_SHIFT = 40;
+    constexpr int BLEND_SHIFT = 52;
+    constexpr int LAYER_SHIFT = 56;
+    constexpr uint64_t SEQUENCE_MASK = (uint64_t(1) << SEQUENCE_BITS) - 1;
+    constexpr uint16_t MAX_TEXTURES = 0xFFF;
+
+    uint64_t blendOrder(SDL_BlendMode blend) {
+        switch (blend) {
+            case SDL_BLENDMODE_NONE: return 0;
+            case SDL_BLENDMODE_BLEND: return 1;
+            case SDL_BLENDMODE_ADD: return 2;
+            case SDL_BLENDMODE_MOD: return 3;
+            default: return 4;
+        }
+    }
+
+    bool sameColor(SDL_Color a, SDL_Color b) {
+        return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+    }
+
+    const SDL_Color DEFAULT_MOD = {255, 255, 255, 255};
+}
+
+void RenderQueue::setLayerEnabled(RenderLayer layer, bool enabled) {
+    uint32_t bit = uint32_t(1) << static_cast<uint8_t>(layer);
+    disabledLayers = enabled ? disabledLayers & ~bit : disabledLayers | bit;
+}
+
+void RenderQueue::push(RenderLayer layer, uint16_t depth, const Command& command) {
+    if (disabledLayers & (uint32_t(1) << static_cast<uint8_t>(layer))) return;
+    if (commands.size() > SEQUENCE_MASK) return; // Out of sequence numbers; drop rather than misorder
+    uint16_t texture = textureId(command.texture);
+    if (command.texture && texture == 0) return;  // Texture table full
+
+    uint64_t key = (uint64_t(static_cast<uint8_t>(layer)) << LAYER_SHIFT)
+                 | (blendOrder(command.blend) << BLEND_SHIFT)
+                 | (uint64_t(texture) << TEXTURE_SHIFT)
+                 | (uint64_t(depth) << DEPTH_SHIFT)
+                 | uint64_t(commands.size());
+    keys.push_back(key);
+    commands.push_back(command);
+}
+
+uint16_t RenderQueue::textureId(SDL_Texture* texture) {
+    if (!texture) return 0;
+    // A handful of textures per frame, so a linear scan beats hashing
+    for (size_t i = 0; i < textures.size(); i++) {
+        if (textures[i] == texture) return static_cast<uint16_t>(i + 1);
+    }
+    if (textures.size() >= MAX_TEXTURES) return 0;
+    textures.push_back(texture);
+    textureStates.push_back({DEFAULT_MOD, SDL_BLENDMODE_BLEND, false});
+    return static_cast<uint16_t>(textures.size());
+}
+
+void RenderQueue::sprite(RenderLayer layer, uint16_t depth, SDL_Texture* texture, const SDL_Rect& dst,
+                         SDL_Color mod, SDL_BlendMode blend) {
+    if (!texture) return;
+    push(layer, depth, {CommandType::SPRITE, blend, mod, texture, dst, 0, 0});
+}
+
+void RenderQueue::rotatedSprite(RenderLayer layer, uint16_t depth, SDL_Texture* texture, const SDL_Rect& dst,
+                                float degrees, SDL_Color mod, SDL_BlendMode blend) {
+    if (!texture) return;
+    push(layer, depth, {CommandType::ROTATED_SPRITE, blend, mod, texture, dst, 0, 0, degrees});
+}
+
+void RenderQueue::fillCircle(RenderLayer layer, uint16_t depth, int centerX, int centerY, int radius, SDL_Color color,
+                             SDL_BlendMode blend) {
+    push(layer, depth, {CommandType::FILL_CIRCLE, blend, color, nullptr, {centerX, centerY, radius, 0}, 0, 0});
+}
+
+void RenderQueue::circleOutline(RenderLayer layer, uint16_t depth, int centerX, int centerY, int radius, SDL_Color color,
+                                SDL_BlendMode blend) {
+    push(layer, depth, {CommandType::CIRCLE_OUTLINE, blend, color, nullptr, {centerX, centerY, radius, 0}, 0, 0});
+}
+
+void RenderQueue::ring(RenderLayer layer, uint16_t depth, int centerX, int centerY, int inner, int outer, SDL_Color color,
+                       SDL_BlendMode blend) {
+    push(layer, depth, {CommandType::RING, blend, color, nullptr, {centerX, centerY, outer, inner}, 0, 0});
+}
+
+void RenderQueue::fillRect(RenderLayer layer, uint16_t depth, const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend) {
+    push(layer, depth, {CommandType::FILL_RECT, blend, color, nullptr, rect, 0, 0});
+}
+
+void RenderQueue::rectOutline(RenderLayer layer, uint16_t depth, const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend) {
+    push(layer, depth, {CommandType::RECT_OUTLINE, blend, color, nullptr, rect, 0, 0});
+}
+
+void RenderQueue::points(RenderLayer layer, uint16_t depth, const SDL_Point* pts, int count, SDL_Color color,
+                         SDL_BlendMode blend) {
+    if (count <= 0) return;
+    int offset = static_cast<int>(pointPool.size());
+    pointPool.insert(pointPool.end(), pts, pts + count);
+    push(layer, depth, {CommandType::POINTS, blend, color, nullptr, {0, 0, 0, 0}, offset, count});
+}
+
+void RenderQueue::lines(RenderLayer layer, uint16_t depth, const SDL_Point* pts, int count, SDL_Color color,
+                        SDL_BlendMode blend) {
+    if (count < 2) return;
+    int offset = static_cast<int>(pointPool.size());
+    pointPool.insert(pointPool.end(), pts, pts + count);
+    push(layer, depth, {CommandType::LINES, blend, color, nullptr, {0, 0, 0, 0}, offset, count});
+}
+
+void RenderQueue::sortKeys() {
+    // LSD radix sort, one byte per pass. Passes where every key has the same
+    // byte (usually the layer/blend/texture bytes inside a busy frame) are skipped.
+    const size_t n = keys.size();
+    sortScratch.resize(n);
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {};
+        for (uint64_t key : keys) {
+            counts[(key >> shift) & 0xFF]++;
+        }
+        if (counts[(keys[0] >> shift) & 0xFF] == n) continue;
+
+        size_t offset = 0;
+        for (size_t& count : counts) {
+            size_t c = count;
+            count = offset;
+            offset += c;
+        }
+        for (uint64_t key : keys) {
+            sortScratch[counts[(key >> shift) & 0xFF]++] = key;
+        }
+        keys.swap(sortScratch);
+    }
+}
+
+void RenderQueue::setDrawState(SDL_Renderer* renderer, SDL_Color color, SDL_BlendMode blend) {
+    if (drawStateKnown && sameColor(color, drawColor) && blend == drawBlend) {
+        stats.redundantSkipped++;
+        return;
+    }
+    // Everything merged so far was meant for the old state
+    submitBatches(renderer);
+    if (!drawStateKnown || blend != drawBlend) {
+        SDL_SetRenderDrawBlendMode(renderer, blend);
+        drawBlend = blend;
+        stats.stateChanges++;
+    }
+    if (!drawStateKnown || !sameColor(color, drawColor)) {
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        drawColor = color;
+        stats.stateChanges++;
+    }
+    drawStateKnown = true;
+}
+
+void RenderQueue::setTextureState(SDL_Texture* texture, uint16_t id, SDL_Color mod, SDL_BlendMode blend) {
+    TextureState& state = textureStates[id - 1];
+    bool changed = false;
+    if (state.blend != blend) {
+        SDL_SetTextureBlendMode(texture, blend);
+        state.blend = blend;
+        stats.stateChanges++;
+        changed = true;
+    }
+    if (state.mod.r != mod.r || state.mod.g != mod.g || state.mod.b != mod.b) {
+        SDL_SetTextureColorMod(texture, mod.r, mod.g, mod.b);
+        stats.stateChanges++;
+        changed = true;
+    }
+    if (state.mod.a != mod.a) {
+        SDL_SetTextureAlphaMod(texture, mod.a);
+        stats.stateChanges++;
+        changed = true;
+    }
+    if (changed) {
+        state.mod = mod;
+        state.touched = true;
+    } else {
+        stats.redundantSkipped++;
+    }
+}
+
+void RenderQueue::submitBatches(SDL_Renderer* renderer) {
+    if (!rectBatch.empty()) {
+        SDL_RenderFillRects(renderer, rectBatch.data(), static_cast<int>(rectBatch.size()));
+        rectBatch.clear();
+        stats.drawCalls++;
+    }
+    if (!pointBatch.empty()) {
+        SDL_RenderDrawPoints(renderer, pointBatch.data(), static_cast<int>(pointBatch.size()));
+        pointBatch.clear();
+        stats.drawCalls++;
+    }
+}
+
+void RenderQueue::appendCircleRows(int centerX, int centerY, int radius) {
+    // One span per row; same pixels as testing x*x + y*y <= r*r point by point
+    for (int y = -radius; y <= radius; y++) {
+        int half = static_cast<int>(std::sqrt(static_cast<float>(radius * radius - y * y)));
+        while ((half + 1) * (half + 1) + y * y <= radius * radius) half++;
+        while (half > 0 && half * half + y * y > radius * radius) half--;
+        rectBatch.push_back({centerX - half, centerY + y, 2 * half + 1, 1});
+    }
+}
+
+void RenderQueue::appendCircleOutline(int centerX, int centerY, int radius) {
+    // Midpoint circle, 8 octants per step
+    int x = 0;
+    int y = radius;
+    int d = 3 - 2 * radius;
+    while (y >= x) {
+        pointBatch.push_back({centerX + x, centerY + y});
+        pointBatch.push_back({centerX - x, centerY + y});
+        pointBatch.push_back({centerX + x, centerY - y});
+        pointBatch.push_back({centerX - x, centerY - y});
+        pointBatch.push_back({centerX + y, centerY + x});
+        pointBatch.push_back({centerX - y, centerY + x});
+        pointBatch.push_back({centerX + y, centerY - x});
+        pointBatch.push_back({centerX - y, centerY - x});
+        x++;
+        if (d > 0) {
+            y--;
+            d = d + 4 * (x - y) + 10;
+        } else {
+            d = d + 4 * x + 6;
+        }
+    }
+}
+
+void RenderQueue::appendRing(int centerX, int centerY, int inner, int outer) {
+    for (int x = -outer; x <= outer; x++) {
+        for (int y = -outer; y <= outer; y++) {
+            int distanceSq = x * x + y * y;
+            if (distanceSq <= outer * outer && distanceSq > inner * inner) {
+                pointBatch.push_back({centerX + x, centerY + y});
+            }
+        }
+    }
+}
+
+void RenderQueue::flush(SDL_Renderer* renderer) {
+    stats = Stats();
+    stats.commands = static_cast<int>(commands.size());
+    drawStateKnown = false;
+
+    if (!commands.empty()) {
+        sortKeys();
+    }
+
+    for (uint64_t key : keys) {
+        const Command& command = commands[key & SEQUENCE_MASK];
+        const SDL_Rect& r = command.rect;
+        switch (command.type) {
+            case CommandType::SPRITE: {
+                submitBatches(renderer);
+                uint16_t id = static_cast<uint16_t>((key >> TEXTURE_SHIFT) & MAX_TEXTURES);
+                setTextureState(command.texture, id, command.color, command.blend);
+                SDL_RenderCopy(renderer, command.texture, nullptr, &r);
+                stats.drawCalls++;
+                break;
+            }
+            case CommandType::ROTATED_SPRITE: {
+                submitBatches(renderer);
+                uint16_t id = static_cast<uint16_t>((key >> TEXTURE_SHIFT) & MAX_TEXTURES);
+                setTextureState(command.texture, id, command.color, command.blend);
+                SDL_RenderCopyEx(renderer, command.texture, nullptr, &r, command.angle, nullptr, SDL_FLIP_NONE);
+                stats.drawCalls++;
+                break;
+            }
+            case CommandType::FILL_CIRCLE:
+                setDrawState(renderer, command.color, command.blend);
+                appendCircleRows(r.x, r.y, r.w);
+                break;
+            case CommandType::CIRCLE_OUTLINE:
+                setDrawState(renderer, command.color, command.blend);
+                appendCircleOutline(r.x, r.y, r.w);
+                break;
+            case CommandType::RING:
+                setDrawState(renderer, command.color, command.blend);
+                appendRing(r.x, r.y, r.h, r.w);
+                break;
+            case CommandType::FILL_RECT:
+                setDrawState(renderer, command.color, command.blend);
+                rectBatch.push_back(r);
+                break;
+            case CommandType::RECT_OUTLINE:
+                // Four one-pixel edges, so outlines merge with the filled batch
+                setDrawState(renderer, command.color, command.blend);
+                rectBatch.push_back({r.x, r.y, r.w, 1});
+                rectBatch.push_back({r.x, r.y + r.h - 1, r.w, 1});
+                rectBatch.push_back({r.x, r.y, 1, r.h});
+                rectBatch.push_back({r.x + r.w - 1, r.y, 1, r.h});
+                break;
+            case CommandType::POINTS:
+                setDrawState(renderer, command.color, command.blend);
+                pointBatch.insert(pointBatch.end(), pointPool.begin() + command.pointOffset,
+                                  pointPool.begin() + command.pointOffset + command.pointCount);
+                break;
+            case CommandType::LINES:
+                setDrawState(renderer, command.color, command.blend);
+                submitBatches(renderer);
+                SDL_RenderDrawLines(renderer, &pointPool[command.pointOffset], command.pointCount);
+                stats.drawCalls++;
+                break;
+        }
+    }
+    submitBatches(renderer);
+
+    // Leave shared textures and the draw blend mode the way other code expects them
+    for (size_t i = 0; i < textures.size(); i++) {
+        TextureState& state = textureStates[i];
+        if (!state.touched) continue;
+        if (state.blend != SDL_BLENDMODE_BLEND) SDL_SetTextureBlendMode(textures[i], SDL_BLENDMODE_BLEND);
+        if (state.mod.r != 255 || state.mod.g != 255 || state.mod.b != 255) SDL_SetTextureColorMod(textures[i], 255, 255, 255);
+        if (state.mod.a != 255) SDL_SetTextureAlphaMod(textures[i], 255);
+    }
+    if (drawStateKnown && drawBlend != SDL_BLENDMODE_NONE) {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    }
+
+    lastStats = stats;
+    clear();
+}
+
+void RenderQueue::flush(Rasterizer& target) {
+    stats = Stats();
+    stats.commands = static_cast<int>(commands.size());
+
+    if (!commands.empty()) {
+        sortKeys();
+    }
+
+    // No draw state to track here; the batches are only reused as scratch for expanded shapes
+    for (uint64_t key : keys) {
+        const Command& command = commands[key & SEQUENCE_MASK];
+        const SDL_Rect& r = command.rect;
+        switch (command.type) {
+            case CommandType::SPRITE:
+                target.sprite(command.texture, r, 0.0f, command.color, command.blend);
+                break;
+            case CommandType::ROTATED_SPRITE:
+                target.sprite(command.texture, r, command.angle, command.color, command.blend);
+                break;
+            case CommandType::FILL_CIRCLE:
+                appendCircleRows(r.x, r.y, r.w);
+                break;
+            case CommandType::CIRCLE_OUTLINE:
+                appendCircleOutline(r.x, r.y, r.w);
+                break;
+            case CommandType::RING:
+                appendRing(r.x, r.y, r.h, r.w);
+                break;
+            case CommandType::FILL_RECT:
+                target.fillRects(&r, 1, command.color, command.blend);
+                break;
+            case CommandType::RECT_OUTLINE:
+                rectBatch.push_back({r.x, r.y, r.w, 1});
+                rectBatch.push_back({r.x, r.y + r.h - 1, r.w, 1});
+                rectBatch.push_back({r.x, r.y, 1, r.h});
+                rectBatch.push_back({r.x + r.w - 1, r.y, 1, r.h});
+                break;
+            case CommandType::POINTS:
+                target.points(&pointPool[command.pointOffset], command.pointCount, command.color, command.blend);
+                break;
+            case CommandType::LINES:
+                target.lines(&pointPool[command.pointOffset], command.pointCount, command.color, command.blend);
+                break;
+        }
+        if (!rectBatch.empty()) {
+            target.fillRects(rectBatch.data(), static_cast<int>(rectBatch.size()), command.color, command.blend);
+            rectBatch.clear();
+        }
+        if (!pointBatch.empty()) {
+            target.points(pointBatch.data(), static_cast<int>(pointBatch.size()), command.color, command.blend);
+            pointBatch.clear();
+        }
+        stats.drawCalls++;
+    }
+
+    lastStats = stats;
+    clear();
+}
+
+void RenderQueue::clear() {
+    commands.clear();
+    keys.clear();
+    pointPool.clear();
+    textures.clear();
+    textureStates.clear();
+}
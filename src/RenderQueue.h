@@ -0,0 +1,151 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+// Draw order of the world pass, back to front
+enum class RenderLayer : uint8_t {
+    PLAYER,
+    WEAPONS,
+    MUZZLE_FLASHES,     // Untextured, so it needs its own layer to stay above the weapon sprites
+    BOSS,
+    BULLETS,
+    ENEMIES,
+    SPAWN_INDICATORS,
+    PICKUPS,
+    BOMBS,
+    PARTICLES
+};
+
+// Collects the world pass's draws and submits them sorted by
+// (layer, blend, texture, depth), so draws sharing a texture and blend mode run
+// back to back. Layers keep their order; inside a layer `depth` only orders
+// draws of the same texture and blend (e.g. an orb's glow, body and highlight).
+// Draws with equal keys keep their submission order.
+//
+// While submitting, draw colour, draw blend mode and per-texture colour/alpha
+// mod and blend mode are only set when they actually change. Textures are
+// expected at their defaults (white, opaque, BLEND) when queued and are put
+// back to them after flush(). Same-state filled shapes and points are merged
+// into single SDL_RenderFillRects/SDL_RenderDrawPoints calls.
+class RenderQueue {
+public:
+    struct Stats {
+        int commands = 0;
+        int stateChanges = 0;      // SDL state calls issued
+        int redundantSkipped = 0;  // State calls filtered out because nothing changed
+        int drawCalls = 0;
+    };
+
+    // Receives the queue in submission order from flush(Rasterizer&), for
+    // backends that draw without an SDL_Renderer. Circles, rings and outlines
+    // arrive already expanded into spans and points, the same pixels SDL gets.
+    class Rasterizer {
+    public:
+        virtual ~Rasterizer() = default;
+        // degrees = 0 for unrotated sprites; mod is the colour/alpha mod
+        virtual void sprite(SDL_Texture* texture, const SDL_Rect& dst, float degrees, SDL_Color mod,
+                            SDL_BlendMode blend) = 0;
+        virtual void fillRects(const SDL_Rect* rects, int count, SDL_Color color, SDL_BlendMode blend) = 0;
+        virtual void points(const SDL_Point* pts, int count, SDL_Color color, SDL_BlendMode blend) = 0;
+        // Connected segments, endpoints included
+        virtual void lines(const SDL_Point* pts, int count, SDL_Color color, SDL_BlendMode blend) = 0;
+    };
+
+    void sprite(RenderLayer layer, uint16_t depth, SDL_Texture* texture, const SDL_Rect& dst,
+                SDL_Color mod = {255, 255, 255, 255}, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+    // Rotated clockwise by `degrees` around the centre of dst
+    void rotatedSprite(RenderLayer layer, uint16_t depth, SDL_Texture* texture, const SDL_Rect& dst, float degrees,
+                       SDL_Color mod = {255, 255, 255, 255}, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+    void fillCircle(RenderLayer layer, uint16_t depth, int centerX, int centerY, int radius, SDL_Color color,
+                    SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    // One-pixel midpoint circle
+    void circleOutline(RenderLayer layer, uint16_t depth, int centerX, int centerY, int radius, SDL_Color color,
+                       SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    // Pixels with inner < distance <= outer
+    void ring(RenderLayer layer, uint16_t depth, int centerX, int centerY, int inner, int outer, SDL_Color color,
+              SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    void fillRect(RenderLayer layer, uint16_t depth, const SDL_Rect& rect, SDL_Color color,
+                  SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    void rectOutline(RenderLayer layer, uint16_t depth, const SDL_Rect& rect, SDL_Color color,
+                     SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    void points(RenderLayer layer, uint16_t depth, const SDL_Point* pts, int count, SDL_Color color,
+                SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+    // Connected line segments through `count` points
+    void lines(RenderLayer layer, uint16_t depth, const SDL_Point* pts, int count, SDL_Color color,
+               SDL_BlendMode blend = SDL_BLENDMODE_NONE);
+
+    // Draws queued on a disabled layer are dropped (quality tiers). Survives clear()
+    void setLayerEnabled(RenderLayer layer, bool enabled);
+
+    // Sorts, submits and clears the queue
+    void flush(SDL_Renderer* renderer);
+    // Same order, handed to a software rasterizer instead; also clears the queue
+    void flush(Rasterizer& target);
+    // Drops everything queued without submitting it
+    void clear();
+    int size() const { return static_cast<int>(commands.size()); }
+    const Stats& getLastStats() const { return lastStats; }
+
+private:
+    enum class CommandType : uint8_t {
+        SPRITE,
+        ROTATED_SPRITE,
+        FILL_CIRCLE,
+        CIRCLE_OUTLINE,
+        RING,
+        FILL_RECT,
+        RECT_OUTLINE,
+        POINTS,
+        LINES
+    };
+
+    struct Command {
+        CommandType type;
+        SDL_BlendMode blend;
+        SDL_Color color;      // Draw colour, or colour/alpha mod for sprites
+        SDL_Texture* texture;
+        SDL_Rect rect;        // Sprite/rect destination; circles use x, y, w = radius, h = inner radius
+        int pointOffset;      // POINTS/LINES: range in pointPool
+        int pointCount;
+        float angle = 0.0f;   // ROTATED_SPRITE: degrees
+    };
+
+    struct TextureState {
+        SDL_Color mod;
+        SDL_BlendMode blend;
+        bool touched;
+    };
+
+    void push(RenderLayer layer, uint16_t depth, const Command& command);
+    uint16_t textureId(SDL_Texture* texture);
+    void sortKeys();
+
+    // Submission state
+    void setDrawState(SDL_Renderer* renderer, SDL_Color color, SDL_BlendMode blend);
+    void setTextureState(SDL_Texture* texture, uint16_t id, SDL_Color mod, SDL_BlendMode blend);
+    void submitBatches(SDL_Renderer* renderer);
+    void appendCircleRows(int centerX, int centerY, int radius);
+    void appendCircleOutline(int centerX, int centerY, int radius);
+    void appendRing(int centerX, int centerY, int inner, int outer);
+
+    uint32_t disabledLayers = 0;
+    std::vector<Command> commands;
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> sortScratch;
+    std::vector<SDL_Point> pointPool;
+
+    // Per-frame texture ids (0 = untextured)
+    std::vector<SDL_Texture*> textures;
+    std::vector<TextureState> textureStates;
+
+    // Pending merged primitives, all in the current draw state
+    std::vector<SDL_Rect> rectBatch;
+    std::vector<SDL_Point> pointBatch;
+    SDL_Color drawColor = {0, 0, 0, 0};
+    SDL_BlendMode drawBlend = SDL_BLENDMODE_NONE;
+    bool drawStateKnown = false;
+
+    Stats stats;
+    Stats lastStats;
+};
@@ -0,0 +1,141 @@
+#include "RenderScaler.h"
+#include "Log.h"
+#include <algorithm>
+
+RenderScaler::RenderScaler()
+    : renderer(nullptr), worldTarget(nullptr), internalScale(1.0f), configuredScale(1.0f),
+      targetWidth(0), targetHeight(0), dynamicEnabled(false), frameBudgetMs(16.6f),
+      smoothedFrameMs(0.0f), framesSinceChange(0) {
+}
+
+RenderScaler::~RenderScaler() {
+    shutdown();
+}
+
+bool RenderScaler::init(SDL_Renderer* r, float scale) {
+    renderer = r;
+    
+    // Logical size handles letterboxing and scaling for everything drawn to the window
+    if (SDL_RenderSetLogicalSize(renderer, LOGICAL_WIDTH, LOGICAL_HEIGHT) != 0) {
+        LOG_ERROR(RENDER, "Unable to set logical render size! SDL Error: %s", SDL_GetError());
+        return false;
+    }
+    
+    internalScale = std::max(MIN_SCALE, std::min(MAX_SCALE, scale));
+    configuredScale = internalScale;
+    if (!recreateTarget()) {
+        // Not fatal: the world is then drawn straight to the window at native resolution
+        LOG_WARN(RENDER, "Offscreen world target unavailable - rendering world at native resolution");
+    }
+    return true;
+}
+
+void RenderScaler::shutdown() {
+    if (worldTarget) {
+        SDL_DestroyTexture(worldTarget);
+        worldTarget = nullptr;
+    }
+}
+
+bool RenderScaler::recreateTarget() {
+    shutdown();
+    
+    targetWidth = static_cast<int>(LOGICAL_WIDTH * internalScale);
+    targetHeight = static_cast<int>(LOGICAL_HEIGHT * internalScale);
+    
+    // Linear filtering for the upscale; restore the previous hint for other textures
+    const char* previousQuality = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "1");
+    worldTarget = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                    targetWidth, targetHeight);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, previousQuality ? previousQuality : "0");
+    
+    if (!worldTarget) {
+        LOG_ERROR(RENDER, "Unable to create world render target! SDL Error: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(worldTarget, SDL_BLENDMODE_NONE);
+    return true;
+}
+
+void RenderScaler::beginWorld(SDL_Color clearColor) {
+    if (worldTarget && SDL_SetRenderTarget(renderer, worldTarget) == 0) {
+        // Target switches reset scale, so world coordinates are mapped here
+        SDL_RenderSetScale(renderer, internalScale, internalScale);
+    }
+    SDL_SetRenderDrawColor(renderer, clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+    SDL_RenderClear(renderer);
+}
+
+void RenderScaler::endWorld() {
+    if (!worldTarget || SDL_GetRenderTarget(renderer) != worldTarget) return;
+    
+    // Back to the window; its logical size mapping is restored by SDL
+    SDL_SetRenderTarget(renderer, nullptr);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Letterbox bars
+    SDL_RenderClear(renderer);
+    
+    SDL_Rect dst = {0, 0, LOGICAL_WIDTH, LOGICAL_HEIGHT};
+    SDL_RenderCopy(renderer, worldTarget, nullptr, &dst);
+}
+
+Vector2 RenderScaler::windowToLogical(int x, int y) const {
+    float lx = static_cast<float>(x);
+    float ly = static_cast<float>(y);
+    if (renderer) {
+        SDL_RenderWindowToLogical(renderer, x, y, &lx, &ly);
+    }
+    return Vector2(lx, ly);
+}
+
+Viewport RenderScaler::visibleWorld() const {
+    Viewport view = {0.0f, 0.0f, static_cast<float>(LOGICAL_WIDTH), static_cast<float>(LOGICAL_HEIGHT)};
+    SDL_Window* window = renderer ? SDL_RenderGetWindow(renderer) : nullptr;
+    if (!window) return view;
+    
+    // Window corners in logical space; the world target never extends past the logical area
+    int windowWidth, windowHeight;
+    SDL_GetWindowSize(window, &windowWidth, &windowHeight);
+    Vector2 topLeft = windowToLogical(0, 0);
+    Vector2 bottomRight = windowToLogical(windowWidth, windowHeight);
+    view.left = std::max(view.left, topLeft.x);
+    view.top = std::max(view.top, topLeft.y);
+    view.right = std::min(view.right, bottomRight.x);
+    view.bottom = std::min(view.bottom, bottomRight.y);
+    return view;
+}
+
+void RenderScaler::setInternalScale(float scale) {
+    scale = std::max(MIN_SCALE, std::min(MAX_SCALE, scale));
+    if (scale == internalScale && worldTarget) return;
+    
+    internalScale = scale;
+    recreateTarget();
+    framesSinceChange = 0;
+}
+
+void RenderScaler::enableDynamicResolution(bool enabled, float budgetMs) {
+    dynamicEnabled = enabled;
+    frameBudgetMs = budgetMs;
+    smoothedFrameMs = 0.0f;
+    framesSinceChange = 0;
+}
+
+void RenderScaler::recordFrameTime(float renderMs) {
+    if (!dynamicEnabled || !worldTarget) return;
+    
+    // Exponential moving average so single spikes don't trigger a change
+    smoothedFrameMs = (smoothedFrameMs == 0.0f) ? renderMs : smoothedFrameMs * 0.9f + renderMs * 0.1f;
+    
+    framesSinceChange++;
+    if (framesSinceChange < SETTLE_FRAMES) return;
+    
+    float floorScale = std::min(DYNAMIC_MIN_SCALE, configuredScale);
+    if (smoothedFrameMs > frameBudgetMs && internalScale > floorScale) {
+        setInternalScale(std::max(floorScale, internalScale - SCALE_STEP));
+        LOG_INFO(RENDER, "Dynamic resolution: scale down to %.2f", internalScale);
+    } else if (smoothedFrameMs < frameBudgetMs * RAISE_THRESHOLD && internalScale < configuredScale) {
+        setInternalScale(std::min(configuredScale, internalScale + SCALE_STEP));
+        LOG_INFO(RENDER, "Dynamic resolution: scale up to %.2f", internalScale);
+    }
+}
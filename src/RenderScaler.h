@@ -0,0 +1,76 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include "Vector2.h"
+
+// All gameplay and UI coordinates are authored against this logical resolution.
+// The window may be any size; RenderScaler maps logical space onto it.
+constexpr int LOGICAL_WIDTH = 1920;
+constexpr int LOGICAL_HEIGHT = 1080;
+
+// Visible part of the world in logical coordinates. Draw calls for anything
+// whose bounding circle misses it are skipped.
+struct Viewport {
+    float left;
+    float top;
+    float right;
+    float bottom;
+
+    bool contains(const Vector2& center, float radius) const {
+        return center.x + radius >= left && center.x - radius <= right &&
+               center.y + radius >= top && center.y - radius <= bottom;
+    }
+};
+
+// Renders the game world into an offscreen target at a configurable internal
+// resolution and scales it onto the window. UI is drawn afterwards straight to
+// the window at native resolution, so text and panels stay crisp.
+class RenderScaler {
+public:
+    RenderScaler();
+    ~RenderScaler();
+
+    bool init(SDL_Renderer* renderer, float internalScale);
+    void shutdown();
+
+    // World pass: everything between beginWorld/endWorld lands in the offscreen target
+    void beginWorld(SDL_Color clearColor);
+    void endWorld();
+
+    // Mouse and other window-space positions mapped into logical space
+    Vector2 windowToLogical(int x, int y) const;
+
+    // Logical rectangle currently visible in the window (letterbox bars excluded)
+    Viewport visibleWorld() const;
+
+    // Internal resolution control
+    void setInternalScale(float scale);
+    float getInternalScale() const { return internalScale; }
+
+    // Dynamic resolution controller. Fed with the measured render time each frame;
+    // steps the internal scale down when over budget and back up with headroom.
+    void enableDynamicResolution(bool enabled, float frameBudgetMs);
+    void recordFrameTime(float renderMs);
+
+private:
+    bool recreateTarget();
+
+    SDL_Renderer* renderer;
+    SDL_Texture* worldTarget;
+    float internalScale;
+    float configuredScale; // Ceiling for the dynamic controller
+    int targetWidth;
+    int targetHeight;
+
+    // Dynamic resolution state
+    bool dynamicEnabled;
+    float frameBudgetMs;
+    float smoothedFrameMs;
+    int framesSinceChange;
+
+    static constexpr float MIN_SCALE = 0.25f;
+    static constexpr float MAX_SCALE = 2.0f;
+    static constexpr float DYNAMIC_MIN_SCALE = 0.5f;
+    static constexpr float SCALE_STEP = 0.1f;
+    static constexpr int SETTLE_FRAMES = 30;     // Frames to wait after a change before re-evaluating
+    static constexpr float RAISE_THRESHOLD = 0.75f; // Raise again below 75% of budget
+};
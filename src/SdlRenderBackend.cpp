@@ -0,0 +1,150 @@
+#include "SdlRenderBackend.h"
+#include "Log.h"
+#include <cstdio>
+
+SdlRenderBackend::SdlRenderBackend(SDL_Renderer* sdlRenderer, RenderScaler& renderScaler, TTF_Font* textFont)
+    : renderer(sdlRenderer), scaler(renderScaler), font(textFont) {
+}
+
+SdlRenderBackend::~SdlRenderBackend() {
+    for (auto& entry : textCache) {
+        if (entry.second.texture) SDL_DestroyTexture(entry.second.texture);
+    }
+}
+
+void SdlRenderBackend::drawWorld(RenderQueue& world, SDL_Color clearColor) {
+    // World pass into the internal-resolution target
+    scaler.beginWorld(clearColor);
+    world.flush(renderer);
+
+    // Scale the world onto the window; the overlay draws at native resolution
+    scaler.endWorld();
+}
+
+void SdlRenderBackend::drawOverlay(const DrawList& overlay) {
+    // The world pass and the scaler leave the draw state behind
+    drawStateKnown = false;
+    bool clipped = false;
+
+    for (const DrawList::Command& command : overlay.getCommands()) {
+        const SDL_Rect& r = command.rect;
+        switch (command.type) {
+            case DrawList::CommandType::SPRITE: {
+                const SDL_Color& mod = command.color;
+                bool tinted = mod.r != 255 || mod.g != 255 || mod.b != 255;
+                if (tinted) SDL_SetTextureColorMod(command.texture, mod.r, mod.g, mod.b);
+                if (mod.a != 255) SDL_SetTextureAlphaMod(command.texture, mod.a);
+                SDL_RenderCopy(renderer, command.texture, nullptr, &r);
+                // Shared textures are expected back at their defaults
+                if (tinted) SDL_SetTextureColorMod(command.texture, 255, 255, 255);
+                if (mod.a != 255) SDL_SetTextureAlphaMod(command.texture, 255);
+                break;
+            }
+            case DrawList::CommandType::QUAD:
+                setDrawState(command.color, command.blend);
+                SDL_RenderFillRect(renderer, &r);
+                break;
+            case DrawList::CommandType::QUAD_OUTLINE:
+                setDrawState(command.color, command.blend);
+                SDL_RenderDrawRect(renderer, &r);
+                break;
+            case DrawList::CommandType::LINE:
+                setDrawState(command.color, command.blend);
+                SDL_RenderDrawLine(renderer, r.x, r.y, r.w, r.h);
+                break;
+            case DrawList::CommandType::TEXT:
+                drawText(overlay, command);
+                break;
+            case DrawList::CommandType::CLIP:
+                clipped = r.w > 0;
+                SDL_RenderSetClipRect(renderer, clipped ? &r : nullptr);
+                break;
+        }
+    }
+
+    if (clipped) SDL_RenderSetClipRect(renderer, nullptr);
+    if (drawStateKnown && drawBlend != SDL_BLENDMODE_NONE) {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    }
+}
+
+void SdlRenderBackend::present() {
+    SDL_RenderPresent(renderer);
+    frame++;
+    if (frame % EVICT_INTERVAL_FRAMES == 0) {
+        evictStaleText();
+    }
+}
+
+void SdlRenderBackend::drawText(const DrawList& overlay, const DrawList::Command& command) {
+    if (!font) return;
+
+    // Key on colour as well as content; the same string is drawn in several colours.
+    // Only a cache miss copies the key into the map
+    const SDL_Color& color = command.color;
+    char colorKey[10];
+    std::snprintf(colorKey, sizeof(colorKey), "%02x%02x%02x%02x|", color.r, color.g, color.b, color.a);
+    keyScratch.assign(colorKey);
+    keyScratch.append(overlay.textOf(command), command.textLength);
+
+    auto it = textCache.find(keyScratch);
+    if (it == textCache.end()) {
+        CachedText entry = {nullptr, 0, 0, 0};
+        entry.texture = createTextTexture(overlay.textOf(command), color, entry.width, entry.height);
+        it = textCache.emplace(keyScratch, entry).first;
+    }
+    it->second.lastUsedFrame = frame;
+
+    if (it->second.texture) {
+        SDL_Rect dst = {command.rect.x, command.rect.y, it->second.width, it->second.height};
+        SDL_RenderCopy(renderer, it->second.texture, nullptr, &dst);
+    }
+}
+
+SDL_Texture* SdlRenderBackend::createTextTexture(const char* text, SDL_Color color, int& width, int& height) {
+    width = 0;
+    height = 0;
+
+    // Create surface from text
+    SDL_Surface* textSurface = TTF_RenderText_Blended(font, text, color);
+    if (!textSurface) {
+        LOG_ERROR(RENDER, "Unable to render text surface! SDL_ttf Error: %s", TTF_GetError());
+        return nullptr;
+    }
+
+    // Create texture from surface
+    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
+    if (!textTexture) {
+        LOG_ERROR(RENDER, "Unable to create texture from text! SDL Error: %s", SDL_GetError());
+    } else {
+        width = textSurface->w;
+        height = textSurface->h;
+    }
+
+    SDL_FreeSurface(textSurface);
+    return textTexture;
+}
+
+void SdlRenderBackend::evictStaleText() {
+    for (auto it = textCache.begin(); it != textCache.end(); ) {
+        if (frame - it->second.lastUsedFrame > TEXT_CACHE_FRAMES) {
+            if (it->second.texture) SDL_DestroyTexture(it->second.texture);
+            it = textCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void SdlRenderBackend::setDrawState(SDL_Color color, SDL_BlendMode blend) {
+    if (!drawStateKnown || blend != drawBlend) {
+        SDL_SetRenderDrawBlendMode(renderer, blend);
+        drawBlend = blend;
+    }
+    if (!drawStateKnown || color.r != drawColor.r || color.g != drawColor.g ||
+        color.b != drawColor.b || color.a != drawColor.a) {
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        drawColor = color;
+    }
+    drawStateKnown = true;
+}
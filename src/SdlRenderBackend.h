@@ -0,0 +1,54 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <map>
+#include <string>
+#include "RenderBackend.h"
+#include "RenderScaler.h"
+
+// SDL_Renderer backend. The world goes through RenderScaler's offscreen target
+// with RenderQueue's sorted, state-filtered submission; the overlay is drawn at
+// native resolution with redundant draw state skipped.
+//
+// Text is rasterized with SDL_ttf once per (string, colour) and kept while it's
+// being drawn; entries unused for TEXT_CACHE_FRAMES frames are released, so
+// changing numbers don't pile up.
+class SdlRenderBackend : public RenderBackend {
+public:
+    // font may be null: text commands are then skipped
+    SdlRenderBackend(SDL_Renderer* renderer, RenderScaler& scaler, TTF_Font* font);
+    ~SdlRenderBackend() override;
+
+    const char* getName() const override { return "sdl"; }
+    void drawWorld(RenderQueue& world, SDL_Color clearColor) override;
+    void drawOverlay(const DrawList& overlay) override;
+    void present() override;
+
+private:
+    struct CachedText {
+        SDL_Texture* texture;
+        int width;
+        int height;
+        uint64_t lastUsedFrame;
+    };
+
+    void drawText(const DrawList& overlay, const DrawList::Command& command);
+    SDL_Texture* createTextTexture(const char* text, SDL_Color color, int& width, int& height);
+    void evictStaleText();
+    void setDrawState(SDL_Color color, SDL_BlendMode blend);
+
+    SDL_Renderer* renderer;
+    RenderScaler& scaler;
+    TTF_Font* font;
+
+    std::map<std::string, CachedText, std::less<>> textCache; // Transparent: lookups don't build a std::string
+    std::string keyScratch;
+    uint64_t frame = 0;
+
+    SDL_Color drawColor = {0, 0, 0, 0};
+    SDL_BlendMode drawBlend = SDL_BLENDMODE_NONE;
+    bool drawStateKnown = false;
+
+    static const int TEXT_CACHE_FRAMES = 120;
+    static const int EVICT_INTERVAL_FRAMES = 60;
+};
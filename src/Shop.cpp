@@ -1,70 +1,37 @@
 #include "Shop.h"
+#include "Random.h"
 #include "Player.h"
 #include "Game.h"
+#include "Log.h"
+#include "Snapshot.h"
+#include "Balance.h"
+#include "Definitions.h"
+#include "RenderScaler.h"
 #include <random>
 #include <algorithm>
-#include <iostream>
 #include <cmath>
 #include <string>
 #include <cstring>
-#include <sstream>
+#include <cstdio>
 #include <SDL2/SDL_image.h>
 
-std::string ShopItem::getWeaponName(WeaponType wType, WeaponTier wTier) {
-    std::string baseName;
-    switch (wType) {
-        case WeaponType::PISTOL: baseName = "Pistol"; break;
-        case WeaponType::SMG: baseName = "SMG"; break;
-        case WeaponType::MELEE_STICK: baseName = "Brick on Stick"; break;
-    }
-    
-    std::string tierName;
-    switch (wTier) {
-        case WeaponTier::TIER_1: tierName = ""; break;
-        case WeaponTier::TIER_2: tierName = "Tier 2 "; break;
-        case WeaponTier::TIER_3: tierName = "Tier 3 "; break;
-        case WeaponTier::TIER_4: tierName = "Tier 4 "; break;
-    }
-    
-    return tierName + baseName;
+const char* ShopItem::getWeaponName(WeaponType wType, WeaponTier wTier) {
+    return Defs::text(Defs::weaponTier(wType, wTier).name);
 }
 
-std::string ShopItem::getWeaponDescription(WeaponType wType, WeaponTier wTier) {
-    switch (wType) {
-        case WeaponType::PISTOL:
-            return "Pierces 1 enemy, -50% damage to 2nd";
-        case WeaponType::SMG:
-            return "Fast fire rate, inaccurate shots";
-        case WeaponType::MELEE_STICK:
-            return "Melee weapon with short range";
-    }
-    return "";
+const char* ShopItem::getWeaponDescription(WeaponType wType, WeaponTier wTier) {
+    return Defs::text(Defs::weapon(wType).description);
 }
 
-std::string ShopItem::getItemName(ItemType iType) {
-    switch (iType) {
-        case ItemType::HEALING_BOX:
-            return "HEALING BOX";
-        case ItemType::MASS_BOMB:
-            return "MASS BOMB";
-    }
-    return "";
+const char* ShopItem::getItemName(ItemType iType) {
+    return Defs::text(Defs::item(iType).name);
 }
 
-std::string ShopItem::getItemDescription(ItemType iType, int power) {
-    std::stringstream ss;
-    switch (iType) {
-        case ItemType::HEALING_BOX:
-            ss << "Restores " << power << " health";
-            break;
-        case ItemType::MASS_BOMB:
-            ss << "Deals " << power << " damage\nRadius: " << (power * 5);
-            break;
-    }
-    return ss.str();
+void ShopItem::formatItemDescription(ItemType iType, int power) {
+    Defs::describeItem(iType, power, description, sizeof(description));
 }
 
-Shop::Shop() : active(false), rerollCount(0), currentWave(0), selectedItem(0), hoveredItem(-1), lastMousePressed(false), selectedOwnedWeapon(-1), hoveredOwnedWeapon(-1), selectedOwnedItem(-1), hoveredOwnedItem(-1) {
+Shop::Shop(Arena& waveMemory, Arena& frameMemory) : active(false), items(&waveMemory), rerollCount(0), currentWave(0), selectedItem(0), hoveredItem(-1), lastMousePressed(false), selectedOwnedWeapon(-1), hoveredOwnedWeapon(-1), selectedOwnedItem(-1), hoveredOwnedItem(-1), frameArena(frameMemory) {
     for (int i = 0; i < 4; i++) {
         keyPressed[i] = false;
     }
@@ -74,74 +41,56 @@ Shop::~Shop() {
     unloadAssets();
 }
 
-void Shop::loadAssets(SDL_Renderer* renderer) {
-    // Load UI textures. These are optional; if missing we fall back to rects.
-    texCardNormal = loadTexture("assets/ui/card_normal.png", renderer);
-    texCardSelected = loadTexture("assets/ui/card_selected.png", renderer);
-    texCardLocked = loadTexture("assets/ui/card_locked.png", renderer);
-    texCoin = loadTexture("assets/ui/coin.png", renderer);
-    texLock = loadTexture("assets/ui/lock.png", renderer);
-    texLockLocked = loadTexture("assets/ui/lock_locked.png", renderer);
-    texReroll = loadTexture("assets/ui/reroll.png", renderer);
-    texWeaponPistol = loadTexture("assets/weapons/pistol.png", renderer);
-    texWeaponSMG = loadTexture("assets/weapons/smg.png", renderer);
-    texHealingBox = loadTexture("assets/items/healing_box.png", renderer);
-    texMassBomb = loadTexture("assets/items/mass_bomb.png", renderer);
+void Shop::loadAssets(AssetLoader& assets) {
+    // Request the icons the shop actually draws. These are optional; while loading or if missing we fall back to rects.
+    for (int type = 0; type < Defs::weaponCount(); type++) {
+        weaponIcons[type] = assets.requestTexture(Weapon::texturePath(static_cast<WeaponType>(type), WeaponTier::TIER_1));
+    }
+    for (int type = 0; type < ITEM_TYPE_COUNT; type++) {
+        itemIcons[type] = assets.requestTexture(Defs::text(Defs::item(static_cast<ItemType>(type)).icon));
+    }
 }
 
 void Shop::unloadAssets() {
-    auto destroyIf = [](SDL_Texture*& t) {
-        if (t) { SDL_DestroyTexture(t); t = nullptr; }
-    };
-    destroyIf(texCardNormal);
-    destroyIf(texCardSelected);
-    destroyIf(texCardLocked);
-    destroyIf(texCoin);
-    destroyIf(texLock);
-    destroyIf(texLockLocked);
-    destroyIf(texReroll);
-    destroyIf(texWeaponPistol);
-    destroyIf(texWeaponSMG);
-    destroyIf(texHealingBox);
-    destroyIf(texMassBomb);
+    // Textures are owned by the asset loader; just drop our references
+    for (TextureHandle& icon : weaponIcons) icon = TextureHandle();
+    for (TextureHandle& icon : itemIcons) icon = TextureHandle();
 }
 
 void Shop::generateItems(int waveNumber, int playerLuck) {
     items.clear();
     
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    Pcg32& gen = Random::stream(RandomStream::SHOP);
     
     // Generate 4 random items
     for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
         // 70% chance for weapon, 30% for item
         std::uniform_real_distribution<float> typeDist(0.0f, 1.0f);
-        if (typeDist(gen) < 0.7f) {
-            // Generate weapon
-            std::uniform_int_distribution<int> weaponDist(0, 1);
-            WeaponType weaponType = (weaponDist(gen) == 0) ? WeaponType::PISTOL : WeaponType::SMG;
+        if (typeDist(gen) < Balance::SHOP_WEAPON_CHANCE) {
+            // Generate weapon: any weapon flagged shop = yes in weapons.def
+            WeaponType shopWeapons[DEFS_MAX_WEAPONS];
+            int shopWeaponCount = 0;
+            for (int type = 0; type < Defs::weaponCount(); type++) {
+                if (Defs::weapon(static_cast<WeaponType>(type)).flags & DEFS_WEAPON_SHOP) {
+                    shopWeapons[shopWeaponCount++] = static_cast<WeaponType>(type);
+                }
+            }
+            std::uniform_int_distribution<int> weaponDist(0, shopWeaponCount - 1);
+            WeaponType weaponType = shopWeapons[weaponDist(gen)];
             
             // Choose tier based on wave number (Brotato tier restrictions)
-            std::vector<WeaponTier> availableTiers;
-            availableTiers.push_back(WeaponTier::TIER_1);
-            
-            if (waveNumber >= 2) availableTiers.push_back(WeaponTier::TIER_2);
-            if (waveNumber >= 4) availableTiers.push_back(WeaponTier::TIER_3);
-            if (waveNumber >= 8) availableTiers.push_back(WeaponTier::TIER_4);
-            
-            std::uniform_int_distribution<int> tierDist(0, availableTiers.size() - 1);
-            WeaponTier tier = availableTiers[tierDist(gen)];
+            std::uniform_int_distribution<int> tierDist(1, Balance::shopTierCount(waveNumber));
+            WeaponTier tier = static_cast<WeaponTier>(tierDist(gen));
             
             int price = calculateItemPrice(weaponType, tier, waveNumber);
             items.emplace_back(weaponType, tier, price);
         } else {
             // Generate item
-            std::uniform_int_distribution<int> itemDist(0, 1);
-            ItemType itemType = (itemDist(gen) == 0) ? ItemType::HEALING_BOX : ItemType::MASS_BOMB;
+            std::uniform_int_distribution<int> itemDist(0, ITEM_TYPE_COUNT - 1);
+            ItemType itemType = static_cast<ItemType>(itemDist(gen));
             
             // Scale item power with wave
-            int basePower = 20;
-            int power = basePower + (waveNumber * 5);
+            int power = Balance::shopItemPower(waveNumber);
             
             int price = calculateItemPrice(itemType, power, waveNumber);
             items.emplace_back(itemType, power, price);
@@ -154,18 +103,80 @@ void Shop::openShop(int waveNumber) {
     currentWave = waveNumber;
     rerollCount = 0;
     selectedItem = 0;
+    layoutValid = false;
+    items.reserve(MAX_SHOP_ITEMS);
     generateItems(waveNumber);
     
-    std::cout << "Shop opened after wave " << waveNumber << std::endl;
+    LOG_INFO(SHOP, "Shop opened after wave %d", waveNumber);
 }
 
 void Shop::closeShop() {
     active = false;
+    // Hand the storage back so the wave arena can be reset under us
+    std::pmr::vector<ShopItem>(items.get_allocator()).swap(items);
+}
+
+void Shop::save(SnapshotWriter& out) const {
+    out.write(active);
+    out.write(currentWave);
+    out.write(rerollCount);
+    out.writeCount(items.size());
+    for (const ShopItem& item : items) {
+        out.write(item.type);
+        out.write(item.weaponType);
+        out.write(item.tier);
+        out.write(item.itemType);
+        out.write(item.itemPower);
+        out.write(item.price);
+        out.write(item.locked);
+    }
+}
+
+bool Shop::load(SnapshotReader& in) {
+    // Keep the storage: the wave arena never takes memory back before its reset,
+    // so releasing it here would cost a fresh block on every rewind step
     items.clear();
+    active = in.read<bool>();
+    in.read(currentWave);
+    in.read(rerollCount);
+    
+    // Names and descriptions come back from the constructors
+    uint32_t count = in.readCount(MAX_SHOP_ITEMS);
+    // Storage comes from the wave arena, so only take it when there's stock
+    // and none is held from an earlier restore
+    if (count > 0) items.reserve(MAX_SHOP_ITEMS);
+    for (uint32_t i = 0; i < count; i++) {
+        ShopItemType type = in.read<ShopItemType>();
+        WeaponType weaponType = in.read<WeaponType>();
+        WeaponTier tier = in.read<WeaponTier>();
+        ItemType itemType = in.read<ItemType>();
+        int itemPower = in.read<int>();
+        int price = in.read<int>();
+        bool locked = in.read<bool>();
+        // Ids index the definitions table, so reject anything out of range
+        if (static_cast<int>(weaponType) < 0 || static_cast<int>(weaponType) >= Defs::weaponCount() ||
+            static_cast<int>(tier) < 1 || static_cast<int>(tier) > WEAPON_TIER_COUNT ||
+            static_cast<int>(itemType) < 0 || static_cast<int>(itemType) >= ITEM_TYPE_COUNT) {
+            in.fail();
+            break;
+        }
+        if (type == ShopItemType::WEAPON) {
+            items.emplace_back(weaponType, tier, price);
+        } else {
+            items.emplace_back(itemType, itemPower, price);
+        }
+        items.back().locked = locked;
+    }
+    
+    selectedItem = 0;
+    layoutValid = false;
+    return in.ok();
 }
 
-void Shop::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
-    if (!active) return;
+void Shop::updateLayout(int windowWidth, int windowHeight) {
+    if (layoutValid && layout.windowWidth == windowWidth && layout.windowHeight == windowHeight) {
+        return;
+    }
     
     // Proper shop layout - centered with room for stats panel on right
     int statsWidth = 350; // Fixed width for stats panel
@@ -179,116 +190,118 @@ void Shop::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
     int shopX = margin; // Start with proper margin
     int shopY = (windowHeight - shopHeight) / 2; // Center vertically
     
+    layout.windowWidth = windowWidth;
+    layout.windowHeight = windowHeight;
+    layout.panel = {shopX, shopY, shopWidth, shopHeight};
+    layout.statsPanel = {shopX + shopWidth + spacing, shopY, statsWidth, shopHeight};
+    
+    // Items in a horizontal row - properly sized to fit 4 items
+    int itemSpacing = 20;
+    int itemWidth = (shopWidth - 40 - (3 * itemSpacing)) / 4; // Fit 4 items with spacing
+    int itemHeight = 300;
+    int gridStartX = shopX + 20; // Start with proper margin inside shop
+    int gridStartY = shopY + 120;
+    for (int i = 0; i < ShopLayout::MAX_CARDS; i++) {
+        SDL_Rect card = {gridStartX + i * (itemWidth + itemSpacing), gridStartY, itemWidth, itemHeight};
+        layout.cards[i] = card;
+        layout.buyButtons[i] = {card.x + 10, card.y + card.h - 50, card.w - 20, 30};
+    }
+    
+    // Owned items (bottom-left) and owned weapons (bottom-right) share a row
+    int slotSize = 56;
+    int slotSpacing = 14;
+    layout.itemsPanelY = shopY + shopHeight - 160;
+    layout.weaponsPanelX = shopX + shopWidth - 320; // inside shop
+    for (int i = 0; i < ShopLayout::MAX_SLOTS; i++) {
+        layout.itemSlots[i] = {shopX + 20 + i * (slotSize + slotSpacing), layout.itemsPanelY, slotSize, slotSize};
+        layout.weaponSlots[i] = {layout.weaponsPanelX + i * (slotSize + slotSpacing), layout.itemsPanelY, slotSize, slotSize};
+    }
+    
+    // Bottom section with reroll and close buttons
+    int bottomY = shopY + shopHeight - 100;
+    layout.rerollButton = {shopX + 50, bottomY, 150, 50};
+    layout.closeButton = {shopX + shopWidth - 200, bottomY, 150, 50};
+    layoutValid = true;
+}
+
+bool Shop::pointInRect(int x, int y, const SDL_Rect& rect) {
+    return x >= rect.x && x <= rect.x + rect.w && y >= rect.y && y <= rect.y + rect.h;
+}
+
+void Shop::render(DrawList& list, int windowWidth, int windowHeight) {
+    if (!active) return;
+    
+    updateLayout(windowWidth, windowHeight);
+    
+    const SDL_Rect& shopBg = layout.panel;
+    int shopX = shopBg.x;
+    int shopY = shopBg.y;
+    int shopWidth = shopBg.w;
+    
     // Draw shop background panel
-    SDL_SetRenderDrawColor(renderer, 20, 22, 30, 240);
-    SDL_Rect shopBg = {shopX, shopY, shopWidth, shopHeight};
-    SDL_RenderFillRect(renderer, &shopBg);
-    SDL_SetRenderDrawColor(renderer, 100, 120, 150, 255);
-    SDL_RenderDrawRect(renderer, &shopBg);
+    list.quad(shopBg, {20, 22, 30, 240});
+    list.quadOutline(shopBg, {100, 120, 150, 255});
     
     // Title section - use TTF font
     SDL_Color white = {255, 255, 255, 255};
-    renderTTFText(renderer, "WEAPON SHOP", shopX + 20, shopY + 20, white, 24);
+    list.text("WEAPON SHOP", shopX + 20, shopY + 20, white);
     
     // Current materials display
-    renderTTFText(renderer, "MATERIALS:", shopX + shopWidth - 200, shopY + 20, white, 16);
+    list.text("MATERIALS:", shopX + shopWidth - 200, shopY + 20, white);
     if (gameRef) {
-        std::string materialsText = std::to_string(gameRef->getPlayerMaterials());
-        renderTTFText(renderer, materialsText.c_str(), shopX + shopWidth - 70, shopY + 20, white, 20);
+        list.text(frameArena.format("%d", gameRef->getPlayerMaterials()), shopX + shopWidth - 70, shopY + 20, white);
     }
     
     // Instructions
-    renderTTFText(renderer, "CLICK TO BUY ITEMS  |  R=REROLL  |  ESC=CLOSE", shopX + 20, shopY + 55, white, 16);
+    list.text("CLICK TO BUY ITEMS  |  R=REROLL  |  ESC=CLOSE", shopX + 20, shopY + 55, white);
     
-    // Items in a horizontal row - properly sized to fit 4 items
-    int itemSpacing = 20;
-    int itemWidth = (shopWidth - 40 - (3 * itemSpacing)) / 4; // Fit 4 items with spacing
-    int itemHeight = 300;
-    int gridStartX = shopX + 20; // Start with proper margin inside shop
-    int gridStartY = shopY + 120;
-    
-    for (int i = 0; i < items.size() && i < 4; i++) {
-        // Horizontal layout - all items in one row
-        int x = gridStartX + i * (itemWidth + itemSpacing);
-        int y = gridStartY;
-        
+    for (int i = 0; i < (int)items.size() && i < ShopLayout::MAX_CARDS; i++) {
         bool hovered = (i == hoveredItem);
         bool selected = (i == selectedItem);
-        renderShopItem(renderer, items[i], x, y, itemWidth, itemHeight, selected || hovered, i);
+        renderShopItem(list, items[i], i, selected || hovered);
     }
 
     // Bottom-left Items inventory section (show owned items and allow selling)
-    int itemsPanelY = shopY + shopHeight - 160;
-    renderTTFText(renderer, "Items (click to sell for 50%)", shopX + 20, itemsPanelY - 28, white, 18);
+    list.text("Items (click to sell for 50%)", shopX + 20, layout.itemsPanelY - 28, white);
 
-    int slotSize = 56;
-    int slotSpacing = 14;
-    int slotsToShow = 6;
-    for (int i = 0; i < slotsToShow; i++) {
-        int sx = shopX + 20 + i * (slotSize + slotSpacing);
-        int sy = itemsPanelY;
-        SDL_Rect slotRect = {sx, sy, slotSize, slotSize};
-        SDL_SetRenderDrawColor(renderer, 45, 50, 60, 255);
-        SDL_RenderFillRect(renderer, &slotRect);
-        SDL_SetRenderDrawColor(renderer, 120, 130, 150, 255);
-        SDL_RenderDrawRect(renderer, &slotRect);
+    for (int i = 0; i < ShopLayout::MAX_SLOTS; i++) {
+        const SDL_Rect& slotRect = layout.itemSlots[i];
+        list.quad(slotRect, {45, 50, 60, 255});
+        list.quadOutline(slotRect, {120, 130, 150, 255});
         
         if (gameRef && gameRef->getPlayer()) {
             const Player* p = gameRef->getPlayer();
             if (i < p->getItemCount()) {
                 const Item* item = p->getItem(i);
-                SDL_Texture* icon = nullptr;
-                if (item) {
-                    switch (item->getType()) {
-                        case ItemType::HEALING_BOX: icon = texHealingBox; break;
-                        case ItemType::MASS_BOMB: icon = texMassBomb; break;
-                    }
-                }
+                SDL_Texture* icon = item ? itemIcons[static_cast<int>(item->getType())].get() : nullptr;
                 if (icon) {
-                    SDL_Rect ir = {sx + 8, sy + 8, slotSize - 16, slotSize - 16};
-                    SDL_RenderCopy(renderer, icon, nullptr, &ir);
+                    list.sprite(icon, {slotRect.x + 8, slotRect.y + 8, slotRect.w - 16, slotRect.h - 16});
                 }
                 if (selectedOwnedItem == i || hoveredOwnedItem == i) {
-                    SDL_SetRenderDrawColor(renderer, 200, 220, 255, 255);
-                    SDL_RenderDrawRect(renderer, &slotRect);
+                    list.quadOutline(slotRect, {200, 220, 255, 255});
                 }
             }
         }
     }
 
     // Bottom-right: Owned weapons grid (player weapon array)
-    int weaponsPanelX = shopX + shopWidth - 320; // inside shop
-    int weaponsPanelY = itemsPanelY;
-    renderTTFText(renderer, "Weapons (click to sell for 50%)", weaponsPanelX, weaponsPanelY - 28, white, 18);
-    int wSlotSize = 56;
-    int wSlotSpacing = 14;
+    list.text("Weapons (click to sell for 50%)", layout.weaponsPanelX, layout.itemsPanelY - 28, white);
     if (gameRef) {
         const Player* p = gameRef->getPlayer();
         if (p) {
             const auto& owned = p->getWeapons();
-            for (int i = 0; i < 6; i++) {
-                int cx = weaponsPanelX + i * (wSlotSize + wSlotSpacing);
-                int cy = weaponsPanelY;
-                SDL_Rect slot = {cx, cy, wSlotSize, wSlotSize};
-                SDL_SetRenderDrawColor(renderer, 45, 50, 60, 255);
-                SDL_RenderFillRect(renderer, &slot);
-                SDL_SetRenderDrawColor(renderer, 120, 130, 150, 255);
-                SDL_RenderDrawRect(renderer, &slot);
+            for (int i = 0; i < ShopLayout::MAX_SLOTS; i++) {
+                const SDL_Rect& slot = layout.weaponSlots[i];
+                list.quad(slot, {45, 50, 60, 255});
+                list.quadOutline(slot, {120, 130, 150, 255});
                 if (i < (int)owned.size()) {
-                    SDL_Texture* icon = nullptr;
-                    switch (owned[i]->getType()) {
-                        case WeaponType::PISTOL: icon = texWeaponPistol; break;
-                        case WeaponType::SMG: icon = texWeaponSMG; break;
-                        case WeaponType::MELEE_STICK: icon = nullptr; break; // No texture yet
-                    }
+                    SDL_Texture* icon = weaponIcons[static_cast<int>(owned[i]->getType())].get();
                     if (icon) {
-                        SDL_Rect ir = {cx + 8, cy + 8, wSlotSize - 16, wSlotSize - 16};
-                        SDL_RenderCopy(renderer, icon, nullptr, &ir);
+                        list.sprite(icon, {slot.x + 8, slot.y + 8, slot.w - 16, slot.h - 16});
                     }
                     // Highlight if selected/hovered
                     if (selectedOwnedWeapon == i || hoveredOwnedWeapon == i) {
-                        SDL_SetRenderDrawColor(renderer, 200, 220, 255, 255);
-                        SDL_RenderDrawRect(renderer, &slot);
+                        list.quadOutline(slot, {200, 220, 255, 255});
                     }
                 }
             }
@@ -298,138 +311,138 @@ void Shop::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
                 WeaponType t = owned[hoveredOwnedWeapon]->getType();
                 WeaponTier tr = owned[hoveredOwnedWeapon]->getTier();
                 int price = calculateItemPrice(t, tr, currentWave);
-                int sellValue = std::max(1, price / 2);
+                int sellValue = Balance::sellPrice(price);
                 SDL_Color yellow = {255, 220, 120, 255};
-                std::string tip = "Sell for: " + std::to_string(sellValue);
-                renderTTFText(renderer, tip.c_str(), weaponsPanelX, weaponsPanelY + wSlotSize + 14, yellow, 14);
+                list.text(frameArena.format("Sell for: %d", sellValue),
+                          layout.weaponsPanelX, layout.itemsPanelY + layout.weaponSlots[0].h + 14, yellow);
             }
         }
     }
     
-    // Bottom section with reroll and close buttons - move them out of the way
-    int bottomY = shopY + shopHeight - 100;
-    
-    // Reroll button - move to bottom left
-    SDL_Rect rerollButton = {shopX + 50, bottomY, 150, 50};
+    // Reroll button - bottom left
+    const SDL_Rect& rerollButton = layout.rerollButton;
     int rerollPrice = calculateRerollPrice(currentWave, rerollCount);
     bool canAffordReroll = gameRef && gameRef->getPlayerMaterials() >= rerollPrice;
     
-    SDL_SetRenderDrawColor(renderer, canAffordReroll ? 60 : 40, canAffordReroll ? 80 : 50, canAffordReroll ? 100 : 60, 255);
-    SDL_RenderFillRect(renderer, &rerollButton);
-    SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-    SDL_RenderDrawRect(renderer, &rerollButton);
+    if (canAffordReroll) {
+        list.quad(rerollButton, {60, 80, 100, 255});
+    } else {
+        list.quad(rerollButton, {40, 50, 60, 255});
+    }
+    list.quadOutline(rerollButton, {150, 150, 150, 255});
     
-    // Use TTF text for reroll button
-    renderTTFText(renderer, "REROLL", rerollButton.x + 10, rerollButton.y + 8, white, 14);
-    std::string rerollPriceText = std::to_string(rerollPrice);
-    renderTTFText(renderer, rerollPriceText.c_str(), rerollButton.x + 10, rerollButton.y + 25, white, 14);
+    list.text("REROLL", rerollButton.x + 10, rerollButton.y + 8, white);
+    list.text(frameArena.format("%d", rerollPrice), rerollButton.x + 10, rerollButton.y + 25, white);
     
-    // Close button - move to bottom right
-    SDL_Rect closeButton = {shopX + shopWidth - 200, bottomY, 150, 50};
-    SDL_SetRenderDrawColor(renderer, 80, 60, 60, 255);
-    SDL_RenderFillRect(renderer, &closeButton);
-    SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-    SDL_RenderDrawRect(renderer, &closeButton);
+    // Close button - bottom right
+    const SDL_Rect& closeButton = layout.closeButton;
+    list.quad(closeButton, {80, 60, 60, 255});
+    list.quadOutline(closeButton, {150, 150, 150, 255});
     
-    // Use TTF text for close button
-    renderTTFText(renderer, "CLOSE", closeButton.x + 20, closeButton.y + 12, white, 14);
+    list.text("CLOSE", closeButton.x + 20, closeButton.y + 12, white);
     
     // Character stats panel on the right side - properly positioned and sized
-    int statsX = shopX + shopWidth + spacing;
-    renderCharacterStats(renderer, statsX, shopY, statsWidth, shopHeight);
+    const SDL_Rect& stats = layout.statsPanel;
+    renderCharacterStats(list, stats.x, stats.y, stats.w, stats.h);
 }
 
-void Shop::renderShopItem(SDL_Renderer* renderer, const ShopItem& item, int x, int y, int width, int height, bool highlighted, int index) {
-    SDL_Rect itemRect = {x, y, width, height};
+void Shop::renderShopItem(DrawList& list, const ShopItem& item, int index, bool highlighted) {
+    const SDL_Rect& itemRect = layout.cards[index];
     
     // Check if player can afford this item
     bool canAfford = gameRef && gameRef->getPlayerMaterials() >= item.price;
 
     // Card background with better colors
+    SDL_Color background;
     if (item.locked) {
-        SDL_SetRenderDrawColor(renderer, 120, 100, 50, 255);
+        background = {120, 100, 50, 255};
     } else if (highlighted) {
-        SDL_SetRenderDrawColor(renderer, canAfford ? 80 : 60, canAfford ? 120 : 80, canAfford ? 160 : 100, 255);
+        background = canAfford ? SDL_Color{80, 120, 160, 255} : SDL_Color{60, 80, 100, 255};
     } else {
-        SDL_SetRenderDrawColor(renderer, canAfford ? 60 : 40, canAfford ? 70 : 50, canAfford ? 90 : 60, 255);
+        background = canAfford ? SDL_Color{60, 70, 90, 255} : SDL_Color{40, 50, 60, 255};
     }
-    SDL_RenderFillRect(renderer, &itemRect);
+    list.quad(itemRect, background);
     
     // Border
     if (highlighted) {
-        SDL_SetRenderDrawColor(renderer, 200, 200, 255, 255);
+        list.quadOutline(itemRect, {200, 200, 255, 255});
     } else {
-        SDL_SetRenderDrawColor(renderer, 120, 120, 140, 255);
+        list.quadOutline(itemRect, {120, 120, 140, 255});
     }
-    SDL_RenderDrawRect(renderer, &itemRect);
-    
-    // Item icon - larger and centered
-    SDL_Texture* icon = nullptr;
-    if (item.type == ShopItemType::WEAPON) {
-        switch (item.weaponType) {
-            case WeaponType::PISTOL: icon = texWeaponPistol; break;
-            case WeaponType::SMG: icon = texWeaponSMG; break;
-            case WeaponType::MELEE_STICK: icon = nullptr; break; // No texture yet
-        }
-    } else if (item.type == ShopItemType::ITEM) {
-        switch (item.itemType) {
-            case ItemType::HEALING_BOX: icon = texHealingBox; break;
-            case ItemType::MASS_BOMB: icon = texMassBomb; break;
-        }
-    }
-    if (icon) {
-        SDL_Rect ir = {x + width/2 - 24, y + 10, 48, 48};
-        SDL_RenderCopy(renderer, icon, nullptr, &ir);
-    }
-
-    // Item name - use TTF text
-    SDL_Color itemWhite = {255, 255, 255, 255};
-    renderTTFText(renderer, item.name.c_str(), x + 10, y + 65, itemWhite, 14);
-    
-    // Price with BUY button
-    int buttonY = y + height - 50;
-    SDL_Rect buyButton = {x + 10, buttonY, width - 20, 30};
     
+    // Buy button background changes with affordability
+    const SDL_Rect& buyButton = layout.buyButtons[index];
     if (canAfford) {
-        SDL_SetRenderDrawColor(renderer, 50, 150, 50, 255);
+        list.quad(buyButton, {50, 150, 50, 255});
     } else {
-        SDL_SetRenderDrawColor(renderer, 100, 50, 50, 255);
+        list.quad(buyButton, {100, 50, 50, 255});
     }
-    SDL_RenderFillRect(renderer, &buyButton);
-    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-    SDL_RenderDrawRect(renderer, &buyButton);
+    list.quadOutline(buyButton, {200, 200, 200, 255});
     
-    // BUY text and price - use TTF text
+    renderCardContents(list, item, itemRect);
+    
+    // BUY/NEED label
     SDL_Color buttonWhite = {255, 255, 255, 255};
     if (canAfford) {
-        renderTTFText(renderer, "BUY", buyButton.x + 10, buyButton.y + 8, buttonWhite, 14);
+        list.text("BUY", buyButton.x + 10, buyButton.y + 8, buttonWhite);
     } else {
-        renderTTFText(renderer, "NEED", buyButton.x + 5, buyButton.y + 8, buttonWhite, 14);
+        list.text("NEED", buyButton.x + 5, buyButton.y + 8, buttonWhite);
     }
     
-    // Price
-    std::string priceText = std::to_string(item.price);
-    renderTTFText(renderer, priceText.c_str(), buyButton.x + buyButton.w - 40, buyButton.y + 8, buttonWhite, 14);
-    
     // Small lock indicator if locked
     if (item.locked) {
-        SDL_Rect lockRect = {x + width - 25, y + 5, 20, 20};
-        SDL_SetRenderDrawColor(renderer, 200, 200, 50, 255);
-        SDL_RenderFillRect(renderer, &lockRect);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        SDL_RenderDrawRect(renderer, &lockRect);
+        SDL_Rect lockRect = {itemRect.x + itemRect.w - 25, itemRect.y + 5, 20, 20};
+        list.quad(lockRect, {200, 200, 50, 255});
+        list.quadOutline(lockRect, {255, 255, 255, 255});
     }
 }
 
-void Shop::renderCharacterStats(SDL_Renderer* renderer, int x, int y, int width, int height) {
+void Shop::renderCardContents(DrawList& list, const ShopItem& item, const SDL_Rect& card) {
+    int x = card.x;
+    int y = card.y;
+    int width = card.w;
+    int height = card.h;
+    // Long names and descriptions stay inside the card
+    list.clip(card);
+    
+    // Item icon - larger and centered
+    list.sprite(getItemIcon(item).get(), {x + width/2 - 24, y + 10, 48, 48});
+
+    // Item name and description (one line per '\n')
+    SDL_Color itemWhite = {255, 255, 255, 255};
+    SDL_Color descriptionGray = {190, 195, 210, 255};
+    list.text(item.name, x + 10, y + 65, itemWhite, 14);
+    
+    int lineY = y + 95;
+    for (const char* line = item.description; *line; ) {
+        const char* end = std::strchr(line, '\n');
+        int length = end ? static_cast<int>(end - line) : static_cast<int>(std::strlen(line));
+        list.text(frameArena.format("%.*s", length, line), x + 10, lineY, descriptionGray, 12);
+        lineY += 20;
+        line += end ? length + 1 : length;
+    }
+    
+    // Price, right-aligned inside the buy button strip
+    list.text(frameArena.format("%d", item.price), x + width - 50, y + height - 42, itemWhite, 14);
+    list.clearClip();
+}
+
+TextureHandle Shop::getItemIcon(const ShopItem& item) const {
+    if (item.type == ShopItemType::WEAPON) {
+        return weaponIcons[static_cast<int>(item.weaponType)];
+    } else if (item.type == ShopItemType::ITEM) {
+        return itemIcons[static_cast<int>(item.itemType)];
+    }
+    return TextureHandle();
+}
+
+void Shop::renderCharacterStats(DrawList& list, int x, int y, int width, int height) {
     if (!gameRef) return;
     
     // Draw stats panel background
-    SDL_SetRenderDrawColor(renderer, 30, 35, 45, 240);
     SDL_Rect statsPanel = {x, y, width, height};
-    SDL_RenderFillRect(renderer, &statsPanel);
-    SDL_SetRenderDrawColor(renderer, 120, 140, 160, 255);
-    SDL_RenderDrawRect(renderer, &statsPanel);
+    list.quad(statsPanel, {30, 35, 45, 240});
+    list.quadOutline(statsPanel, {120, 140, 160, 255});
     
     // Stats title
     SDL_Color white = {255, 255, 255, 255};
@@ -437,7 +450,7 @@ void Shop::renderCharacterStats(SDL_Renderer* renderer, int x, int y, int width,
     SDL_Color red = {255, 100, 100, 255};
     SDL_Color blue = {100, 150, 255, 255};
     
-    renderTTFText(renderer, "STATS", x + 20, y + 20, white, 20);
+    list.text("STATS", x + 20, y + 20, white);
     
     // Get player stats
     const Player* player = gameRef->getPlayer();
@@ -448,64 +461,53 @@ void Shop::renderCharacterStats(SDL_Renderer* renderer, int x, int y, int width,
     int lineHeight = 25;
     
     // Health
-    std::string healthText = "Max HP: " + std::to_string(stats.maxHealth);
-    renderTTFText(renderer, healthText.c_str(), x + 20, currentY, red, 14);
+    list.text(frameArena.format("Max HP: %d", stats.maxHealth), x + 20, currentY, red);
     currentY += lineHeight;
     
     // Damage
-    std::string damageText = "Damage: " + std::to_string(stats.damage);
-    renderTTFText(renderer, damageText.c_str(), x + 20, currentY, red, 14);
+    list.text(frameArena.format("Damage: %d", stats.damage), x + 20, currentY, red);
     currentY += lineHeight;
     
     // Attack Speed
-    std::string attackSpeedText = "Attack Speed: " + std::to_string((int)(stats.attackSpeed * 100)) + "%";
-    renderTTFText(renderer, attackSpeedText.c_str(), x + 20, currentY, green, 14);
+    list.text(frameArena.format("Attack Speed: %d%%", (int)(stats.attackSpeed * 100)), x + 20, currentY, green);
     currentY += lineHeight;
     
     // Skip speed for now since it's not in PlayerStats
-    // std::string speedText = "Speed: " + std::to_string(stats.speed);
-    // renderTTFText(renderer, speedText.c_str(), x + 20, currentY, blue, 14);
+    // list.text(frameArena.format("Speed: %d", stats.speed), x + 20, currentY, blue);
     // currentY += lineHeight;
     
     // Armor
-    std::string armorText = "Armor: " + std::to_string(stats.armor);
-    renderTTFText(renderer, armorText.c_str(), x + 20, currentY, blue, 14);
+    list.text(frameArena.format("Armor: %d", stats.armor), x + 20, currentY, blue);
     currentY += lineHeight;
     
     // Dodge
-    std::string dodgeText = "Dodge: " + std::to_string((int)stats.dodgeChance) + "%";
-    renderTTFText(renderer, dodgeText.c_str(), x + 20, currentY, green, 14);
+    list.text(frameArena.format("Dodge: %d%%", (int)stats.dodgeChance), x + 20, currentY, green);
     currentY += lineHeight;
     
     // Materials
-    std::string materialsText = "Materials: " + std::to_string(stats.materials);
-    renderTTFText(renderer, materialsText.c_str(), x + 20, currentY, green, 14);
+    list.text(frameArena.format("Materials: %d", stats.materials), x + 20, currentY, green);
     currentY += lineHeight + 10;
     
     // Weapons section
-    std::string weaponsTitle = "WEAPONS (" + std::to_string(player->getWeaponCount()) + "/6)";
-    renderTTFText(renderer, weaponsTitle.c_str(), x + 20, currentY, white, 16);
+    list.text(frameArena.format("WEAPONS (%d/6)", player->getWeaponCount()), x + 20, currentY, white);
     currentY += 30;
     
     // List equipped weapons
     const auto& weapons = player->getWeapons();
     for (int i = 0; i < weapons.size() && i < 6; i++) {
-        std::string weaponText = "- ";
-        switch (weapons[i]->getType()) {
-            case WeaponType::PISTOL: weaponText += "Pistol"; break;
-            case WeaponType::SMG: weaponText += "SMG"; break;
-            case WeaponType::MELEE_STICK: weaponText += "Brick on Stick"; break;
-        }
+        const char* weaponName = Defs::text(Defs::weaponTier(weapons[i]->getType(), WeaponTier::TIER_1).name);
         
         // Add tier info
+        const char* tierName = "";
         switch (weapons[i]->getTier()) {
-            case WeaponTier::TIER_1: weaponText += " I"; break;
-            case WeaponTier::TIER_2: weaponText += " II"; break;
-            case WeaponTier::TIER_3: weaponText += " III"; break;
-            case WeaponTier::TIER_4: weaponText += " IV"; break;
+            case WeaponTier::TIER_1: tierName = "I"; break;
+            case WeaponTier::TIER_2: tierName = "II"; break;
+            case WeaponTier::TIER_3: tierName = "III"; break;
+            case WeaponTier::TIER_4: tierName = "IV"; break;
         }
         
-        renderTTFText(renderer, weaponText.c_str(), x + 30, currentY, white, 12);
+        const char* weaponText = frameArena.format("- %s %s", weaponName, tierName);
+        list.text(weaponText, x + 30, currentY, white);
         currentY += 20;
     }
 }
@@ -568,7 +570,7 @@ void Shop::buyItem(int index, Player& player) {
         if (item.type == ShopItemType::WEAPON) {
             // Create and add weapon to player with renderer for sprite loading
             auto weapon = std::make_unique<Weapon>(item.weaponType, item.tier);
-            player.addWeapon(std::move(weapon), gameRef->getRenderer());
+            player.addWeapon(std::move(weapon), gameRef->getAssets());
             purchased = true;
         } else if (item.type == ShopItemType::ITEM) {
             // Create and add item to player
@@ -577,9 +579,11 @@ void Shop::buyItem(int index, Player& player) {
                 case ItemType::HEALING_BOX:
                     newItem = std::make_unique<HealingBox>(item.itemPower, item.price);
                     break;
-                case ItemType::MASS_BOMB:
-                    newItem = std::make_unique<MassBomb>(item.itemPower, 3.0f, item.itemPower * 5.0f, item.price);
+                case ItemType::MASS_BOMB: {
+                    const ItemDef& def = Defs::item(ItemType::MASS_BOMB);
+                    newItem = std::make_unique<MassBomb>(item.itemPower, def.fuseSeconds, item.itemPower * def.radiusPerPower, item.price);
                     break;
+                }
             }
             if (newItem) {
                 player.addItem(std::move(newItem));
@@ -590,13 +594,13 @@ void Shop::buyItem(int index, Player& player) {
         if (purchased) {
             // Deduct materials
             player.getStats().materials -= item.price;
-            std::cout << "Bought " << item.name << " for " << item.price << " materials" << std::endl;
+            LOG_INFO(SHOP, "Bought %s for %d materials", item.name, item.price);
             
             // Remove item from shop
             items.erase(items.begin() + index);
         }
     } else {
-        std::cout << "Not enough materials! Need " << item.price << ", have " << player.getStats().materials << std::endl;
+        LOG_INFO(SHOP, "Not enough materials! Need %d, have %d", item.price, player.getStats().materials);
     }
 }
 
@@ -608,11 +612,11 @@ void Shop::sellOwnedWeapon(int ownedIndex, Player& player) {
     WeaponType type = owned[ownedIndex]->getType();
     WeaponTier tier = owned[ownedIndex]->getTier();
     int price = calculateItemPrice(type, tier, currentWave);
-    int sellValue = std::max(1, price / 2);
+    int sellValue = Balance::sellPrice(price);
 
     player.getStats().materials += sellValue;
     player.removeWeaponAt(ownedIndex);
-    std::cout << "Sold weapon for " << sellValue << " materials" << std::endl;
+    LOG_INFO(SHOP, "Sold weapon for %d materials", sellValue);
 }
 
 void Shop::sellOwnedItem(int ownedIndex, Player& player) {
@@ -621,17 +625,17 @@ void Shop::sellOwnedItem(int ownedIndex, Player& player) {
     const Item* itm = player.getItem(ownedIndex);
     if (!itm) return;
     int price = calculateItemPrice(itm->getType(), itm->getPower(), currentWave);
-    int sellValue = std::max(1, price / 2);
+    int sellValue = Balance::sellPrice(price);
     player.getStats().materials += sellValue;
     player.removeItem(ownedIndex);
-    std::cout << "Sold item for " << sellValue << " materials" << std::endl;
+    LOG_INFO(SHOP, "Sold item for %d materials", sellValue);
 }
 
 void Shop::lockItem(int index) {
     if (index >= items.size()) return;
     
     items[index].locked = !items[index].locked;
-    std::cout << "Item " << (items[index].locked ? "locked" : "unlocked") << std::endl;
+    LOG_INFO(SHOP, "Item %s", items[index].locked ? "locked" : "unlocked");
 }
 
 void Shop::reroll(Player& player, int waveNumber) {
@@ -642,7 +646,7 @@ void Shop::reroll(Player& player, int waveNumber) {
         rerollCount++;
         
         // Keep locked items, regenerate others
-        std::vector<ShopItem> lockedItems;
+        std::pmr::vector<ShopItem> lockedItems(&frameArena);
         for (const auto& item : items) {
             if (item.locked) {
                 lockedItems.push_back(item);
@@ -655,24 +659,16 @@ void Shop::reroll(Player& player, int waveNumber) {
         for (int i = 0; i < lockedItems.size() && i < items.size(); i++) {
             items[i] = lockedItems[i];
         }
+        layoutValid = false;
         
-        std::cout << "Rerolled shop for " << rerollPrice << " materials" << std::endl;
+        LOG_INFO(SHOP, "Rerolled shop for %d materials", rerollPrice);
     } else {
-        std::cout << "Not enough materials for reroll! Need " << rerollPrice << std::endl;
+        LOG_INFO(SHOP, "Not enough materials for reroll! Need %d", rerollPrice);
     }
 }
 
 int Shop::calculateItemPrice(WeaponType weaponType, WeaponTier tier, int waveNumber) {
-    int basePrice = 20; // Base weapon price
-    
-    // Tier multiplier
-    int tierMultiplier = (int)tier;
-    basePrice *= tierMultiplier;
-    
-    // Wave scaling (increases with wave)
-    basePrice += waveNumber * 5;
-    
-    return basePrice;
+    return Balance::weaponPrice(tier, waveNumber);
 }
 
 void Shop::addItemToShop(ItemType type, int power, int waveNumber) {
@@ -681,55 +677,11 @@ void Shop::addItemToShop(ItemType type, int power, int waveNumber) {
 }
 
 int Shop::calculateItemPrice(ItemType type, int power, int waveNumber) {
-    int basePrice = 15; // Base item price (slightly cheaper than weapons)
-    
-    // Power scaling
-    basePrice += power / 2;
-    
-    // Wave scaling
-    basePrice += waveNumber * 3;
-    
-    return basePrice;
+    return Balance::itemPrice(power, waveNumber);
 }
 
 int Shop::calculateRerollPrice(int waveNumber, int rerollCount) {
-    // Brotato reroll formula
-    int rerollIncrease = std::max(1, (int)std::floor(0.40f * waveNumber));
-    int firstRerollPrice = (int)std::floor(waveNumber * 0.75f) + rerollIncrease;
-    
-    return firstRerollPrice + (rerollCount * rerollIncrease);
-}
-
-void Shop::renderText(SDL_Renderer* renderer, const char* text, int x, int y, int scale) {
-    if (gameRef) {
-        gameRef->renderText(text, x, y, scale);
-    }
-}
-
-void Shop::renderNumber(SDL_Renderer* renderer, int number, int x, int y, int scale) {
-    if (gameRef) {
-        gameRef->renderNumber(number, x, y, scale);
-    }
-}
-
-void Shop::renderTTFText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color, int fontSize) {
-    if (gameRef) {
-        gameRef->renderTTFText(text, x, y, color, fontSize);
-    }
-}
-
-SDL_Texture* Shop::loadTexture(const char* path, SDL_Renderer* renderer) {
-    SDL_Surface* surface = IMG_Load(path);
-    if (!surface) {
-        std::cout << "Unable to load image " << path << "! SDL_image Error: " << IMG_GetError() << std::endl;
-        return nullptr;
-    }
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    if (!texture) {
-        std::cout << "Unable to create texture from " << path << "! SDL Error: " << SDL_GetError() << std::endl;
-    }
-    return texture;
+    return Balance::rerollPrice(waveNumber, rerollCount);
 }
 
 void Shop::handleMouseInput(int mouseX, int mouseY, bool mousePressed, Player& player) {
@@ -737,108 +689,64 @@ void Shop::handleMouseInput(int mouseX, int mouseY, bool mousePressed, Player& p
     
     hoveredItem = -1;
     
-    // Calculate shop layout (same as in render method)
-    int windowWidth = 1920;
-    int windowHeight = 1080;
-    
-    // Same layout calculation as render method
-    int statsWidth = 350; // Fixed width for stats panel
-    int margin = 50; // Margins around elements
-    int spacing = 20; // Space between shop and stats
-    
-    int availableWidth = windowWidth - (2 * margin) - statsWidth - spacing;
-    int shopWidth = availableWidth; // Use remaining space for shop
-    int shopHeight = 700;
-    
-    int shopX = margin; // Start with proper margin
-    int shopY = (windowHeight - shopHeight) / 2; // Center vertically
-    
-    // Items in horizontal row - same calculation as render
-    int itemSpacing = 20;
-    int itemWidth = (shopWidth - 40 - (3 * itemSpacing)) / 4; // Fit 4 items with spacing
-    int itemHeight = 300;
-    int gridStartX = shopX + 20; // Start with proper margin inside shop
-    int gridStartY = shopY + 120;
+    // Hit-test against the same layout render() draws; before the first render
+    // use the logical size the game renders the shop at
+    if (!layoutValid) {
+        updateLayout(layout.windowWidth > 0 ? layout.windowWidth : LOGICAL_WIDTH,
+                     layout.windowHeight > 0 ? layout.windowHeight : LOGICAL_HEIGHT);
+    }
+    bool clicked = mousePressed && !lastMousePressed;
     
     // Check item hover/click (make whole card clickable like Brotato)
-    for (int i = 0; i < items.size() && i < 4; i++) {
-        int x = gridStartX + i * (itemWidth + itemSpacing);
-        int y = gridStartY;
-        
-        SDL_Rect itemRect = {x, y, itemWidth, itemHeight};
-        
-        if (mouseX >= itemRect.x && mouseX <= itemRect.x + itemRect.w &&
-            mouseY >= itemRect.y && mouseY <= itemRect.y + itemRect.h) {
+    for (int i = 0; i < (int)items.size() && i < ShopLayout::MAX_CARDS; i++) {
+        if (pointInRect(mouseX, mouseY, layout.cards[i])) {
             hoveredItem = i;
             
             // Handle click to buy
-            if (mousePressed && !lastMousePressed) {
+            if (clicked) {
                 buyItem(i, player);
             }
+            break; // Buying shifts the remaining cards left
         }
     }
     
     // Check reroll button
-    int bottomY = shopY + shopHeight - 100;
-    SDL_Rect rerollButton = {shopX + 50, bottomY, 150, 50};
-    if (mouseX >= rerollButton.x && mouseX <= rerollButton.x + rerollButton.w &&
-        mouseY >= rerollButton.y && mouseY <= rerollButton.y + rerollButton.h) {
-        if (mousePressed && !lastMousePressed) {
-            int rerollPrice = calculateRerollPrice(currentWave, rerollCount);
-            if (gameRef && gameRef->getPlayerMaterials() >= rerollPrice) {
-                reroll(player, currentWave);
-            }
+    if (pointInRect(mouseX, mouseY, layout.rerollButton) && clicked) {
+        int rerollPrice = calculateRerollPrice(currentWave, rerollCount);
+        if (gameRef && gameRef->getPlayerMaterials() >= rerollPrice) {
+            reroll(player, currentWave);
         }
     }
     
     // Check close button
-    SDL_Rect closeButton = {shopX + shopWidth - 200, bottomY, 150, 50};
-    if (mouseX >= closeButton.x && mouseX <= closeButton.x + closeButton.w &&
-        mouseY >= closeButton.y && mouseY <= closeButton.y + closeButton.h) {
-        if (mousePressed && !lastMousePressed) {
-            closeShop();
-        }
+    if (pointInRect(mouseX, mouseY, layout.closeButton) && clicked) {
+        closeShop();
     }
 
     // Click detection for owned weapons (bottom-right panel)
-    // Use existing layout variables from above
-    int itemsPanelY2 = shopY + shopHeight - 160;
-    int weaponsPanelX2 = shopX + shopWidth - 320;
-    int wSlotSize = 56; int wSlotSpacing = 14;
     selectedOwnedWeapon = -1;
     hoveredOwnedWeapon = -1;
     const auto& owned = player.getWeapons();
-    for (int i = 0; i < 6; i++) {
-        int cx = weaponsPanelX2 + i * (wSlotSize + wSlotSpacing);
-        int cy = itemsPanelY2;
-        SDL_Rect slot = {cx, cy, wSlotSize, wSlotSize};
-        if (mouseX >= slot.x && mouseX <= slot.x + slot.w && mouseY >= slot.y && mouseY <= slot.y + slot.h) {
+    for (int i = 0; i < ShopLayout::MAX_SLOTS; i++) {
+        if (pointInRect(mouseX, mouseY, layout.weaponSlots[i])) {
             hoveredOwnedWeapon = i;
-            if (mousePressed && !lastMousePressed) {
-                if (i < (int)owned.size()) {
-                    // Click to sell at 50%
-                    sellOwnedWeapon(i, player);
-                }
+            if (clicked && i < (int)owned.size()) {
+                // Click to sell at 50%
+                sellOwnedWeapon(i, player);
             }
         }
     }
     
     // Click detection for owned items (bottom-left panel)
-    int iSlotSize = 56; int iSlotSpacing = 14;
     hoveredOwnedItem = -1; selectedOwnedItem = -1;
-    for (int i = 0; i < 6; i++) {
-        int sx = shopX + 20 + i * (iSlotSize + iSlotSpacing);
-        int sy = itemsPanelY2;
-        SDL_Rect slotRect = {sx, sy, iSlotSize, iSlotSize};
-        if (mouseX >= slotRect.x && mouseX <= slotRect.x + slotRect.w && mouseY >= slotRect.y && mouseY <= slotRect.y + slotRect.h) {
+    for (int i = 0; i < ShopLayout::MAX_SLOTS; i++) {
+        if (pointInRect(mouseX, mouseY, layout.itemSlots[i])) {
             hoveredOwnedItem = i;
-            if (mousePressed && !lastMousePressed) {
-                if (i < player.getItemCount()) {
-                    sellOwnedItem(i, player);
-                }
+            if (clicked && i < player.getItemCount()) {
+                sellOwnedItem(i, player);
             }
         }
     }
     
     lastMousePressed = mousePressed;
-}
\ No newline at end of file
+}
@@ -3,8 +3,13 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <cstdio>
+#include <memory_resource>
+#include "Arena.h"
 #include "Weapon.h"
 #include "Item.h"
+#include "AssetLoader.h"
+#include "DrawList.h"
 
 class Player;
 class Game;
@@ -22,8 +27,8 @@ struct ShopItem {
     int itemPower;
     int price;
     bool locked;
-    std::string name;
-    std::string description;
+    const char* name;          // Points into the definitions table
+    char description[48];      // Lines separated by '\n'
     
     ShopItem(WeaponType wType, WeaponTier wTier, int cost) 
         : type(ShopItemType::WEAPON), weaponType(wType), tier(wTier), 
@@ -31,7 +36,7 @@ struct ShopItem {
         
         // Generate name and description
         name = getWeaponName(wType, wTier);
-        description = getWeaponDescription(wType, wTier);
+        snprintf(description, sizeof(description), "%s", getWeaponDescription(wType, wTier));
     }
     
     ShopItem(ItemType iType, int power, int cost)
@@ -40,33 +45,61 @@ struct ShopItem {
         
         // Generate name and description
         name = getItemName(iType);
-        description = getItemDescription(iType, power);
+        formatItemDescription(iType, power);
     }
     
 private:
-    std::string getWeaponName(WeaponType wType, WeaponTier wTier);
-    std::string getWeaponDescription(WeaponType wType, WeaponTier wTier);
-    std::string getItemName(ItemType iType);
-    std::string getItemDescription(ItemType iType, int power);
+    static const char* getWeaponName(WeaponType wType, WeaponTier wTier);
+    static const char* getWeaponDescription(WeaponType wType, WeaponTier wTier);
+    static const char* getItemName(ItemType iType);
+    void formatItemDescription(ItemType iType, int power);
+};
+
+// Screen-space geometry of the shop. Computed once per open/reroll or when the
+// window size changes, and shared by render() and handleMouseInput().
+struct ShopLayout {
+    static const int MAX_CARDS = 4;
+    static const int MAX_SLOTS = 6;
+    
+    int windowWidth = 0;
+    int windowHeight = 0;
+    
+    SDL_Rect panel = {0, 0, 0, 0};          // Main shop background
+    SDL_Rect statsPanel = {0, 0, 0, 0};     // Character stats on the right
+    SDL_Rect cards[MAX_CARDS] = {};         // Item cards in a horizontal row
+    SDL_Rect buyButtons[MAX_CARDS] = {};    // BUY/NEED strip inside each card
+    SDL_Rect itemSlots[MAX_SLOTS] = {};     // Owned items (bottom-left)
+    SDL_Rect weaponSlots[MAX_SLOTS] = {};   // Owned weapons (bottom-right)
+    SDL_Rect rerollButton = {0, 0, 0, 0};
+    SDL_Rect closeButton = {0, 0, 0, 0};
+    int itemsPanelY = 0;
+    int weaponsPanelX = 0;
 };
 
 class Shop {
 public:
-    Shop();
+    // Offered items live in waveMemory until the shop closes; per-frame
+    // labels are formatted into frameMemory
+    Shop(Arena& waveMemory, Arena& frameMemory);
     ~Shop();
     
     void setGame(Game* game) { gameRef = game; }
-    void loadAssets(SDL_Renderer* renderer);
+    void loadAssets(AssetLoader& assets);
     void unloadAssets();
     
     void generateItems(int waveNumber, int playerLuck = 0);
-    void render(SDL_Renderer* renderer, int windowWidth, int windowHeight);
+    void render(DrawList& list, int windowWidth, int windowHeight);
     void addItemToShop(ItemType type, int power, int waveNumber);
     int calculateItemPrice(ItemType type, int power, int waveNumber);
     void handleInput(const Uint8* keyState, Player& player);
     void handleMouseInput(int mouseX, int mouseY, bool mousePressed, Player& player);
     
     bool isShopActive() const { return active; }
+    const std::pmr::vector<ShopItem>& getItems() const { return items; }
+    
+    // Snapshot section (Snapshot.h): open state, stock, locks and rerolls
+    void save(SnapshotWriter& out) const;
+    bool load(SnapshotReader& in);
     void openShop(int waveNumber);
     void closeShop();
     
@@ -79,17 +112,22 @@ public:
     
 private:
     bool active;
-    std::vector<ShopItem> items;
+    std::pmr::vector<ShopItem> items;
     int rerollCount;
     int currentWave;
     
-    // UI helpers
-    void renderShopItem(SDL_Renderer* renderer, const ShopItem& item, int x, int y, int width, int height, bool highlighted, int index);
-    void renderCharacterStats(SDL_Renderer* renderer, int x, int y, int width, int height);
-    void renderText(SDL_Renderer* renderer, const char* text, int x, int y, int scale = 1);
-    void renderNumber(SDL_Renderer* renderer, int number, int x, int y, int scale = 1);
-    void renderTTFText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color, int fontSize = 16);
-    SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer);
+    // Layout cache
+    ShopLayout layout;
+    bool layoutValid = false;
+    void updateLayout(int windowWidth, int windowHeight);
+    static bool pointInRect(int x, int y, const SDL_Rect& rect);
+    
+    // UI helpers. Text goes out as DrawList text; the backend caches its rasterization
+    void renderShopItem(DrawList& list, const ShopItem& item, int index, bool highlighted);
+    // Icon, name, description and price, clipped to the card
+    void renderCardContents(DrawList& list, const ShopItem& item, const SDL_Rect& card);
+    void renderCharacterStats(DrawList& list, int x, int y, int width, int height);
+    TextureHandle getItemIcon(const ShopItem& item) const;
     
     // Shop logic
     int calculateItemPrice(WeaponType weaponType, WeaponTier tier, int waveNumber);
@@ -106,20 +144,12 @@ private:
     int selectedOwnedItem;   // index of selected owned item in player's array (-1 if none)
     int hoveredOwnedItem;    // hover index for owned items
     
-    Game* gameRef = nullptr; // Reference to game for text rendering
+    Game* gameRef = nullptr; // Player, materials and assets
+    Arena& frameArena;
     
     static const int MAX_SHOP_ITEMS = 4;
 
-    // UI textures
-    SDL_Texture* texCardNormal = nullptr;
-    SDL_Texture* texCardSelected = nullptr;
-    SDL_Texture* texCardLocked = nullptr;
-    SDL_Texture* texCoin = nullptr;
-    SDL_Texture* texLock = nullptr;
-    SDL_Texture* texLockLocked = nullptr;
-    SDL_Texture* texReroll = nullptr;
-    SDL_Texture* texWeaponPistol = nullptr;
-    SDL_Texture* texWeaponSMG = nullptr;
-    SDL_Texture* texHealingBox = nullptr;
-    SDL_Texture* texMassBomb = nullptr;
+    // Weapon icons (tier 1 sprite) by weapon id, item icons by ItemType
+    TextureHandle weaponIcons[DEFS_MAX_WEAPONS];
+    TextureHandle itemIcons[ITEM_TYPE_COUNT];
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "Snapshot.h"
+#include "Log.h"
+#include <fstream>
+#include <iterator>
+
+static uint32_t fnv1a(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void SnapshotWriter::writeBytes(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    payload.insert(payload.end(), bytes, bytes + size);
+}
+
+void SnapshotWriter::writeCount(size_t count) {
+    write(static_cast<uint32_t>(count));
+    markSegment();
+}
+
+void SnapshotWriter::markSegment() {
+    segments.push_back(static_cast<uint32_t>(sizeof(SnapshotHeader) + payload.size()));
+}
+
+std::vector<uint8_t> SnapshotWriter::finish() const {
+    SnapshotHeader header;
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.payloadSize = static_cast<uint32_t>(payload.size());
+    header.checksum = fnv1a(payload.data(), payload.size());
+
+    std::vector<uint8_t> blob(sizeof(header) + payload.size());
+    std::memcpy(blob.data(), &header, sizeof(header));
+    if (!payload.empty()) {
+        std::memcpy(blob.data() + sizeof(header), payload.data(), payload.size());
+    }
+    return blob;
+}
+
+SnapshotReader::SnapshotReader(const uint8_t* data, size_t size) {
+    SnapshotHeader header;
+    if (!data || size < sizeof(header)) {
+        LOG_ERROR(CORE, "Snapshot is too short (%llu bytes)", static_cast<unsigned long long>(size));
+        failed = true;
+        return;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != SNAPSHOT_MAGIC) {
+        LOG_ERROR(CORE, "Not a snapshot (bad magic)");
+        failed = true;
+        return;
+    }
+    if (header.version != SNAPSHOT_VERSION) {
+        LOG_ERROR(CORE, "Snapshot version %u is not supported (expected %u)", header.version, SNAPSHOT_VERSION);
+        failed = true;
+        return;
+    }
+    if (header.payloadSize != size - sizeof(header) ||
+        header.checksum != fnv1a(data + sizeof(header), header.payloadSize)) {
+        LOG_ERROR(CORE, "Snapshot is truncated or corrupt");
+        failed = true;
+        return;
+    }
+    cursor = data + sizeof(header);
+    end = cursor + header.payloadSize;
+}
+
+void SnapshotReader::readBytes(void* data, size_t size) {
+    if (size == 0) return;
+    if (failed || static_cast<size_t>(end - cursor) < size) {
+        failed = true;
+        std::memset(data, 0, size);
+        return;
+    }
+    std::memcpy(data, cursor, size);
+    cursor += size;
+}
+
+uint32_t SnapshotReader::readCount(uint32_t maxCount) {
+    uint32_t count = read<uint32_t>();
+    if (count > maxCount) {
+        failed = true;
+        return 0;
+    }
+    return count;
+}
+
+bool writeSnapshotFile(const std::string& path, const std::vector<uint8_t>& blob) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()))) {
+        LOG_ERROR(CORE, "Could not write snapshot %s", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool readSnapshotFile(const std::string& path, std::vector<uint8_t>& blob) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        LOG_ERROR(CORE, "Could not open snapshot %s", path.c_str());
+        return false;
+    }
+    blob.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Binary simulation snapshots: everything needed to resume a run exactly
+// (player, weapons, items, enemies, boss, world entities, wave state machine,
+// shop and RNG streams), but no textures, fonts or other assets. Game builds
+// and restores them; each stateful class writes its own section.
+//
+//   SnapshotHeader
+//   sections in a fixed order (see Game::saveSnapshot)
+//
+// Values are raw host-order (little-endian on every supported platform).
+// Bump SNAPSHOT_VERSION whenever a section changes layout; older blobs are
+// rejected rather than misread.
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x56415342; // "BSAV"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t payloadSize;
+    uint32_t checksum;   // FNV-1a over the payload
+};
+
+static_assert(sizeof(SnapshotHeader) == 16, "SnapshotHeader layout changed");
+
+class SnapshotWriter {
+public:
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot values must be plain data");
+        writeBytes(&value, sizeof(T));
+    }
+
+    // Element count followed by the raw elements
+    template<typename T>
+    void writeArray(const T* values, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot values must be plain data");
+        writeCount(count);
+        writeBytes(values, sizeof(T) * count);
+        markSegment();
+    }
+
+    // Element count for an array the caller then writes element by element
+    void writeCount(size_t count);
+
+    template<typename T>
+    void writeVector(const std::vector<T>& values) { writeArray(values.data(), values.size()); }
+
+    void writeBytes(const void* data, size_t size);
+
+    // Header + payload
+    std::vector<uint8_t> finish() const;
+
+    // Blob offsets where each array's elements start and (for writeArray) end.
+    // Not part of the blob; SnapshotHistory diffs segment against segment, so
+    // an array changing length doesn't shift everything written after it
+    const std::vector<uint32_t>& getSegments() const { return segments; }
+
+private:
+    void markSegment();
+
+    std::vector<uint8_t> payload;
+    std::vector<uint32_t> segments;
+};
+
+// Reads back what SnapshotWriter wrote. Any overrun marks the reader failed;
+// later reads return zeroed values, so callers check ok() once at the end.
+class SnapshotReader {
+public:
+    // Validates the header; ok() is false for a foreign, truncated or corrupt blob
+    SnapshotReader(const uint8_t* data, size_t size);
+
+    template<typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot values must be plain data");
+        T value;
+        std::memset(static_cast<void*>(&value), 0, sizeof(T));
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    void read(T& value) { value = read<T>(); }
+
+    // Reads an element count (capped at maxCount) for the caller to fill
+    uint32_t readCount(uint32_t maxCount);
+
+    template<typename T>
+    void readVector(std::vector<T>& values, uint32_t maxCount = 1u << 20) {
+        uint32_t count = readCount(maxCount);
+        values.resize(count);
+        readBytes(values.data(), sizeof(T) * count);
+    }
+
+    void readBytes(void* data, size_t size);
+
+    bool ok() const { return !failed; }
+    bool atEnd() const { return cursor == end; }
+    void fail() { failed = true; }
+
+private:
+    const uint8_t* cursor = nullptr;
+    const uint8_t* end = nullptr;
+    bool failed = false;
+};
+
+bool writeSnapshotFile(const std::string& path, const std::vector<uint8_t>& blob);
+bool readSnapshotFile(const std::string& path, std::vector<uint8_t>& blob);
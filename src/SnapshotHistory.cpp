@@ -0,0 +1,203 @@
+#include "SnapshotHistory.h"
+#include <algorithm>
+#include <cstring>
+
+// A zero run shorter than this costs more to end a literal for than it saves
+static const size_t MIN_ZERO_RUN = 4;
+static const size_t MAX_RUN = 0xFFFF;
+
+static void appendU16(std::vector<uint8_t>& out, size_t value) {
+    uint16_t v = static_cast<uint16_t>(value);
+    out.insert(out.end(), reinterpret_cast<uint8_t*>(&v), reinterpret_cast<uint8_t*>(&v) + sizeof(v));
+}
+
+void SnapshotHistory::setBudget(size_t budgetBytes) {
+    budget = budgetBytes;
+    if (budget == 0) {
+        clear();
+    }
+}
+
+void SnapshotHistory::clear() {
+    entries.clear();
+    bytes = 0;
+}
+
+size_t SnapshotHistory::keyframeFor(size_t index) const {
+    for (size_t i = index + 1; i-- > 0;) {
+        if (entries[i].keyframe) return i;
+    }
+    return NO_KEYFRAME;
+}
+
+bool SnapshotHistory::alignKeyframe(const Entry& key, const std::vector<uint32_t>& segments, size_t size,
+                                    std::vector<uint8_t>& out) {
+    if (key.segments.size() != segments.size()) return false;
+
+    out.assign(size, 0);
+    size_t begin = 0;
+    size_t keyBegin = 0;
+    for (size_t s = 0; s <= segments.size(); s++) {
+        size_t end = s < segments.size() ? segments[s] : size;
+        size_t keyEnd = s < key.segments.size() ? key.segments[s] : key.data.size();
+        if (end < begin || end > size || keyEnd < keyBegin || keyEnd > key.data.size()) return false;
+
+        size_t length = std::min(end - begin, keyEnd - keyBegin);
+        if (length > 0) {
+            std::memcpy(out.data() + begin, key.data.data() + keyBegin, length);
+        }
+        begin = end;
+        keyBegin = keyEnd;
+    }
+    return true;
+}
+
+void SnapshotHistory::push(uint64_t tick, const std::vector<uint8_t>& blob, const std::vector<uint32_t>& segments) {
+    if (budget == 0) return;
+
+    Entry entry;
+    entry.tick = tick;
+    entry.keyframe = true;
+    entry.segments = segments;
+
+    // Deltas only make sense against a recent keyframe with the same layout
+    if (!entries.empty()) {
+        size_t last = entries.size() - 1;
+        size_t key = keyframeFor(last);
+        if (key != NO_KEYFRAME && last - key + 1 < KEYFRAME_INTERVAL &&
+            alignKeyframe(entries[key], segments, blob.size(), reference)) {
+            encodeDelta(reference, blob, entry.data);
+            // Too little in common (a wave just ended, the shop opened): start over
+            entry.keyframe = entry.data.size() >= blob.size();
+        }
+    }
+    if (entry.keyframe) {
+        entry.data = blob;
+    }
+
+    bytes += entry.bytes();
+    entries.push_back(std::move(entry));
+
+    // Drop whole keyframe groups from the front, but never the newest one
+    while (bytes > budget) {
+        bool laterKeyframe = false;
+        for (size_t i = 1; i < entries.size() && !laterKeyframe; i++) {
+            laterKeyframe = entries[i].keyframe;
+        }
+        if (!laterKeyframe) break;
+        popOldest();
+    }
+}
+
+void SnapshotHistory::popOldest() {
+    do {
+        bytes -= entries.front().bytes();
+        entries.pop_front();
+    } while (!entries.empty() && !entries.front().keyframe);
+}
+
+void SnapshotHistory::popNewest() {
+    bytes -= entries.back().bytes();
+    entries.pop_back();
+}
+
+bool SnapshotHistory::rewind(uint64_t beforeTick, std::vector<uint8_t>& blob, uint64_t& tick) {
+    while (!entries.empty() && entries.back().tick >= beforeTick) {
+        popNewest();
+    }
+    if (entries.empty()) return false;
+
+    // The entry itself stays: it's where the timeline now continues from
+    const Entry& entry = entries.back();
+    if (entry.keyframe) {
+        blob = entry.data;
+    } else {
+        uint32_t size = 0;
+        if (entry.data.size() >= sizeof(size)) {
+            std::memcpy(&size, entry.data.data(), sizeof(size));
+        }
+        size_t key = keyframeFor(entries.size() - 1);
+        if (key == NO_KEYFRAME || !alignKeyframe(entries[key], entry.segments, size, reference) ||
+            !decodeDelta(reference, entry.data, blob)) {
+            clear();
+            return false;
+        }
+    }
+    tick = entry.tick;
+    return true;
+}
+
+void SnapshotHistory::encodeDelta(const std::vector<uint8_t>& key, const std::vector<uint8_t>& blob,
+                                  std::vector<uint8_t>& out) {
+    const size_t size = blob.size();
+    const size_t shared = std::min(key.size(), size);
+
+    // XOR in one pass first; the run scan below then only looks at the result
+    std::vector<uint8_t>& diff = scratch;
+    diff.resize(size);
+    for (size_t i = 0; i < shared; i++) {
+        diff[i] = static_cast<uint8_t>(blob[i] ^ key[i]);
+    }
+    if (size > shared) {
+        std::memcpy(diff.data() + shared, blob.data() + shared, size - shared);
+    }
+
+    out.clear();
+    out.reserve(size / 4);
+    uint32_t size32 = static_cast<uint32_t>(size);
+    out.insert(out.end(), reinterpret_cast<uint8_t*>(&size32), reinterpret_cast<uint8_t*>(&size32) + sizeof(size32));
+
+    const uint8_t* d = diff.data();
+    size_t i = 0;
+    while (i < size) {
+        size_t zeros = 0;
+        while (i + zeros < size && zeros < MAX_RUN && d[i + zeros] == 0) zeros++;
+        i += zeros;
+
+        // Literal run up to the next worthwhile zero run
+        size_t literals = 0;
+        size_t zeroRun = 0;
+        while (i + literals < size && literals < MAX_RUN) {
+            zeroRun = d[i + literals] == 0 ? zeroRun + 1 : 0;
+            literals++;
+            if (zeroRun == MIN_ZERO_RUN) break;
+        }
+        // Trailing zeros belong to the next run
+        while (literals > 0 && d[i + literals - 1] == 0) literals--;
+
+        appendU16(out, zeros);
+        appendU16(out, literals);
+        out.insert(out.end(), d + i, d + i + literals);
+        i += literals;
+    }
+}
+
+bool SnapshotHistory::decodeDelta(const std::vector<uint8_t>& key, const std::vector<uint8_t>& delta,
+                                  std::vector<uint8_t>& out) {
+    uint32_t size;
+    if (delta.size() < sizeof(size)) return false;
+    std::memcpy(&size, delta.data(), sizeof(size));
+    out.resize(size);
+
+    const uint8_t* cursor = delta.data() + sizeof(size);
+    const uint8_t* end = delta.data() + delta.size();
+    size_t i = 0;
+    while (cursor < end) {
+        uint16_t zeros, literals;
+        if (end - cursor < 4) return false;
+        std::memcpy(&zeros, cursor, sizeof(zeros));
+        std::memcpy(&literals, cursor + 2, sizeof(literals));
+        cursor += 4;
+        if (size - i < static_cast<size_t>(zeros) + literals || static_cast<size_t>(end - cursor) < literals) {
+            return false;
+        }
+
+        for (size_t j = 0; j < zeros; j++, i++) {
+            out[i] = i < key.size() ? key[i] : 0;
+        }
+        for (size_t j = 0; j < literals; j++, i++) {
+            out[i] = static_cast<uint8_t>(*cursor++ ^ (i < key.size() ? key[i] : 0));
+        }
+    }
+    return i == size;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+// Rolling in-memory history of simulation snapshots (Snapshot.h) for rewind.
+//
+// Every KEYFRAME_INTERVAL-th entry is a keyframe stored as-is; the entries in
+// between are deltas against their keyframe: the two blobs XORed byte by byte,
+// so unchanged bytes become zero, then the zero runs squeezed out:
+//
+//   uint32_t size                      decoded blob size
+//   { uint16_t zeros, uint16_t literals, literal bytes }*
+//
+// The XOR runs segment by segment (SnapshotWriter::getSegments): each array
+// is lined up against the same array in the keyframe, so a spawn or a death
+// only disturbs its own array instead of shifting every byte after it. Bytes
+// past the end of the keyframe's segment are XORed with zero, i.e. stored
+// literally. A blob with a different number of segments (the boss arrived,
+// an archetype was added) becomes a keyframe.
+//
+// Memory is capped by a byte budget: once it's exceeded the oldest keyframe
+// goes, along with the deltas that depend on it.
+class SnapshotHistory {
+public:
+    static const size_t KEYFRAME_INTERVAL = 20;
+
+    explicit SnapshotHistory(size_t budgetBytes = 8 * 1024 * 1024) : budget(budgetBytes) {}
+
+    void setBudget(size_t budgetBytes);
+    void push(uint64_t tick, const std::vector<uint8_t>& blob, const std::vector<uint32_t>& segments);
+
+    // Removes the newest entry older than `beforeTick` (and everything after it)
+    // and decodes it into blob. False when the history doesn't go back that far
+    bool rewind(uint64_t beforeTick, std::vector<uint8_t>& blob, uint64_t& tick);
+
+    void clear();
+    bool empty() const { return entries.empty(); }
+    size_t size() const { return entries.size(); }
+    size_t bytesUsed() const { return bytes; }
+    uint64_t oldestTick() const { return entries.empty() ? 0 : entries.front().tick; }
+
+private:
+    struct Entry {
+        uint64_t tick;
+        bool keyframe;
+        std::vector<uint8_t> data;
+        std::vector<uint32_t> segments;  // Blob offsets, kept for deltas and keyframes alike
+
+        size_t bytes() const { return data.size() + segments.size() * sizeof(uint32_t); }
+    };
+
+    // The keyframe's bytes laid out segment by segment at the blob's offsets
+    static bool alignKeyframe(const Entry& key, const std::vector<uint32_t>& segments, size_t size,
+                              std::vector<uint8_t>& out);
+    void encodeDelta(const std::vector<uint8_t>& key, const std::vector<uint8_t>& blob,
+                     std::vector<uint8_t>& out);
+    static bool decodeDelta(const std::vector<uint8_t>& key, const std::vector<uint8_t>& delta,
+                            std::vector<uint8_t>& out);
+    void popOldest();
+    void popNewest();
+    // Index of the keyframe entry `index` decodes against
+    static const size_t NO_KEYFRAME = static_cast<size_t>(-1);
+    size_t keyframeFor(size_t index) const;
+
+    std::deque<Entry> entries;
+    size_t budget;
+    size_t bytes = 0;
+    // Aligned keyframe and XOR buffers reused across pushes
+    std::vector<uint8_t> reference;
+    std::vector<uint8_t> scratch;
+};
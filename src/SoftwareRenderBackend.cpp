@@ -0,0 +1,365 @@
+#include "SoftwareRenderBackend.h"
+#include "PixelBlend.h"
+#include "Log.h"
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    bool isWhite(SDL_Color mod) {
+        return mod.r == 255 && mod.g == 255 && mod.b == 255 && mod.a == 255;
+    }
+}
+
+SoftwareRenderBackend::SoftwareRenderBackend(int frameWidth, int frameHeight, const AssetLoader& assetLoader, TTF_Font* textFont)
+    : width(frameWidth), height(frameHeight),
+      framebuffer(static_cast<size_t>(frameWidth) * frameHeight, 0),
+      rowScratch(frameWidth), columnScratch(frameWidth),
+      clip{0, 0, frameWidth, frameHeight},
+      tilesX((frameWidth + TILE_SIZE - 1) / TILE_SIZE),
+      tilesY((frameHeight + TILE_SIZE - 1) / TILE_SIZE),
+      assets(assetLoader), font(textFont) {
+    dirtyTiles.assign(static_cast<size_t>(tilesX) * tilesY, 0);
+    previousTiles.assign(dirtyTiles.size(), 0);
+    LOG_INFO(RENDER, "Software renderer: %dx%d framebuffer, %s blend kernels", width, height, PixelBlend::kernelName());
+}
+
+SoftwareRenderBackend::~SoftwareRenderBackend() {
+    if (frame == 0) return;
+    double rasterMs = static_cast<double>(rasterTicks) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+    LOG_INFO(RENDER, "Software renderer: %llu frames, %.2f ms raster per frame, %.1f of %d tiles drawn per frame",
+             static_cast<unsigned long long>(frame), rasterMs / static_cast<double>(frame),
+             static_cast<double>(dirtyTileTotal) / static_cast<double>(frame), tilesX * tilesY);
+    if (missingTextures > 0) {
+        LOG_WARN(RENDER, "Software renderer skipped %d sprite draws with no kept pixels", missingTextures);
+    }
+}
+
+void SoftwareRenderBackend::saveFrames(const std::string& directory, int interval) {
+    frameDirectory = directory;
+    frameInterval = std::max(1, interval);
+}
+
+void SoftwareRenderBackend::drawWorld(RenderQueue& world, SDL_Color clearColor) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    clearFrame(clearColor);
+    clip = {0, 0, width, height};
+    world.flush(static_cast<RenderQueue::Rasterizer&>(*this));
+    rasterTicks += SDL_GetPerformanceCounter() - start;
+}
+
+void SoftwareRenderBackend::drawOverlay(const DrawList& overlay) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    clip = {0, 0, width, height};
+
+    for (const DrawList::Command& command : overlay.getCommands()) {
+        const SDL_Rect& r = command.rect;
+        switch (command.type) {
+            case DrawList::CommandType::SPRITE:
+                sprite(command.texture, r, 0.0f, command.color, SDL_BLENDMODE_BLEND);
+                break;
+            case DrawList::CommandType::QUAD:
+                fillRect(r, command.color, command.blend);
+                break;
+            case DrawList::CommandType::QUAD_OUTLINE: {
+                SDL_Rect edges[4] = {{r.x, r.y, r.w, 1}, {r.x, r.y + r.h - 1, r.w, 1},
+                                     {r.x, r.y, 1, r.h}, {r.x + r.w - 1, r.y, 1, r.h}};
+                fillRects(edges, 4, command.color, command.blend);
+                break;
+            }
+            case DrawList::CommandType::LINE:
+                drawLine(r.x, r.y, r.w, r.h, command.color, command.blend);
+                break;
+            case DrawList::CommandType::TEXT:
+                drawText(overlay, command);
+                break;
+            case DrawList::CommandType::CLIP:
+                clip = {0, 0, width, height};
+                if (r.w > 0) {
+                    SDL_Rect area = r;
+                    if (!clipRect(area)) area = {0, 0, 0, 0};
+                    clip = area;
+                }
+                break;
+        }
+    }
+
+    clip = {0, 0, width, height};
+    rasterTicks += SDL_GetPerformanceCounter() - start;
+}
+
+void SoftwareRenderBackend::present() {
+    frame++;
+    for (uint8_t tile : dirtyTiles) dirtyTileTotal += tile;
+
+    if (frameInterval > 0 && frame % frameInterval == 0) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "/frame-%06llu.png", static_cast<unsigned long long>(frame));
+        savePng(frameDirectory + name);
+    }
+
+    previousTiles.swap(dirtyTiles);
+    std::fill(dirtyTiles.begin(), dirtyTiles.end(), 0);
+
+    if (frame % EVICT_INTERVAL_FRAMES == 0) {
+        evictStaleText();
+    }
+}
+
+bool SoftwareRenderBackend::savePng(const std::string& path) const {
+    // Blend modes leave alpha alone or saturate it, but NONE quads write theirs; the frame is opaque
+    std::vector<uint32_t> pixels(framebuffer);
+    for (uint32_t& pixel : pixels) pixel |= 0xFF000000u;
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels.data(), width, height, 32,
+                                                              width * static_cast<int>(sizeof(uint32_t)),
+                                                              SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        LOG_ERROR(RENDER, "Could not wrap framebuffer: %s", SDL_GetError());
+        return false;
+    }
+    bool saved = IMG_SavePNG(surface, path.c_str()) == 0;
+    SDL_FreeSurface(surface);
+    if (!saved) {
+        LOG_ERROR(RENDER, "Could not write frame %s: %s", path.c_str(), IMG_GetError());
+    }
+    return saved;
+}
+
+void SoftwareRenderBackend::clearFrame(SDL_Color clearColor) {
+    clearColor.a = 255;
+    bool sameColor = clearColor.r == lastClear.r && clearColor.g == lastClear.g && clearColor.b == lastClear.b;
+    if (!cleared || !sameColor) {
+        PixelBlend::fill(framebuffer.data(), static_cast<int>(framebuffer.size()), clearColor, SDL_BLENDMODE_NONE);
+        lastClear = clearColor;
+        cleared = true;
+        return;
+    }
+
+    // Tiles nobody drew on last frame still hold the clear colour
+    for (int ty = 0; ty < tilesY; ty++) {
+        for (int tx = 0; tx < tilesX; tx++) {
+            if (!previousTiles[ty * tilesX + tx]) continue;
+            int x = tx * TILE_SIZE;
+            int w = std::min(TILE_SIZE, width - x);
+            int yEnd = std::min(height, (ty + 1) * TILE_SIZE);
+            for (int y = ty * TILE_SIZE; y < yEnd; y++) {
+                PixelBlend::fill(row(y) + x, w, clearColor, SDL_BLENDMODE_NONE);
+            }
+        }
+    }
+}
+
+bool SoftwareRenderBackend::clipRect(SDL_Rect& rect) const {
+    int left = std::max(rect.x, clip.x);
+    int top = std::max(rect.y, clip.y);
+    int right = std::min(rect.x + rect.w, clip.x + clip.w);
+    int bottom = std::min(rect.y + rect.h, clip.y + clip.h);
+    if (right <= left || bottom <= top) return false;
+    rect = {left, top, right - left, bottom - top};
+    return true;
+}
+
+void SoftwareRenderBackend::markDirty(const SDL_Rect& rect) {
+    // rect is already clipped to the framebuffer
+    int tx0 = rect.x / TILE_SIZE;
+    int ty0 = rect.y / TILE_SIZE;
+    int tx1 = (rect.x + rect.w - 1) / TILE_SIZE;
+    int ty1 = (rect.y + rect.h - 1) / TILE_SIZE;
+    for (int ty = ty0; ty <= ty1; ty++) {
+        std::fill_n(&dirtyTiles[ty * tilesX + tx0], tx1 - tx0 + 1, 1);
+    }
+}
+
+void SoftwareRenderBackend::sprite(SDL_Texture* texture, const SDL_Rect& dst, float degrees, SDL_Color mod,
+                                   SDL_BlendMode blend) {
+    const PixelImage* image = assets.findPixels(texture);
+    if (!image || image->width == 0 || image->height == 0) {
+        missingTextures++;
+        return;
+    }
+    if (degrees == 0.0f) {
+        drawImage(*image, dst, mod, blend);
+    } else {
+        drawRotatedImage(*image, dst, degrees, mod, blend);
+    }
+}
+
+void SoftwareRenderBackend::fillRects(const SDL_Rect* rects, int count, SDL_Color color, SDL_BlendMode blend) {
+    for (int i = 0; i < count; i++) {
+        fillRect(rects[i], color, blend);
+    }
+}
+
+void SoftwareRenderBackend::points(const SDL_Point* pts, int count, SDL_Color color, SDL_BlendMode blend) {
+    for (int i = 0; i < count; i++) {
+        SDL_Rect pixel = {pts[i].x, pts[i].y, 1, 1};
+        if (!clipRect(pixel)) continue;
+        markDirty(pixel);
+        PixelBlend::fill(row(pixel.y) + pixel.x, 1, color, blend);
+    }
+}
+
+void SoftwareRenderBackend::lines(const SDL_Point* pts, int count, SDL_Color color, SDL_BlendMode blend) {
+    for (int i = 0; i + 1 < count; i++) {
+        drawLine(pts[i].x, pts[i].y, pts[i + 1].x, pts[i + 1].y, color, blend);
+    }
+}
+
+void SoftwareRenderBackend::fillRect(const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend) {
+    SDL_Rect area = rect;
+    if (!clipRect(area)) return;
+    markDirty(area);
+    for (int y = area.y; y < area.y + area.h; y++) {
+        PixelBlend::fill(row(y) + area.x, area.w, color, blend);
+    }
+}
+
+void SoftwareRenderBackend::drawLine(int x1, int y1, int x2, int y2, SDL_Color color, SDL_BlendMode blend) {
+    SDL_Rect bounds = {std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1};
+    if (!clipRect(bounds)) return;
+    markDirty(bounds);
+
+    // Bresenham, both endpoints drawn like SDL_RenderDrawLine
+    int dx = std::abs(x2 - x1);
+    int dy = -std::abs(y2 - y1);
+    int stepX = x1 < x2 ? 1 : -1;
+    int stepY = y1 < y2 ? 1 : -1;
+    int error = dx + dy;
+    while (true) {
+        if (x1 >= bounds.x && x1 < bounds.x + bounds.w && y1 >= bounds.y && y1 < bounds.y + bounds.h) {
+            PixelBlend::fill(row(y1) + x1, 1, color, blend);
+        }
+        if (x1 == x2 && y1 == y2) break;
+        int doubled = 2 * error;
+        if (doubled >= dy) { error += dy; x1 += stepX; }
+        if (doubled <= dx) { error += dx; y1 += stepY; }
+    }
+}
+
+void SoftwareRenderBackend::drawImage(const PixelImage& image, const SDL_Rect& dst, SDL_Color mod, SDL_BlendMode blend) {
+    SDL_Rect area = dst;
+    if (dst.w <= 0 || dst.h <= 0 || !clipRect(area)) return;
+    markDirty(area);
+
+    // Unscaled, untinted rows blend straight from the image
+    bool direct = dst.w == image.width && isWhite(mod);
+    if (!direct) {
+        for (int x = 0; x < area.w; x++) {
+            columnScratch[x] = (area.x + x - dst.x) * image.width / dst.w;
+        }
+    }
+
+    for (int y = area.y; y < area.y + area.h; y++) {
+        int sourceY = (y - dst.y) * image.height / dst.h;
+        const uint32_t* source = &image.pixels[static_cast<size_t>(sourceY) * image.width];
+        if (direct) {
+            PixelBlend::blend(row(y) + area.x, source + (area.x - dst.x), area.w, blend);
+            continue;
+        }
+        for (int x = 0; x < area.w; x++) {
+            rowScratch[x] = source[columnScratch[x]];
+        }
+        if (!isWhite(mod)) PixelBlend::modulate(rowScratch.data(), area.w, mod);
+        PixelBlend::blend(row(y) + area.x, rowScratch.data(), area.w, blend);
+    }
+}
+
+void SoftwareRenderBackend::drawRotatedImage(const PixelImage& image, const SDL_Rect& dst, float degrees, SDL_Color mod,
+                                             SDL_BlendMode blend) {
+    if (dst.w <= 0 || dst.h <= 0) return;
+
+    // Clockwise around the centre, as SDL_RenderCopyEx; each destination pixel maps back into the sprite
+    float radians = degrees * 3.14159265f / 180.0f;
+    float c = std::cos(radians);
+    float s = std::sin(radians);
+    float halfW = dst.w * 0.5f;
+    float halfH = dst.h * 0.5f;
+    float centerX = dst.x + halfW;
+    float centerY = dst.y + halfH;
+    float extentX = std::fabs(c) * halfW + std::fabs(s) * halfH;
+    float extentY = std::fabs(s) * halfW + std::fabs(c) * halfH;
+
+    int left = static_cast<int>(std::floor(centerX - extentX));
+    int top = static_cast<int>(std::floor(centerY - extentY));
+    SDL_Rect area = {left, top, static_cast<int>(std::ceil(centerX + extentX)) - left + 1,
+                     static_cast<int>(std::ceil(centerY + extentY)) - top + 1};
+    if (!clipRect(area)) return;
+    markDirty(area);
+
+    float scaleX = static_cast<float>(image.width) / dst.w;
+    float scaleY = static_cast<float>(image.height) / dst.h;
+    for (int y = area.y; y < area.y + area.h; y++) {
+        float py = y + 0.5f - centerY;
+        for (int x = 0; x < area.w; x++) {
+            float px = area.x + x + 0.5f - centerX;
+            float u = px * c + py * s + halfW;
+            float v = -px * s + py * c + halfH;
+            uint32_t pixel = 0;
+            if (u >= 0.0f && u < dst.w && v >= 0.0f && v < dst.h) {
+                int sourceX = std::min(image.width - 1, static_cast<int>(u * scaleX));
+                int sourceY = std::min(image.height - 1, static_cast<int>(v * scaleY));
+                pixel = image.pixels[static_cast<size_t>(sourceY) * image.width + sourceX];
+            }
+            rowScratch[x] = pixel;
+        }
+        if (!isWhite(mod)) PixelBlend::modulate(rowScratch.data(), area.w, mod);
+        PixelBlend::blend(row(y) + area.x, rowScratch.data(), area.w, blend);
+    }
+}
+
+void SoftwareRenderBackend::drawText(const DrawList& overlay, const DrawList::Command& command) {
+    if (!font) return;
+    const PixelImage* image = findText(overlay.textOf(command), command.textLength, command.color);
+    if (image && image->width > 0) {
+        drawImage(*image, {command.rect.x, command.rect.y, image->width, image->height},
+                  {255, 255, 255, 255}, SDL_BLENDMODE_BLEND);
+    }
+}
+
+const PixelImage* SoftwareRenderBackend::findText(const char* text, int length, SDL_Color color) {
+    // Same keying as SdlRenderBackend: colour, then the string
+    char colorKey[10];
+    std::snprintf(colorKey, sizeof(colorKey), "%02x%02x%02x%02x|", color.r, color.g, color.b, color.a);
+    keyScratch.assign(colorKey);
+    keyScratch.append(text, length);
+
+    auto it = textCache.find(keyScratch);
+    if (it == textCache.end()) {
+        CachedText entry;
+        entry.lastUsedFrame = frame;
+        // A failed render is cached empty so it isn't retried every frame
+        SDL_Surface* rendered = TTF_RenderText_Blended(font, text, color);
+        SDL_Surface* surface = rendered ? SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_ARGB8888, 0) : nullptr;
+        if (surface) {
+            entry.image.width = surface->w;
+            entry.image.height = surface->h;
+            entry.image.pixels.resize(static_cast<size_t>(surface->w) * surface->h);
+            for (int y = 0; y < surface->h; y++) {
+                std::memcpy(&entry.image.pixels[static_cast<size_t>(y) * surface->w],
+                            static_cast<const uint8_t*>(surface->pixels) + y * surface->pitch,
+                            surface->w * sizeof(uint32_t));
+            }
+            PixelBlend::premultiplyImage(entry.image.pixels.data(), static_cast<int>(entry.image.pixels.size()));
+            SDL_FreeSurface(surface);
+        } else {
+            LOG_ERROR(RENDER, "Unable to render text surface! SDL_ttf Error: %s", TTF_GetError());
+        }
+        if (rendered) SDL_FreeSurface(rendered);
+        it = textCache.emplace(keyScratch, std::move(entry)).first;
+    }
+    it->second.lastUsedFrame = frame;
+    return &it->second.image;
+}
+
+void SoftwareRenderBackend::evictStaleText() {
+    for (auto it = textCache.begin(); it != textCache.end(); ) {
+        if (frame - it->second.lastUsedFrame > TEXT_CACHE_FRAMES) {
+            it = textCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
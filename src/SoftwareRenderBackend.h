@@ -0,0 +1,95 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "RenderBackend.h"
+#include "AssetLoader.h"
+
+// Draws frames on the CPU into an offscreen ARGB8888 framebuffer at logical
+// resolution, so render benchmarks run on machines without a GPU or display
+// and frames can be written out as PNGs for golden-image comparison.
+//
+// Sprite pixels come from the copies AssetLoader keeps (setKeepPixels) and
+// text from SDL_ttf, cached per (string, colour) like SdlRenderBackend.
+// Spans are blended with the PixelBlend kernels; sprites sample nearest-neighbour.
+//
+// The framebuffer is split into TILE_SIZE tiles and every draw marks the
+// tiles it touches. The next frame's clear only repaints tiles that were drawn
+// on, since everything else still holds the clear colour.
+class SoftwareRenderBackend : public RenderBackend, private RenderQueue::Rasterizer {
+public:
+    // font may be null: text commands are then skipped
+    SoftwareRenderBackend(int width, int height, const AssetLoader& assets, TTF_Font* font);
+    ~SoftwareRenderBackend() override;
+
+    const char* getName() const override { return "software"; }
+    void drawWorld(RenderQueue& world, SDL_Color clearColor) override;
+    void drawOverlay(const DrawList& overlay) override;
+    void present() override;
+
+    // Write every interval-th presented frame as <directory>/frame-NNNNNN.png
+    void saveFrames(const std::string& directory, int interval);
+    bool savePng(const std::string& path) const;
+
+private:
+    struct CachedText {
+        PixelImage image;
+        uint64_t lastUsedFrame;
+    };
+
+    // RenderQueue::Rasterizer
+    void sprite(SDL_Texture* texture, const SDL_Rect& dst, float degrees, SDL_Color mod, SDL_BlendMode blend) override;
+    void fillRects(const SDL_Rect* rects, int count, SDL_Color color, SDL_BlendMode blend) override;
+    void points(const SDL_Point* pts, int count, SDL_Color color, SDL_BlendMode blend) override;
+    void lines(const SDL_Point* pts, int count, SDL_Color color, SDL_BlendMode blend) override;
+
+    void fillRect(const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blend);
+    void drawLine(int x1, int y1, int x2, int y2, SDL_Color color, SDL_BlendMode blend);
+    void drawImage(const PixelImage& image, const SDL_Rect& dst, SDL_Color mod, SDL_BlendMode blend);
+    void drawRotatedImage(const PixelImage& image, const SDL_Rect& dst, float degrees, SDL_Color mod,
+                          SDL_BlendMode blend);
+    void drawText(const DrawList& overlay, const DrawList::Command& command);
+    const PixelImage* findText(const char* text, int length, SDL_Color color);
+    void evictStaleText();
+
+    bool clipRect(SDL_Rect& rect) const;
+    void markDirty(const SDL_Rect& rect);
+    void clearFrame(SDL_Color clearColor);
+    uint32_t* row(int y) { return &framebuffer[static_cast<size_t>(y) * width]; }
+
+    int width;
+    int height;
+    std::vector<uint32_t> framebuffer;
+    std::vector<uint32_t> rowScratch;
+    std::vector<int> columnScratch;
+    SDL_Rect clip;
+
+    // Tile dirty tracking
+    int tilesX;
+    int tilesY;
+    std::vector<uint8_t> dirtyTiles;     // Drawn on this frame
+    std::vector<uint8_t> previousTiles;  // Drawn on last frame; cleared at the start of this one
+    SDL_Color lastClear = {0, 0, 0, 0};
+    bool cleared = false;
+
+    const AssetLoader& assets;
+    TTF_Font* font;
+    std::map<std::string, CachedText, std::less<>> textCache;
+    std::string keyScratch;
+
+    std::string frameDirectory;
+    int frameInterval = 0;
+
+    // Totals for the exit summary
+    uint64_t frame = 0;
+    uint64_t rasterTicks = 0;
+    uint64_t dirtyTileTotal = 0;
+    int missingTextures = 0;
+
+    static constexpr int TILE_SIZE = 64;
+    static const int TEXT_CACHE_FRAMES = 120;
+    static const int EVICT_INTERVAL_FRAMES = 60;
+};
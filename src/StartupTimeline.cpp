@@ -0,0 +1,59 @@
+#include "StartupTimeline.h"
+#include "AssetLoader.h"
+#include "Log.h"
+
+StartupTimeline::StartupTimeline()
+    : startCounter(SDL_GetPerformanceCounter()), firstFrameAt(0) {
+}
+
+void StartupTimeline::beginPhase(const char* name) {
+    Phase phase;
+    phase.name = name;
+    phase.start = SDL_GetPerformanceCounter();
+    phase.end = 0;
+    phase.depth = static_cast<int>(openPhases.size());
+    openPhases.push_back(phases.size());
+    phases.push_back(phase);
+}
+
+void StartupTimeline::endPhase() {
+    if (openPhases.empty()) return;
+    phases[openPhases.back()].end = SDL_GetPerformanceCounter();
+    openPhases.pop_back();
+}
+
+void StartupTimeline::markFirstFrame() {
+    if (firstFrameAt == 0) {
+        firstFrameAt = SDL_GetPerformanceCounter();
+    }
+}
+
+float StartupTimeline::toMs(Uint64 counter) const {
+    if (counter < startCounter) return 0.0f;
+    return static_cast<float>(counter - startCounter) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+}
+
+void StartupTimeline::report(const AssetLoader& assets) const {
+    LOG_INFO(CORE, "=== Startup timeline (ms since start) ===");
+    for (const Phase& phase : phases) {
+        float start = toMs(phase.start);
+        float duration = phase.end ? toMs(phase.end) - start : 0.0f;
+        LOG_INFO(CORE, "  %8.1f  %*s%-*s%8.1f ms", start, phase.depth * 2, "", 36 - phase.depth * 2,
+                 phase.name.c_str(), duration);
+    }
+
+    LOG_INFO(CORE, "  Textures (requested -> ready, decode / upload):");
+    for (const TextureAsset* asset : assets.getRequestHistory()) {
+        if (asset->state == AssetState::PENDING) {
+            LOG_INFO(CORE, "  %8.1f  %-52s pending", toMs(asset->requestedAt), asset->path.c_str());
+            continue;
+        }
+        LOG_INFO(CORE, "  %8.1f  %-52s -> %7.1f  (%.1f / %.1f)%s%s", toMs(asset->requestedAt), asset->path.c_str(),
+                 toMs(asset->readyAt), asset->decodeMs, asset->uploadMs, asset->packEntry ? " [pack]" : "",
+                 asset->state == AssetState::FAILED ? " FAILED" : "");
+    }
+
+    if (hasFirstFrame()) {
+        LOG_INFO(CORE, "  Time to first frame: %.1f ms", getTimeToFirstFrameMs());
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+class AssetLoader;
+
+// Records where startup time goes, from Game construction (effectively main)
+// to the first presented frame, plus when each texture became ready.
+class StartupTimeline {
+public:
+    StartupTimeline();
+
+    // Phases may nest; they're indented in the report by depth
+    void beginPhase(const char* name);
+    void endPhase();
+
+    void markFirstFrame();
+    bool hasFirstFrame() const { return firstFrameAt != 0; }
+    float getTimeToFirstFrameMs() const { return hasFirstFrame() ? toMs(firstFrameAt) : 0.0f; }
+
+    // Milliseconds since startup for a performance-counter timestamp
+    float toMs(Uint64 counter) const;
+
+    void report(const AssetLoader& assets) const;
+
+private:
+    struct Phase {
+        std::string name;
+        Uint64 start;
+        Uint64 end;
+        int depth;
+    };
+
+    Uint64 startCounter;
+    Uint64 firstFrameAt;
+    std::vector<Phase> phases;
+    std::vector<size_t> openPhases;
+};
+
+// RAII helper: times the enclosing scope as one phase
+class ScopedStartupPhase {
+public:
+    ScopedStartupPhase(StartupTimeline& timeline, const char* name) : timeline(timeline) { timeline.beginPhase(name); }
+    ~ScopedStartupPhase() { timeline.endPhase(); }
+
+private:
+    StartupTimeline& timeline;
+};
@@ -0,0 +1,28 @@
+#include "Systems.h"
+
+void moveEntities(World& world, float deltaTime, ComponentMask with, ComponentMask without) {
+    world.each<Transform, Velocity>([deltaTime](Entity, Transform& transform, Velocity& velocity) {
+        velocity.value.y += velocity.gravity * deltaTime;
+        transform.position += velocity.value * deltaTime;
+    }, with, without);
+}
+
+void ageLifetimes(World& world, float deltaTime, ComponentMask with, ComponentMask without) {
+    world.each<Lifetime>([deltaTime](Entity, Lifetime& lifetime) {
+        lifetime.age += deltaTime;
+    }, with, without);
+}
+
+void destroyExpired(World& world) {
+    world.each<Lifetime>([&world](Entity entity, Lifetime& lifetime) {
+        if (lifetime.expired()) {
+            world.destroy(entity);
+        }
+    });
+}
+
+void animateBob(World& world, float deltaTime) {
+    world.each<Bob>([deltaTime](Entity, Bob& bob) {
+        bob.phase += bob.speed * deltaTime;
+    });
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "World.h"
+
+// Generic systems shared by every entity kind in World. `with`/`without` narrow
+// them to a subset, e.g. only Cosmetic entities while the game is paused.
+
+// Transform += Velocity (with gravity)
+void moveEntities(World& world, float deltaTime, ComponentMask with = 0, ComponentMask without = 0);
+
+// Advances Lifetime::age; expiry is left to destroyExpired() so kind-specific
+// systems get a chance to react (bag a material, spawn the telegraphed enemy)
+void ageLifetimes(World& world, float deltaTime, ComponentMask with = 0, ComponentMask without = 0);
+void destroyExpired(World& world);
+
+void animateBob(World& world, float deltaTime);
@@ -0,0 +1,155 @@
+#include "Targeting.h"
+#include "Enemy.h"
+#include "BossEnemy.h"
+#include "RenderScaler.h"
+#include <algorithm>
+
+const int Targeting::GRID_WIDTH = (LOGICAL_WIDTH + CELL_SIZE - 1) / CELL_SIZE;
+const int Targeting::GRID_HEIGHT = (LOGICAL_HEIGHT + CELL_SIZE - 1) / CELL_SIZE;
+
+// Anything off the field is binned into the nearest border cell; it's only
+// ever farther away than its cell suggests, so the ring bound still holds
+int Targeting::cellIndex(Vector2 position) const {
+    int x = std::clamp(static_cast<int>(position.x / CELL_SIZE), 0, GRID_WIDTH - 1);
+    int y = std::clamp(static_cast<int>(position.y / CELL_SIZE), 0, GRID_HEIGHT - 1);
+    return y * GRID_WIDTH + x;
+}
+
+void Targeting::add(Vector2 position, float radius) {
+    positions.push_back(position);
+    radii.push_back(radius);
+    cells.push_back(cellIndex(position));
+    maxRadius = std::max(maxRadius, radius);
+}
+
+void Targeting::rebuild(EnemyBatches& enemies, const BossEnemy* boss) {
+    positions.clear();
+    radii.clear();
+    cells.clear();
+    maxRadius = 0.0f;
+
+    enemies.forEach([&](Enemy& enemy) {
+        if (enemy.isAlive()) add(enemy.getPosition(), enemy.getRadius());
+    });
+    if (boss && boss->isAlive()) {
+        add(boss->getPosition(), boss->getRadius());
+    }
+
+    // Counting sort by cell: one pass to count, one to place
+    cellStart.assign(GRID_WIDTH * GRID_HEIGHT + 1, 0);
+    for (int cell : cells) {
+        cellStart[cell + 1]++;
+    }
+    for (size_t c = 1; c < cellStart.size(); c++) {
+        cellStart[c] += cellStart[c - 1];
+    }
+
+    sortedPositions.resize(positions.size());
+    sortedRadii.resize(positions.size());
+    // cellStart[c] doubles as the write cursor for cell c, then gets shifted back
+    for (size_t i = 0; i < positions.size(); i++) {
+        int slot = cellStart[cells[i]]++;
+        sortedPositions[slot] = positions[i];
+        sortedRadii[slot] = radii[i];
+    }
+    for (size_t c = cellStart.size() - 1; c > 0; c--) {
+        cellStart[c] = cellStart[c - 1];
+    }
+    cellStart[0] = 0;
+}
+
+int Targeting::nearest(Vector2 from, float range, int k, TargetHit* out) const {
+    k = std::min(k, MAX_K);
+    if (k <= 0 || positions.empty()) return 0;
+
+    int found = 0;
+    const float reach = range + maxRadius;
+    const int origin = cellIndex(from);
+    const int originX = origin % GRID_WIDTH;
+    const int originY = origin / GRID_WIDTH;
+    const int maxRing = std::max(GRID_WIDTH, GRID_HEIGHT);
+
+    auto visitCell = [&](int x, int y) {
+        if (x < 0 || y < 0 || x >= GRID_WIDTH || y >= GRID_HEIGHT) return;
+        int cell = y * GRID_WIDTH + x;
+        for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+            float dx = sortedPositions[i].x - from.x;
+            float dy = sortedPositions[i].y - from.y;
+            float distanceSq = dx * dx + dy * dy;
+            float limit = range + sortedRadii[i];
+            if (distanceSq > limit * limit) continue;
+            if (found == k && distanceSq >= out[k - 1].distanceSq) continue;
+
+            // Insertion into the short sorted list
+            int slot = found < k ? found++ : k - 1;
+            while (slot > 0 && out[slot - 1].distanceSq > distanceSq) {
+                out[slot] = out[slot - 1];
+                slot--;
+            }
+            out[slot] = {sortedPositions[i], sortedRadii[i], distanceSq};
+        }
+    };
+
+    for (int ring = 0; ring <= maxRing; ring++) {
+        // Every cell of this ring is at least (ring - 1) cells away from `from`
+        if (ring > 1) {
+            float ringDistance = (ring - 1) * static_cast<float>(CELL_SIZE);
+            if (ringDistance > reach) break;
+            if (found == k && ringDistance * ringDistance >= out[k - 1].distanceSq) break;
+        }
+
+        if (ring == 0) {
+            visitCell(originX, originY);
+            continue;
+        }
+        // Perimeter only: full top and bottom rows, then the two side columns
+        for (int x = originX - ring; x <= originX + ring; x++) {
+            visitCell(x, originY - ring);
+            visitCell(x, originY + ring);
+        }
+        for (int y = originY - ring + 1; y <= originY + ring - 1; y++) {
+            visitCell(originX - ring, y);
+            visitCell(originX + ring, y);
+        }
+    }
+    return found;
+}
+
+void Targeting::assign(Vector2 from, const float* ranges, int count, AimMode mode, WeaponTarget* out) const {
+    for (int i = 0; i < count; i++) {
+        out[i] = WeaponTarget();
+    }
+    if (mode == AimMode::MOUSE || count <= 0) return;
+
+    float maxRange = 0.0f;
+    for (int i = 0; i < count; i++) {
+        maxRange = std::max(maxRange, ranges[i]);
+    }
+
+    // The nearest target overall is the nearest for every weapon that can reach
+    // it, so NEAREST needs a single hit; SPREAD needs one per weapon
+    TargetHit hits[MAX_K];
+    int found = nearest(from, maxRange, mode == AimMode::SPREAD ? count : 1, hits);
+    bool taken[MAX_K] = {};
+
+    for (int i = 0; i < count; i++) {
+        int pick = -1;
+        int fallback = -1;
+        for (int h = 0; h < found; h++) {
+            float limit = ranges[i] + hits[h].radius;
+            if (hits[h].distanceSq > limit * limit) continue;
+            if (fallback < 0) fallback = h;
+            if (mode != AimMode::SPREAD || !taken[h]) {
+                pick = h;
+                break;
+            }
+        }
+        // Every target in reach is already covered: double up on the nearest
+        if (pick < 0) pick = fallback;
+        if (pick >= 0) {
+            taken[pick] = true;
+            out[i].valid = true;
+            out[i].position = hits[pick].position;
+        }
+    }
+}
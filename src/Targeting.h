@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Vector2.h"
+
+class EnemyBatches;
+class BossEnemy;
+
+// How weapons pick what to shoot at
+enum class AimMode {
+    MOUSE,      // Every weapon fires along the player's aim (mouse or autopilot)
+    NEAREST,    // Every weapon fires at the nearest enemy within its own range
+    SPREAD      // Weapons take the nearest enemies in turn, one each, before doubling up
+};
+
+struct TargetHit {
+    Vector2 position;
+    float radius;
+    float distanceSq;   // From the query point to the target's center
+};
+
+struct WeaponTarget {
+    bool valid = false;
+    Vector2 position;
+};
+
+// Spatial index over live enemies (and the boss) for auto-aim. rebuild() bins
+// every target into a coarse uniform grid once per tick; queries then walk
+// rings of cells outwards from the query point and stop as soon as no unvisited
+// cell can hold anything nearer, so they touch a handful of cells instead of
+// scanning every enemy.
+class Targeting {
+public:
+    static const int MAX_K = 8;
+
+    void rebuild(EnemyBatches& enemies, const BossEnemy* boss);
+
+    // Up to k (<= MAX_K) targets whose body is within range of `from`, nearest
+    // first. Returns how many were written to out.
+    int nearest(Vector2 from, float range, int k, TargetHit* out) const;
+
+    // One query for all weapons sharing `from`: ranges[i] is weapon i's reach and
+    // out[i] receives its target (invalid when nothing is in reach or mode is MOUSE)
+    void assign(Vector2 from, const float* ranges, int count, AimMode mode, WeaponTarget* out) const;
+
+    size_t size() const { return positions.size(); }
+
+private:
+    static const int CELL_SIZE = 128;
+    static const int GRID_WIDTH;
+    static const int GRID_HEIGHT;
+
+    int cellIndex(Vector2 position) const;
+    void add(Vector2 position, float radius);
+
+    // Targets in insertion order, then counting-sorted by cell into the
+    // sorted* arrays; cellStart[c]..cellStart[c + 1] are the entries of cell c
+    std::vector<Vector2> positions;
+    std::vector<float> radii;
+    std::vector<int> cells;
+    std::vector<Vector2> sortedPositions;
+    std::vector<float> sortedRadii;
+    std::vector<int> cellStart;
+    float maxRadius = 0.0f;
+};
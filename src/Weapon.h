@@ -4,10 +4,17 @@
 #include <memory>
 #include "Vector2.h"
 #include "Bullet.h"
+#include "AssetLoader.h"
+#include "RenderQueue.h"
+#include "DefsFormat.h"
 
 class Enemy;
 class Player;
+class SnapshotWriter;
+class SnapshotReader;
 
+// Ids into the weapon table (data/weapons.def). Only the weapons code refers to
+// by name are listed; the rest are just ids up to Defs::weaponCount()
 enum class WeaponType {
     PISTOL,
     SMG,
@@ -21,6 +28,8 @@ enum class WeaponTier {
     TIER_4 = 4
 };
 
+static const int WEAPON_TIER_COUNT = 4;
+
 struct WeaponStats {
     int baseDamage;
     float attackSpeed;        // Time between shots in seconds
@@ -45,15 +54,22 @@ public:
     Weapon(WeaponType type, WeaponTier tier = WeaponTier::TIER_1);
     virtual ~Weapon();
     
-    // Initialize weapon with renderer for texture loading
-    void initialize(SDL_Renderer* renderer);
+    // Request the weapon sprite from the asset loader
+    void initialize(AssetLoader& assets);
+    void setTexture(TextureHandle texture) { weaponTexture = texture; }
+    static const char* texturePath(WeaponType type, WeaponTier tier);
+    
+    // Firing state for snapshots; type and tier are written by the owner
+    void saveState(SnapshotWriter& out) const;
+    void loadState(SnapshotReader& in);
     
     virtual void update(float deltaTime, const Vector2& weaponPos, 
                        const Vector2& aimDirection,
-                       std::vector<std::unique_ptr<Bullet>>& bullets,
+                       World& world,
                        const Player& player);
     
-    virtual void render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vector2& weaponDirection);
+    // Records into the world pass; runs on the simulation thread (see FramePipeline.h)
+    virtual void render(RenderQueue& queue, const Vector2& weaponPos, const Vector2& weaponDirection) const;
     
     // Getters
     WeaponType getType() const { return type; }
@@ -68,24 +84,20 @@ public:
     int calculateDamage(const Player& player) const;
     
     // Melee weapon support
-    bool isMeleeWeapon() const { return type == WeaponType::MELEE_STICK; }
+    bool isMeleeWeapon() const;
     bool isAttacking() const { return muzzleFlashTimer > 0.0f; } // Reuse muzzle flash timer for melee attack duration
     float getAttackProgress() const { return muzzleFlashTimer > 0.0f ? (0.3f - muzzleFlashTimer) / 0.3f : 0.0f; } // 0.0 = start, 1.0 = fully extended
     Vector2 getWeaponTipPosition(const Vector2& weaponPos, const Vector2& direction) const;
     
 protected:
     virtual void fire(const Vector2& weaponPos, const Vector2& direction, 
-                     std::vector<std::unique_ptr<Bullet>>& bullets,
+                     World& world,
                      const Player& player);
     
-    // Initialize weapon stats based on type
-    void initializePistolStats();
-    void initializeSMGStats();
-    void initializeMeleeStickStats();
-    
     WeaponType type;
     WeaponTier tier;
     WeaponStats stats;
+    const WeaponDef* def;
     float timeSinceLastShot;
     
     // Visual/audio feedback
@@ -93,6 +105,18 @@ protected:
     Vector2 lastShotDirection;
     
     // Sprite rendering
-    SDL_Texture* weaponTexture;
-    void loadWeaponTexture(SDL_Renderer* renderer);
+    TextureHandle weaponTexture;
+};
+
+// Handles for every weapon sprite, requested once so weapons can be rebuilt
+// (restoring a snapshot) without going back to the asset loader
+class WeaponSprites {
+public:
+    void request(AssetLoader& assets);
+    TextureHandle get(WeaponType type, WeaponTier tier) const {
+        return handles[static_cast<int>(type)][static_cast<int>(tier) - 1];
+    }
+
+private:
+    TextureHandle handles[DEFS_MAX_WEAPONS][WEAPON_TIER_COUNT];
 };
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "World.h"
+#include "Snapshot.h"
+
+void Archetype::swapRemove(size_t row) {
+    std::apply([row](auto&... columns) {
+        auto removeRow = [row](auto& column) {
+            if (column.empty()) return; // Component not part of this archetype
+            column[row] = std::move(column.back());
+            column.pop_back();
+        };
+        (removeRow(columns), ...);
+    }, this->columns);
+    entities[row] = entities.back();
+    entities.pop_back();
+}
+
+void Archetype::clear() {
+    std::apply([](auto&... columns) { (columns.clear(), ...); }, this->columns);
+    entities.clear();
+}
+
+uint32_t World::archetypeFor(ComponentMask mask) {
+    // Only a handful of archetypes ever exist, so a linear scan beats hashing
+    for (size_t i = 0; i < archetypes.size(); i++) {
+        if (archetypes[i]->mask == mask) return static_cast<uint32_t>(i);
+    }
+    auto archetype = std::make_unique<Archetype>();
+    archetype->mask = mask;
+    archetypes.push_back(std::move(archetype));
+    return static_cast<uint32_t>(archetypes.size() - 1);
+}
+
+Entity World::allocate(uint32_t archetype, uint32_t row) {
+    uint32_t index;
+    if (!freeSlots.empty()) {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots.size());
+        slots.push_back({0, 0, 0, false, false});
+    }
+    Slot& slot = slots[index];
+    slot.archetype = archetype;
+    slot.row = row;
+    slot.alive = true;
+    slot.pendingDestroy = false;
+    liveCount++;
+    return {index, slot.generation};
+}
+
+bool World::isAlive(Entity entity) const {
+    if (entity.index >= slots.size()) return false;
+    const Slot& slot = slots[entity.index];
+    return slot.alive && !slot.pendingDestroy && slot.generation == entity.generation;
+}
+
+void World::destroy(Entity entity) {
+    if (!isAlive(entity)) return;
+    slots[entity.index].pendingDestroy = true;
+    pendingDestroy.push_back(entity);
+}
+
+void World::flush() {
+    for (const Entity& entity : pendingDestroy) {
+        Slot& slot = slots[entity.index];
+        Archetype& archetype = *archetypes[slot.archetype];
+
+        // The last row moves into the hole; point its slot at the new row
+        Entity moved = archetype.entities.back();
+        archetype.swapRemove(slot.row);
+        if (!(moved == entity)) {
+            slots[moved.index].row = slot.row;
+        }
+
+        slot.alive = false;
+        slot.pendingDestroy = false;
+        slot.generation++;
+        freeSlots.push_back(entity.index);
+        liveCount--;
+    }
+    pendingDestroy.clear();
+}
+
+void World::clear() {
+    for (auto& archetype : archetypes) {
+        archetype->clear();
+    }
+    freeSlots.clear();
+    for (uint32_t i = 0; i < slots.size(); i++) {
+        if (slots[i].alive) slots[i].generation++;
+        slots[i].alive = false;
+        slots[i].pendingDestroy = false;
+        freeSlots.push_back(i);
+    }
+    pendingDestroy.clear();
+    liveCount = 0;
+}
+
+size_t World::count(ComponentMask with, ComponentMask without) const {
+    size_t total = 0;
+    for (const auto& archetype : archetypes) {
+        if ((archetype->mask & with) != with || (archetype->mask & without)) continue;
+        for (const Entity& entity : archetype->entities) {
+            if (!slots[entity.index].pendingDestroy) total++;
+        }
+    }
+    return total;
+}
+
+template<typename T>
+static void saveColumn(SnapshotWriter& out, const std::vector<T>& column, const std::vector<SDL_Texture*>&) {
+    out.writeVector(column);
+}
+
+static void saveColumn(SnapshotWriter& out, const std::vector<Sprite>& column, const std::vector<SDL_Texture*>& textures) {
+    out.writeCount(column.size());
+    for (const Sprite& sprite : column) {
+        uint32_t textureId = 0;
+        for (size_t i = 0; i < textures.size(); i++) {
+            if (sprite.texture && sprite.texture == textures[i]) textureId = static_cast<uint32_t>(i + 1);
+        }
+        out.write(textureId);
+        out.write(sprite.color);
+        out.write(sprite.scale);
+        out.write(sprite.width);
+        out.write(sprite.height);
+    }
+}
+
+template<typename T>
+static void loadColumn(SnapshotReader& in, std::vector<T>& column, const std::vector<SDL_Texture*>&) {
+    in.readVector(column);
+}
+
+static void loadColumn(SnapshotReader& in, std::vector<Sprite>& column, const std::vector<SDL_Texture*>& textures) {
+    column.resize(in.readCount(1u << 20));
+    for (Sprite& sprite : column) {
+        uint32_t textureId = in.read<uint32_t>();
+        sprite.texture = textureId > 0 && textureId <= textures.size() ? textures[textureId - 1] : nullptr;
+        in.read(sprite.color);
+        in.read(sprite.scale);
+        in.read(sprite.width);
+        in.read(sprite.height);
+    }
+}
+
+void World::save(SnapshotWriter& out, const std::vector<SDL_Texture*>& textures) const {
+    out.write(static_cast<uint32_t>(archetypes.size()));
+    for (const auto& archetype : archetypes) {
+        out.write(archetype->mask);
+        out.writeVector(archetype->entities);
+        // Only the columns in the mask; the rest are empty
+        ComponentMask bit = 1;
+        std::apply([&](const auto&... columns) {
+            auto saveIfPresent = [&](const auto& column) {
+                if (archetype->mask & bit) saveColumn(out, column, textures);
+                bit <<= 1;
+            };
+            (saveIfPresent(columns), ...);
+        }, archetype->columns);
+    }
+
+    // Field by field so padding never reaches the blob
+    out.writeCount(slots.size());
+    for (const Slot& slot : slots) {
+        out.write(slot.archetype);
+        out.write(slot.row);
+        out.write(slot.generation);
+        out.write(static_cast<uint8_t>((slot.alive ? 1 : 0) | (slot.pendingDestroy ? 2 : 0)));
+    }
+    out.writeVector(freeSlots);
+    out.writeVector(pendingDestroy);
+    out.write(static_cast<uint64_t>(liveCount));
+}
+
+bool World::load(SnapshotReader& in, const std::vector<SDL_Texture*>& textures) {
+    archetypes.clear();
+    uint32_t archetypeCount = in.readCount(32 * 1024);
+    for (uint32_t a = 0; a < archetypeCount && in.ok(); a++) {
+        auto archetype = std::make_unique<Archetype>();
+        archetype->mask = in.read<ComponentMask>();
+        in.readVector(archetype->entities);
+        ComponentMask bit = 1;
+        std::apply([&](auto&... columns) {
+            auto loadIfPresent = [&](auto& column) {
+                if (archetype->mask & bit) {
+                    loadColumn(in, column, textures);
+                    if (column.size() != archetype->entities.size()) in.fail();
+                }
+                bit <<= 1;
+            };
+            (loadIfPresent(columns), ...);
+        }, archetype->columns);
+        archetypes.push_back(std::move(archetype));
+    }
+
+    slots.resize(in.readCount(1u << 24));
+    for (Slot& slot : slots) {
+        in.read(slot.archetype);
+        in.read(slot.row);
+        in.read(slot.generation);
+        uint8_t flags = in.read<uint8_t>();
+        slot.alive = (flags & 1) != 0;
+        slot.pendingDestroy = (flags & 2) != 0;
+        if (slot.alive && (slot.archetype >= archetypes.size() || slot.row >= archetypes[slot.archetype]->size())) {
+            in.fail();
+        }
+    }
+    in.readVector(freeSlots);
+    in.readVector(pendingDestroy);
+    liveCount = static_cast<size_t>(in.read<uint64_t>());
+
+    if (!in.ok()) {
+        // Never leave half a world behind
+        archetypes.clear();
+        slots.clear();
+        freeSlots.clear();
+        pendingDestroy.clear();
+        liveCount = 0;
+        return false;
+    }
+    return true;
+}
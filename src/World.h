@@ -0,0 +1,152 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "Components.h"
+
+class SnapshotWriter;
+class SnapshotReader;
+
+using ComponentMask = uint32_t;
+
+struct Entity {
+    uint32_t index;
+    uint32_t generation;
+
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+};
+
+namespace ecs_detail {
+    template<typename T, typename Tuple> struct TupleIndex;
+    template<typename T, typename... Ts> struct TupleIndex<T, std::tuple<T, Ts...>> {
+        static constexpr size_t value = 0;
+    };
+    template<typename T, typename U, typename... Ts> struct TupleIndex<T, std::tuple<U, Ts...>> {
+        static constexpr size_t value = 1 + TupleIndex<T, std::tuple<Ts...>>::value;
+    };
+
+    template<typename Tuple> struct ColumnStorage;
+    template<typename... Ts> struct ColumnStorage<std::tuple<Ts...>> {
+        using type = std::tuple<std::vector<Ts>...>;
+    };
+
+    static_assert(std::tuple_size<ComponentList>::value <= 32, "ComponentMask has one bit per component");
+}
+
+template<typename... Cs>
+constexpr ComponentMask componentMask() {
+    return (ComponentMask(0) | ... | (ComponentMask(1) << ecs_detail::TupleIndex<Cs, ComponentList>::value));
+}
+
+// All entities with exactly the same component set. Each component lives in its
+// own contiguous column, so a system touching (Transform, Velocity) streams
+// through two flat arrays. Columns for components not in the mask stay empty.
+struct Archetype {
+    ComponentMask mask;
+    std::vector<Entity> entities;
+    ecs_detail::ColumnStorage<ComponentList>::type columns;
+
+    template<typename T> std::vector<T>& column() { return std::get<std::vector<T>>(columns); }
+    size_t size() const { return entities.size(); }
+
+    void swapRemove(size_t row);
+    void clear();
+};
+
+// Archetype-based entity store for everything transient in the world
+// (bullets, pickups, bombs, particles, spawn telegraphs).
+//
+// Destruction is deferred: destroy() hides the entity from each() immediately
+// and flush() reclaims the rows, so systems can destroy while iterating.
+// Creating entities from inside each() is fine too; rows added during the loop
+// are picked up on the next pass, but a new entity of the archetype being
+// walked may reallocate its columns, so don't touch the current row's
+// component references after creating one.
+class World {
+public:
+    template<typename... Cs>
+    Entity create(Cs... components) {
+        uint32_t archetypeIndex = archetypeFor(componentMask<Cs...>());
+        Archetype& archetype = *archetypes[archetypeIndex];
+        Entity entity = allocate(archetypeIndex, static_cast<uint32_t>(archetype.size()));
+        (archetype.column<Cs>().push_back(std::move(components)), ...);
+        archetype.entities.push_back(entity);
+        return entity;
+    }
+
+    // Makes room for `extra` more entities with exactly Cs, so a burst of
+    // create() calls (a bullet volley) grows each column at most once
+    template<typename... Cs>
+    void reserve(size_t extra) {
+        Archetype& archetype = *archetypes[archetypeFor(componentMask<Cs...>())];
+        size_t needed = archetype.size() + extra;
+        if (needed <= archetype.entities.capacity()) return;
+        size_t target = std::max(needed, archetype.entities.capacity() * 2);
+        (archetype.column<Cs>().reserve(target), ...);
+        archetype.entities.reserve(target);
+    }
+
+    void destroy(Entity entity);
+    void flush();
+    void clear();
+    bool isAlive(Entity entity) const;
+
+    template<typename T>
+    T* get(Entity entity) {
+        if (!isAlive(entity)) return nullptr;
+        const Slot& slot = slots[entity.index];
+        Archetype& archetype = *archetypes[slot.archetype];
+        if (!(archetype.mask & componentMask<T>())) return nullptr;
+        return &archetype.column<T>()[slot.row];
+    }
+
+    // Calls fn(entity, Cs&...) for every live entity that has all of Cs (and
+    // everything in `with`) and none of `without`, archetype by archetype.
+    template<typename... Cs, typename Fn>
+    void each(Fn&& fn, ComponentMask with = 0, ComponentMask without = 0) {
+        const ComponentMask required = componentMask<Cs...>() | with;
+        for (size_t a = 0; a < archetypes.size(); a++) {
+            Archetype& archetype = *archetypes[a];
+            if ((archetype.mask & required) != required || (archetype.mask & without)) continue;
+            const size_t rows = archetype.size();
+            for (size_t row = 0; row < rows; row++) {
+                Entity entity = archetype.entities[row];
+                if (slots[entity.index].pendingDestroy) continue;
+                fn(entity, archetype.column<Cs>()[row]...);
+            }
+        }
+    }
+
+    // Live entities with all of `with` and none of `without`
+    size_t count(ComponentMask with, ComponentMask without = 0) const;
+    size_t size() const { return liveCount; }
+
+    // Snapshots (Snapshot.h) keep entity ids stable. Sprite textures are stored as
+    // 1-based indices into `textures` (0 = none), since the pointers only mean
+    // something in this process.
+    void save(SnapshotWriter& out, const std::vector<SDL_Texture*>& textures) const;
+    bool load(SnapshotReader& in, const std::vector<SDL_Texture*>& textures);
+
+private:
+    struct Slot {
+        uint32_t archetype;
+        uint32_t row;
+        uint32_t generation;
+        bool alive;
+        bool pendingDestroy;
+    };
+
+    uint32_t archetypeFor(ComponentMask mask);
+    Entity allocate(uint32_t archetype, uint32_t row);
+
+    // unique_ptr keeps an Archetype in place while each() is walking it and a new archetype is added
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    std::vector<Entity> pendingDestroy;
+    size_t liveCount = 0;
+};
@@ -1,15 +1,144 @@
 #include "Game.h"
-#include <iostream>
+#include "Log.h"
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+// Parse "--name=value" style flags into GameOptions; unknown flags are reported and ignored
+static GameOptions parseOptions(int argc, char* args[]) {
+    GameOptions options;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = args[i];
+        if (std::strncmp(arg, "--render-scale=", 15) == 0) {
+            options.renderScale = static_cast<float>(std::atof(arg + 15));
+        } else if (std::strcmp(arg, "--dynamic-resolution") == 0) {
+            options.dynamicResolution = true;
+        } else if (std::strncmp(arg, "--frame-budget-ms=", 18) == 0) {
+            options.frameBudgetMs = static_cast<float>(std::atof(arg + 18));
+        } else if (std::strncmp(arg, "--asset-pack=", 13) == 0) {
+            options.assetPack = arg + 13;
+        } else if (std::strcmp(arg, "--startup-benchmark") == 0) {
+            options.startupBenchmark = true;
+        } else if (std::strncmp(arg, "--startup-budget-ms=", 20) == 0) {
+            options.startupBudgetMs = static_cast<float>(std::atof(arg + 20));
+        } else if (std::strncmp(arg, "--aim=", 6) == 0) {
+            const char* mode = arg + 6;
+            if (std::strcmp(mode, "mouse") == 0) {
+                options.aimMode = AimMode::MOUSE;
+            } else if (std::strcmp(mode, "nearest") == 0) {
+                options.aimMode = AimMode::NEAREST;
+            } else if (std::strcmp(mode, "spread") == 0) {
+                options.aimMode = AimMode::SPREAD;
+            } else {
+                LOG_WARN(CORE, "Unknown aim mode: %s", mode);
+            }
+        } else if (std::strcmp(arg, "--autopilot") == 0) {
+            options.autopilot = true;
+        } else if (std::strncmp(arg, "--autopilot-waves=", 18) == 0) {
+            options.autopilotWaves = std::max(1, std::atoi(arg + 18));
+        } else if (std::strncmp(arg, "--time-scale=", 13) == 0) {
+            options.timeScale = std::max(1, std::atoi(arg + 13));
+        } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+            options.seed = std::strtoull(arg + 7, nullptr, 10);
+        } else if (std::strncmp(arg, "--checkpoint-wave=", 18) == 0) {
+            options.checkpointWave = std::max(0, std::atoi(arg + 18));
+        } else if (std::strncmp(arg, "--load-checkpoint=", 18) == 0) {
+            options.loadCheckpoint = arg + 18;
+        } else if (std::strncmp(arg, "--rewind-budget-mb=", 19) == 0) {
+            options.rewindBudgetMb = std::max(0, std::atoi(arg + 19));
+        } else if (std::strncmp(arg, "--pacing=", 9) == 0) {
+            const char* pacing = arg + 9;
+            if (std::strcmp(pacing, "vsync") == 0) {
+                options.pacing = PacingMode::VSYNC;
+            } else if (std::strcmp(pacing, "target") == 0) {
+                options.pacing = PacingMode::TARGET_FPS;
+            } else if (std::strcmp(pacing, "uncapped") == 0) {
+                options.pacing = PacingMode::UNCAPPED;
+            } else {
+                LOG_WARN(CORE, "Unknown pacing mode: %s", pacing);
+            }
+        } else if (std::strncmp(arg, "--target-fps=", 13) == 0) {
+            options.targetFps = std::max(1, std::atoi(arg + 13));
+        } else if (std::strncmp(arg, "--quality=", 10) == 0) {
+            const char* quality = arg + 10;
+            if (std::strcmp(quality, "auto") == 0) {
+                options.qualityTier = -1;
+            } else if (quality[0] >= '0' && quality[0] <= '9') {
+                options.qualityTier = std::min(std::atoi(quality), QualityGovernor::TIER_COUNT - 1);
+            } else {
+                LOG_WARN(CORE, "Unknown quality: %s", quality);
+            }
+        } else if (std::strncmp(arg, "--particle-budget=", 18) == 0) {
+            options.particleBudget = std::max(0, std::atoi(arg + 18));
+        } else if (std::strcmp(arg, "--single-thread") == 0) {
+            options.simulationThread = false;
+        } else if (std::strncmp(arg, "--renderer=", 11) == 0) {
+            const char* backend = arg + 11;
+            if (std::strcmp(backend, "sdl") == 0) {
+                options.renderBackend = RenderBackendType::SDL;
+            } else if (std::strcmp(backend, "software") == 0) {
+                options.renderBackend = RenderBackendType::SOFTWARE;
+            } else if (std::strcmp(backend, "null") == 0) {
+                options.renderBackend = RenderBackendType::NONE;
+            } else {
+                LOG_WARN(CORE, "Unknown renderer: %s", backend);
+            }
+        } else if (std::strncmp(arg, "--capture-draws=", 16) == 0) {
+            options.captureDrawsPath = arg + 16;
+        } else if (std::strncmp(arg, "--save-frames=", 14) == 0) {
+            options.saveFramesPath = arg + 14;
+        } else if (std::strncmp(arg, "--save-frames-every=", 20) == 0) {
+            options.saveFramesInterval = std::max(1, std::atoi(arg + 20));
+        } else if (std::strncmp(arg, "--log-level=", 12) == 0) {
+            LogLevel level;
+            if (Log::parseLevel(arg + 12, level)) {
+                Log::setLevel(level);
+            } else {
+                LOG_WARN(CORE, "Unknown log level: %s", arg + 12);
+            }
+        } else if (std::strncmp(arg, "--log-categories=", 17) == 0) {
+            // Comma-separated list; only these categories are printed
+            Log::setAllCategoriesEnabled(false);
+            std::string list = arg + 17;
+            size_t begin = 0;
+            while (begin <= list.size()) {
+                size_t end = list.find(',', begin);
+                if (end == std::string::npos) end = list.size();
+                std::string name = list.substr(begin, end - begin);
+                LogCategory category;
+                if (Log::parseCategory(name.c_str(), category)) {
+                    Log::setCategoryEnabled(category, true);
+                } else if (!name.empty()) {
+                    LOG_WARN(CORE, "Unknown log category: %s", name.c_str());
+                }
+                begin = end + 1;
+            }
+        } else {
+            LOG_WARN(CORE, "Ignoring unknown option: %s", arg);
+        }
+    }
+    return options;
+}
 
 int main(int argc, char* args[]) {
-    Game game;
-    
-    if (!game.init()) {
-        std::cout << "Failed to initialize game!" << std::endl;
-        return -1;
+    Log::start();
+
+    int exitCode;
+    {
+        Game game(parseOptions(argc, args));
+
+        if (!game.init()) {
+            LOG_ERROR(CORE, "Failed to initialize game!");
+            Log::shutdown();
+            return -1;
+        }
+
+        game.run();
+        exitCode = game.getExitCode();
     }
-    
-    game.run();
-    
-    return 0;
-}
\ No newline at end of file
+
+    // Game teardown may still log; drain after it
+    Log::shutdown();
+    return exitCode;
+}
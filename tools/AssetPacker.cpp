@@ -0,0 +1,246 @@
+// Offline asset packer: decodes every image once and writes a single .pak
+// (see src/PakFormat.h) that the game memory-maps at startup.
+//
+//   asset_packer [--format=ARGB8888|ABGR8888] [--straight=<prefix>]... <output.pak> <dir-or-file>...
+//
+// Run from the directory the game runs in, so entry names match the paths the
+// game requests (e.g. "assets/enemies/slime.png").
+
+#define SDL_MAIN_HANDLED
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "PakFormat.h"
+
+namespace fs = std::filesystem;
+
+struct PackInput {
+    std::string name;
+    fs::path file;
+    PakEntryType type;
+};
+
+static bool hasExtension(const fs::path& path, std::initializer_list<const char*> extensions) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    for (const char* candidate : extensions) {
+        if (ext == candidate) return true;
+    }
+    return false;
+}
+
+static void addInput(std::vector<PackInput>& inputs, const fs::path& file) {
+    std::string name = file.lexically_normal().generic_string();
+    if (name.rfind("./", 0) == 0) name = name.substr(2);
+
+    if (hasExtension(file, {".png", ".bmp", ".jpg", ".jpeg"})) {
+        inputs.push_back({name, file, PAK_ENTRY_IMAGE});
+    } else if (hasExtension(file, {".ttf", ".otf"})) {
+        inputs.push_back({name, file, PAK_ENTRY_FONT});
+    }
+}
+
+// Color channels sit in the low three bytes and alpha in the top byte for both supported formats
+static void premultiply(uint32_t* pixels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t p = pixels[i];
+        uint32_t a = p >> 24;
+        if (a == 255) continue;
+        uint32_t c0 = ((p & 0xFF) * a + 127) / 255;
+        uint32_t c1 = (((p >> 8) & 0xFF) * a + 127) / 255;
+        uint32_t c2 = (((p >> 16) & 0xFF) * a + 127) / 255;
+        pixels[i] = (a << 24) | (c2 << 16) | (c1 << 8) | c0;
+    }
+}
+
+static bool readFile(const fs::path& file, std::vector<uint8_t>& out) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static bool decodeImage(const PackInput& input, Uint32 format, bool premultiplied,
+                        PakEntry& entry, std::vector<uint8_t>& out) {
+    SDL_Surface* loaded = IMG_Load(input.file.string().c_str());
+    if (!loaded) {
+        std::cout << "  skipping " << input.name << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(loaded, format, 0);
+    SDL_FreeSurface(loaded);
+    if (!converted) {
+        std::cout << "  skipping " << input.name << ": " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    // Store tightly packed rows so the runtime can hand the block to SDL_UpdateTexture as-is
+    const int rowBytes = converted->w * 4;
+    out.resize(static_cast<size_t>(rowBytes) * converted->h);
+    SDL_LockSurface(converted);
+    for (int y = 0; y < converted->h; y++) {
+        std::memcpy(out.data() + static_cast<size_t>(y) * rowBytes,
+                    static_cast<const uint8_t*>(converted->pixels) + static_cast<size_t>(y) * converted->pitch,
+                    rowBytes);
+    }
+    SDL_UnlockSurface(converted);
+
+    if (premultiplied) {
+        premultiply(reinterpret_cast<uint32_t*>(out.data()), out.size() / 4);
+    }
+
+    entry.width = static_cast<uint32_t>(converted->w);
+    entry.height = static_cast<uint32_t>(converted->h);
+    entry.pitch = static_cast<uint32_t>(rowBytes);
+    entry.pixelFormat = format;
+    entry.flags = premultiplied ? static_cast<uint32_t>(PAK_FLAG_PREMULTIPLIED) : 0u;
+    SDL_FreeSurface(converted);
+    return true;
+}
+
+static void printUsage() {
+    std::cout << "Usage: asset_packer [--format=ARGB8888|ABGR8888] [--straight=<prefix>]... "
+                 "<output.pak> <dir-or-file>..." << std::endl;
+    std::cout << "  --format    pixel format to store; match the renderer's preferred format (default ARGB8888)" << std::endl;
+    std::cout << "  --straight  keep straight alpha for entries under this prefix, e.g. textures drawn with alpha mod" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    Uint32 format = SDL_PIXELFORMAT_ARGB8888;
+    std::vector<std::string> straightPrefixes;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--format=ARGB8888") == 0) {
+            format = SDL_PIXELFORMAT_ARGB8888;
+        } else if (std::strcmp(arg, "--format=ABGR8888") == 0) {
+            format = SDL_PIXELFORMAT_ABGR8888;
+        } else if (std::strncmp(arg, "--straight=", 11) == 0) {
+            straightPrefixes.push_back(arg + 11);
+        } else if (std::strncmp(arg, "--", 2) == 0) {
+            printUsage();
+            return 1;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+    if (positional.size() < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<PackInput> inputs;
+    for (size_t i = 1; i < positional.size(); i++) {
+        fs::path root(positional[i]);
+        std::error_code ec;
+        if (fs::is_directory(root, ec)) {
+            for (const auto& item : fs::recursive_directory_iterator(root, ec)) {
+                if (item.is_regular_file()) addInput(inputs, item.path());
+            }
+        } else if (fs::is_regular_file(root, ec)) {
+            addInput(inputs, root);
+        } else {
+            std::cout << "Input not found: " << positional[i] << std::endl;
+            return 1;
+        }
+    }
+    // Deterministic output regardless of directory iteration order
+    std::sort(inputs.begin(), inputs.end(), [](const PackInput& a, const PackInput& b) { return a.name < b.name; });
+    inputs.erase(std::unique(inputs.begin(), inputs.end(),
+                             [](const PackInput& a, const PackInput& b) { return a.name == b.name; }),
+                 inputs.end());
+
+    IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG);
+
+    std::ofstream out(positional[0], std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cout << "Cannot write " << positional[0] << std::endl;
+        return 1;
+    }
+
+    PakHeader header = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t offset = sizeof(header);
+
+    std::vector<PakEntry> toc;
+    std::string names;
+    std::vector<uint8_t> block;
+    uint64_t imageBytes = 0;
+
+    for (const PackInput& input : inputs) {
+        PakEntry entry = {};
+        entry.type = input.type;
+
+        if (input.type == PAK_ENTRY_IMAGE) {
+            bool straight = std::any_of(straightPrefixes.begin(), straightPrefixes.end(),
+                [&](const std::string& prefix) { return input.name.rfind(prefix, 0) == 0; });
+            if (!decodeImage(input, format, !straight, entry, block)) continue;
+            imageBytes += block.size();
+        } else if (!readFile(input.file, block)) {
+            std::cout << "  skipping " << input.name << ": unreadable" << std::endl;
+            continue;
+        }
+
+        // Align every block so mapped pixel rows start on a 16-byte boundary
+        uint64_t padding = (PAK_DATA_ALIGNMENT - offset % PAK_DATA_ALIGNMENT) % PAK_DATA_ALIGNMENT;
+        static const char zeros[PAK_DATA_ALIGNMENT] = {};
+        out.write(zeros, static_cast<std::streamsize>(padding));
+        offset += padding;
+
+        entry.dataOffset = offset;
+        entry.dataSize = block.size();
+        entry.nameOffset = static_cast<uint32_t>(names.size());
+        entry.nameLength = static_cast<uint32_t>(input.name.size());
+        names += input.name;
+
+        out.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
+        offset += block.size();
+        toc.push_back(entry);
+
+        std::cout << "  " << input.name;
+        if (entry.type == PAK_ENTRY_IMAGE) {
+            std::cout << " " << entry.width << "x" << entry.height
+                      << ((entry.flags & PAK_FLAG_PREMULTIPLIED) ? " premultiplied" : " straight");
+        }
+        std::cout << std::endl;
+    }
+
+    uint64_t padding = (PAK_DATA_ALIGNMENT - offset % PAK_DATA_ALIGNMENT) % PAK_DATA_ALIGNMENT;
+    static const char zeros[PAK_DATA_ALIGNMENT] = {};
+    out.write(zeros, static_cast<std::streamsize>(padding));
+    offset += padding;
+
+    header.magic = PAK_MAGIC;
+    header.version = PAK_VERSION;
+    header.entryCount = static_cast<uint32_t>(toc.size());
+    header.tocOffset = offset;
+    out.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size() * sizeof(PakEntry)));
+    offset += toc.size() * sizeof(PakEntry);
+
+    header.namesOffset = offset;
+    header.namesSize = names.size();
+    out.write(names.data(), static_cast<std::streamsize>(names.size()));
+    offset += names.size();
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    IMG_Quit();
+
+    if (!out) {
+        std::cout << "Failed while writing " << positional[0] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << positional[0] << ": " << toc.size() << " entries, "
+              << imageBytes / 1024 << " KB of pixels, " << offset / 1024 << " KB total" << std::endl;
+    return 0;
+}
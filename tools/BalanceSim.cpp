@@ -0,0 +1,622 @@
+// Monte Carlo balance simulator: plays thousands of seeded runs of the wave
+// economy across all cores and writes a compact results file with the
+// distributions that matter when tuning (materials per wave, the wave runs die
+// on, boss kill times).
+//
+//   balance_sim [--runs=N] [--waves=N] [--seed=N] [--threads=N] [--skill=0..1]
+//               [--policy=greedy|random|saver|none] [--out=balance_results.tsv]
+//               [--defs=data/defs.bin]
+//
+// A run is a headless model of a session, not the SDL game loop. Wave pacing,
+// drops, experience, prices and shop tier gating come from src/Balance.cpp,
+// weapon/enemy stats from the compiled data/*.def table and boss HP from
+// src/BossDefinitions.cpp, so a tuning change there shows up here without
+// editing the tool. Movement and aiming are
+// abstracted into per-second hit rates scaled by --skill.
+//
+// Run i is seeded from (seed, i) alone, so results do not depend on the thread count.
+
+#define SDL_MAIN_HANDLED // Game headers pull in SDL.h; this tool has a plain main
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Balance.h"
+#include "BossEnemy.h"
+#include "Definitions.h"
+#include "Item.h"
+#include "Player.h"
+
+namespace {
+
+enum class ShopPolicy {
+    GREEDY,  // Best affordable weapon while slots are free, then healing
+    RANDOM,  // Each affordable offer with 50% chance, random order
+    SAVER,   // Only tier 2+ weapons, keeps a reserve for later waves
+    NONE
+};
+
+struct SimOptions {
+    int runs = 10000;
+    int waves = 20;
+    uint32_t seed = 1;
+    int threads = 0;          // 0 = hardware concurrency
+    float skill = 0.7f;       // 0 = stands still, 1 = never gets hit
+    ShopPolicy policy = ShopPolicy::GREEDY;
+    std::string out = "balance_results.tsv";
+    std::string defs = Defs::DEFAULT_PATH;
+};
+
+// How a player of a given skill translates into hit rates. Rough fits from
+// watching playtests; only relative changes between tuning passes are meaningful.
+struct SkillModel {
+    float rangedAccuracy;      // Ranged shot kills its target
+    float meleeReachPerEnemy;  // Chance per nearby enemy that a swing connects
+    float contactsPerEnemy;    // Enemy body hits per enemy per second
+    float bulletHitChance;     // Enemy bullet connects
+    float bossContactsPerSec;  // Boss overlaps per second
+    float bossBulletHitsPerSec;
+
+    explicit SkillModel(float skill) {
+        float miss = 1.0f - std::clamp(skill, 0.0f, 1.0f);
+        rangedAccuracy = 0.45f + 0.5f * (1.0f - miss);
+        meleeReachPerEnemy = 0.06f + 0.06f * (1.0f - miss);
+        contactsPerEnemy = 0.12f * miss;
+        bulletHitChance = 0.25f * miss;
+        bossContactsPerSec = 0.15f * miss;
+        bossBulletHitsPerSec = 1.2f * miss;
+    }
+};
+
+const float STEP = 0.05f;          // Simulation step, seconds
+const float BOSS_CONTACT_SECONDS = 0.15f; // Boss deals damage every frame while overlapping
+const float FRAMES_PER_SECOND = 60.0f;
+const int MAX_WEAPONS = 6;
+const int MAX_ITEMS = 6;
+const int SHOP_OFFERS = 4;
+
+struct SimWeapon {
+    WeaponType type;
+    WeaponStats stats;
+    float cooldown;
+
+    bool melee() const { return (Defs::weapon(type).flags & DEFS_WEAPON_MELEE) != 0; }
+    int pellets() const { return std::max(1, static_cast<int>(Defs::weapon(type).pellets)); }
+};
+
+struct SimEnemy {
+    EnemyType type;
+    float activateIn;  // Spawn telegraph still running
+    float fireTimer;
+    bool dead;
+
+    bool active() const { return !dead && activateIn <= 0.0f; }
+};
+
+struct Offer {
+    bool weapon;
+    WeaponType weaponType;
+    WeaponTier tier;
+    ItemType itemType;
+    int power;
+    int price;
+};
+
+std::mt19937 makeRng(uint32_t seed, int run) {
+    std::seed_seq sequence{seed, static_cast<uint32_t>(run)};
+    return std::mt19937(sequence);
+}
+
+struct RunResult {
+    int diedOnWave = 0;               // 0 = survived every wave
+    std::vector<int> materials;       // Materials at the end of each wave, -1 once dead
+    std::vector<float> bossKillTime;  // Seconds per wave, -1 = not a boss wave / not killed
+    int finalLevel = 1;
+};
+
+class Run {
+public:
+    Run(const SimOptions& options, int index)
+        : options(options)
+        , skill(options.skill)
+        , rng(makeRng(options.seed, index))
+    {
+        PlayerStats defaults;
+        maxHealth = defaults.maxHealth;
+        health = maxHealth;
+        armor = defaults.armor;
+        dodge = defaults.dodgeChance;
+        damage = defaults.damage;
+        materials = defaults.materials;
+        // Player's starting loadout
+        addWeapon(WeaponType::MELEE_STICK, WeaponTier::TIER_1);
+        addWeapon(WeaponType::PISTOL, WeaponTier::TIER_1);
+    }
+
+    RunResult play() {
+        RunResult result;
+        result.materials.assign(options.waves, -1);
+        result.bossKillTime.assign(options.waves, -1.0f);
+
+        float duration = Balance::FIRST_WAVE_DURATION;
+        for (int wave = 1; wave <= options.waves; wave++) {
+            bool alive = Balance::isBossWave(wave) ? playBossWave(wave, duration, result)
+                                                   : playWave(wave, duration);
+            if (!alive) {
+                result.diedOnWave = wave;
+                break;
+            }
+            result.materials[wave - 1] = materials;
+            duration = Balance::nextWaveDuration(duration);
+            if (wave < options.waves) {
+                // The shop opens with the next wave's number
+                shop(wave + 1);
+            }
+        }
+        result.finalLevel = level;
+        return result;
+    }
+
+private:
+    const SimOptions& options;
+    SkillModel skill;
+    std::mt19937 rng;
+
+    int maxHealth, health, armor, damage, materials;
+    float dodge;
+    int level = 1;
+    int experience = 0;
+    std::vector<SimWeapon> weapons;
+    std::vector<Offer> items;  // Owned consumables
+    std::vector<SimEnemy> enemies;
+
+    float roll() { return std::uniform_real_distribution<float>(0.0f, 1.0f)(rng); }
+
+    void addWeapon(WeaponType type, WeaponTier tier) {
+        if (static_cast<int>(weapons.size()) >= MAX_WEAPONS) return;
+        weapons.push_back({type, Balance::weaponStats(type, tier), 0.0f});
+    }
+
+    void gainExperience(int amount) {
+        experience += amount;
+        while (experience >= Balance::experienceForLevel(level + 1)) {
+            // Mirrors Player::levelUp
+            level++;
+            maxHealth += 1;
+            if (level == 2) addWeapon(WeaponType::MELEE_STICK, WeaponTier::TIER_1);
+            else if (level == 3) addWeapon(WeaponType::SMG, WeaponTier::TIER_1);
+            else if (level == 5) addWeapon(WeaponType::PISTOL, WeaponTier::TIER_2);
+        }
+    }
+
+    void takeDamage(int amount) {
+        if (dodge > 0 && roll() < dodge / 100.0f) return;
+        health = std::max(0, health - Balance::damageAfterArmor(amount, armor));
+    }
+
+    // Every dead enemy rolls the regular drop (Game::update's removeDead)
+    void onEnemyDeath(int wave) {
+        if (roll() < Balance::materialDropChance(wave)) {
+            materials += Balance::materialValue(wave);
+            gainExperience(Balance::materialExperience(wave));
+        }
+    }
+
+    void useItems(bool bossWave, int wave, int& bossHealth) {
+        for (size_t i = 0; i < items.size(); i++) {
+            const Offer& item = items[i];
+            bool used = false;
+            if (item.itemType == ItemType::HEALING_BOX && health < maxHealth * 2 / 5) {
+                health = std::min(maxHealth, health + item.power);
+                used = true;
+            } else if (item.itemType == ItemType::MASS_BOMB) {
+                if (bossWave) {
+                    // Bombs do 20x damage to bosses; about half land
+                    if (roll() < 0.5f) bossHealth -= item.power * 20;
+                    used = true;
+                } else if (countActive() >= 8) {
+                    for (SimEnemy& enemy : enemies) {
+                        if (enemy.active() && roll() < 0.5f) enemy.dead = true;
+                    }
+                    removeDead(wave);
+                    used = true;
+                }
+            }
+            if (used) {
+                items.erase(items.begin() + i);
+                return; // One item per step, like a key press
+            }
+        }
+    }
+
+    int countActive() const {
+        int active = 0;
+        for (const SimEnemy& enemy : enemies) {
+            if (enemy.active()) active++;
+        }
+        return active;
+    }
+
+    void removeDead(int wave) {
+        size_t kept = 0;
+        for (size_t i = 0; i < enemies.size(); i++) {
+            if (enemies[i].dead) {
+                onEnemyDeath(wave);
+            } else {
+                enemies[kept++] = enemies[i];
+            }
+        }
+        enemies.resize(kept);
+    }
+
+    // Bullets and melee hits kill regular enemies outright (Game::checkCollisions)
+    void killActive(int count) {
+        for (SimEnemy& enemy : enemies) {
+            if (count <= 0) break;
+            if (enemy.active()) {
+                enemy.dead = true;
+                count--;
+            }
+        }
+    }
+
+    bool playWave(int wave, float duration) {
+        enemies.clear();
+        float spawnTimer = 0.0f;
+        int unused = 0;
+        for (SimWeapon& weapon : weapons) weapon.cooldown = 0.0f;
+
+        for (float t = 0.0f; t < duration; t += STEP) {
+            spawnTimer += STEP;
+            float interval = Balance::spawnInterval(wave);
+            while (spawnTimer >= interval) {
+                spawnTimer -= interval;
+                EnemySpawnType type = Balance::spawnType(wave, roll());
+                enemies.push_back({static_cast<EnemyType>(type), 2.0f, 0.0f, false}); // Game::spawnTelegraphSeconds
+            }
+            for (SimEnemy& enemy : enemies) {
+                if (enemy.activateIn > 0.0f) enemy.activateIn -= STEP;
+            }
+
+            int active = countActive();
+            for (SimWeapon& weapon : weapons) {
+                weapon.cooldown -= STEP;
+                if (weapon.cooldown > 0.0f) continue;
+                weapon.cooldown += weapon.stats.attackSpeed;
+                if (active == 0) continue;
+                if (weapon.melee()) {
+                    float reach = 1.0f - std::pow(1.0f - skill.meleeReachPerEnemy, static_cast<float>(active));
+                    if (roll() < reach) {
+                        int kills = roll() < 0.25f ? 2 : 1;
+                        for (int k = 0; k < kills; k++) {
+                            // Melee kills also drop an orb and an extra material (Game::checkMeleeAttacks)
+                            gainExperience(1);
+                            if (roll() < Balance::materialDropChance(wave)) {
+                                materials += 1;
+                                gainExperience(1);
+                            }
+                        }
+                        killActive(kills);
+                    }
+                } else {
+                    // Each pellet is its own shot
+                    for (int pellet = 0; pellet < weapon.pellets() && countActive() > 0; pellet++) {
+                        if (roll() < skill.rangedAccuracy) killActive(1);
+                    }
+                }
+                active = countActive();
+            }
+
+            // Enemy attacks
+            for (SimEnemy& enemy : enemies) {
+                if (!enemy.active()) continue;
+                const EnemyTypeInfo& info = getEnemyTypeInfo(enemy.type);
+                if (roll() < skill.contactsPerEnemy * STEP) {
+                    // Contact hurts the player and kills the enemy
+                    takeDamage(info.damage);
+                    enemy.dead = true;
+                    continue;
+                }
+                if (info.fireCooldown > 0.0f) {
+                    enemy.fireTimer += STEP;
+                    if (enemy.fireTimer >= info.fireCooldown) {
+                        enemy.fireTimer = 0.0f;
+                        if (enemy.type == EnemyType::PEBBLIN) {
+                            for (int shot = 0; shot < 3; shot++) {
+                                if (roll() < skill.bulletHitChance / 3.0f) takeDamage(Balance::PEBBLIN_BULLET_DAMAGE);
+                            }
+                        } else if (roll() < skill.bulletHitChance) {
+                            takeDamage(Balance::SLIME_BULLET_DAMAGE);
+                        }
+                    }
+                }
+            }
+            removeDead(wave);
+            useItems(false, wave, unused);
+            if (health <= 0) return false;
+        }
+        return true;
+    }
+
+    bool playBossWave(int wave, float duration, RunResult& result) {
+        enemies.clear();
+        BossConfig config = makeBossConfig(wave);
+        const EnemyTypeInfo& base = getEnemyTypeInfo(EnemyType::BASE);
+        int bossHealth = static_cast<int>(base.health * config.hpMul);
+        int bossDamage = static_cast<int>(base.damage * config.dmgMul);
+        for (SimWeapon& weapon : weapons) weapon.cooldown = 0.0f;
+
+        for (float t = 0.0f; t < duration; t += STEP) {
+            for (SimWeapon& weapon : weapons) {
+                weapon.cooldown -= STEP;
+                if (weapon.cooldown > 0.0f) continue;
+                weapon.cooldown += weapon.stats.attackSpeed;
+                // Melee only hits regular enemies
+                if (weapon.melee()) continue;
+                for (int pellet = 0; pellet < weapon.pellets(); pellet++) {
+                    if (roll() < skill.rangedAccuracy) {
+                        int hit = Balance::weaponHitDamage(weapon.stats, damage);
+                        if (roll() < weapon.stats.critChance) hit = static_cast<int>(hit * weapon.stats.critMultiplier);
+                        bossHealth -= hit;
+                    }
+                }
+            }
+            if (roll() < skill.bossContactsPerSec * STEP) {
+                int frames = static_cast<int>(BOSS_CONTACT_SECONDS * FRAMES_PER_SECOND);
+                for (int f = 0; f < frames; f++) takeDamage(bossDamage);
+            }
+            if (roll() < skill.bossBulletHitsPerSec * STEP) {
+                takeDamage(bossDamage);
+            }
+            useItems(true, wave, bossHealth);
+
+            if (health <= 0) return false;
+            if (bossHealth <= 0) {
+                result.bossKillTime[wave - 1] = t;
+                // Reward drops are collected (Game::endBossWave)
+                for (int i = 0; i < Balance::BOSS_REWARD_ORBS; i++) gainExperience(1);
+                for (int i = 0; i < Balance::bossRewardDrops(wave); i++) {
+                    materials += Balance::bossRewardMaterialValue(wave);
+                    gainExperience(Balance::bossRewardExperience(wave));
+                }
+                return true;
+            }
+        }
+        materials += Balance::bossConsolationMaterials(wave);
+        return true;
+    }
+
+    Offer makeOffer(int wave) {
+        // Same rolls as Shop::generateItems
+        Offer offer{};
+        if (roll() < Balance::SHOP_WEAPON_CHANCE) {
+            offer.weapon = true;
+            WeaponType shopWeapons[DEFS_MAX_WEAPONS];
+            int shopWeaponCount = 0;
+            for (int type = 0; type < Defs::weaponCount(); type++) {
+                if (Defs::weapon(static_cast<WeaponType>(type)).flags & DEFS_WEAPON_SHOP) {
+                    shopWeapons[shopWeaponCount++] = static_cast<WeaponType>(type);
+                }
+            }
+            offer.weaponType = shopWeapons[std::uniform_int_distribution<int>(0, shopWeaponCount - 1)(rng)];
+            offer.tier = static_cast<WeaponTier>(std::uniform_int_distribution<int>(1, Balance::shopTierCount(wave))(rng));
+            offer.price = Balance::weaponPrice(offer.tier, wave);
+        } else {
+            offer.weapon = false;
+            offer.itemType = static_cast<ItemType>(std::uniform_int_distribution<int>(0, ITEM_TYPE_COUNT - 1)(rng));
+            offer.power = Balance::shopItemPower(wave);
+            offer.price = Balance::itemPrice(offer.power, wave);
+        }
+        return offer;
+    }
+
+    bool canHold(const Offer& offer) const {
+        return offer.weapon ? static_cast<int>(weapons.size()) < MAX_WEAPONS
+                            : static_cast<int>(items.size()) < MAX_ITEMS;
+    }
+
+    void buy(const Offer& offer) {
+        materials -= offer.price;
+        if (offer.weapon) {
+            addWeapon(offer.weaponType, offer.tier);
+        } else {
+            items.push_back(offer);
+        }
+    }
+
+    void shop(int wave) {
+        Offer offers[SHOP_OFFERS];
+        for (Offer& offer : offers) offer = makeOffer(wave);
+        bool bought[SHOP_OFFERS] = {};
+
+        switch (options.policy) {
+            case ShopPolicy::GREEDY:
+            case ShopPolicy::SAVER: {
+                const int reserve = options.policy == ShopPolicy::SAVER ? 30 : 0;
+                for (;;) {
+                    int best = -1;
+                    for (int i = 0; i < SHOP_OFFERS; i++) {
+                        const Offer& offer = offers[i];
+                        if (bought[i] || !canHold(offer) || offer.price > materials - reserve) continue;
+                        if (options.policy == ShopPolicy::SAVER && offer.weapon && offer.tier == WeaponTier::TIER_1) continue;
+                        // Weapons first, higher tier first; healing only when it could matter
+                        if (!offer.weapon && offer.itemType == ItemType::HEALING_BOX && health > maxHealth / 2) continue;
+                        auto rank = [](const Offer& o) { return o.weapon ? 10 + static_cast<int>(o.tier) : 0; };
+                        if (best < 0 || rank(offer) > rank(offers[best])) best = i;
+                    }
+                    if (best < 0) break;
+                    buy(offers[best]);
+                    bought[best] = true;
+                }
+                break;
+            }
+            case ShopPolicy::RANDOM: {
+                int order[SHOP_OFFERS] = {0, 1, 2, 3};
+                std::shuffle(order, order + SHOP_OFFERS, rng);
+                for (int i : order) {
+                    if (canHold(offers[i]) && offers[i].price <= materials && roll() < 0.5f) buy(offers[i]);
+                }
+                break;
+            }
+            case ShopPolicy::NONE:
+                break;
+        }
+    }
+};
+
+template <typename T>
+T percentile(std::vector<T>& values, float p) {
+    if (values.empty()) return T();
+    size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5f);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+bool parsePolicy(const char* name, ShopPolicy& policy) {
+    if (std::strcmp(name, "greedy") == 0) policy = ShopPolicy::GREEDY;
+    else if (std::strcmp(name, "random") == 0) policy = ShopPolicy::RANDOM;
+    else if (std::strcmp(name, "saver") == 0) policy = ShopPolicy::SAVER;
+    else if (std::strcmp(name, "none") == 0) policy = ShopPolicy::NONE;
+    else return false;
+    return true;
+}
+
+const char* policyName(ShopPolicy policy) {
+    switch (policy) {
+        case ShopPolicy::GREEDY: return "greedy";
+        case ShopPolicy::RANDOM: return "random";
+        case ShopPolicy::SAVER: return "saver";
+        case ShopPolicy::NONE: return "none";
+    }
+    return "";
+}
+
+void printUsage() {
+    std::cout << "Usage: balance_sim [--runs=N] [--waves=N] [--seed=N] [--threads=N] [--skill=0..1]\n"
+                 "                   [--policy=greedy|random|saver|none] [--out=balance_results.tsv]\n"
+                 "                   [--defs=data/defs.bin]" << std::endl;
+}
+
+bool writeResults(const SimOptions& options, std::vector<RunResult>& results) {
+    FILE* file = std::fopen(options.out.c_str(), "w");
+    if (!file) return false;
+
+    std::fprintf(file, "# balance_sim runs=%d waves=%d seed=%u skill=%.2f policy=%s\n",
+                 options.runs, options.waves, options.seed, options.skill, policyName(options.policy));
+
+    // Where runs end
+    std::fprintf(file, "# survival\twave\truns_died\n");
+    std::vector<int> deaths(options.waves + 1, 0);
+    for (const RunResult& run : results) deaths[run.diedOnWave]++;
+    for (int wave = 1; wave <= options.waves; wave++) {
+        std::fprintf(file, "survival\t%d\t%d\n", wave, deaths[wave]);
+    }
+    std::fprintf(file, "survival\tcleared\t%d\n", deaths[0]);
+
+    // Materials held at the end of each wave, before shopping
+    std::fprintf(file, "# materials\twave\talive\tmean\tp10\tp50\tp90\tmax\n");
+    std::vector<int> values;
+    for (int wave = 1; wave <= options.waves; wave++) {
+        values.clear();
+        for (const RunResult& run : results) {
+            if (run.materials[wave - 1] >= 0) values.push_back(run.materials[wave - 1]);
+        }
+        if (values.empty()) continue;
+        double sum = 0;
+        for (int v : values) sum += v;
+        int maxValue = *std::max_element(values.begin(), values.end());
+        std::fprintf(file, "materials\t%d\t%zu\t%.1f\t%d\t%d\t%d\t%d\n", wave, values.size(), sum / values.size(),
+                     percentile(values, 0.1f), percentile(values, 0.5f), percentile(values, 0.9f), maxValue);
+    }
+
+    // Boss kill times among runs that reached the boss
+    std::fprintf(file, "# boss\twave\treached\tkilled\tp10_s\tp50_s\tp90_s\n");
+    std::vector<float> times;
+    for (int wave = 1; wave <= options.waves; wave++) {
+        if (!Balance::isBossWave(wave)) continue;
+        int reached = 0;
+        times.clear();
+        for (const RunResult& run : results) {
+            bool gotThere = run.diedOnWave == 0 || run.diedOnWave >= wave;
+            if (!gotThere) continue;
+            reached++;
+            if (run.bossKillTime[wave - 1] >= 0.0f) times.push_back(run.bossKillTime[wave - 1]);
+        }
+        std::fprintf(file, "boss\t%d\t%d\t%zu\t%.1f\t%.1f\t%.1f\n", wave, reached, times.size(),
+                     percentile(times, 0.1f), percentile(times, 0.5f), percentile(times, 0.9f));
+    }
+
+    std::fclose(file);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SimOptions options;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--runs=", 7) == 0) {
+            options.runs = std::max(1, std::atoi(arg + 7));
+        } else if (std::strncmp(arg, "--waves=", 8) == 0) {
+            options.waves = std::max(1, std::atoi(arg + 8));
+        } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+            options.seed = static_cast<uint32_t>(std::strtoul(arg + 7, nullptr, 10));
+        } else if (std::strncmp(arg, "--threads=", 10) == 0) {
+            options.threads = std::max(0, std::atoi(arg + 10));
+        } else if (std::strncmp(arg, "--skill=", 8) == 0) {
+            options.skill = std::clamp(static_cast<float>(std::atof(arg + 8)), 0.0f, 1.0f);
+        } else if (std::strncmp(arg, "--policy=", 9) == 0) {
+            if (!parsePolicy(arg + 9, options.policy)) {
+                printUsage();
+                return 1;
+            }
+        } else if (std::strncmp(arg, "--out=", 6) == 0) {
+            options.out = arg + 6;
+        } else if (std::strncmp(arg, "--defs=", 7) == 0) {
+            options.defs = arg + 7;
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (!Defs::load(options.defs)) return 1;
+
+    int threadCount = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+    threadCount = std::clamp(threadCount, 1, options.runs);
+
+    std::vector<RunResult> results(options.runs);
+    std::atomic<int> nextRun{0};
+    auto worker = [&]() {
+        for (int run = nextRun++; run < options.runs; run = nextRun++) {
+            results[run] = Run(options, run).play();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threadCount; i++) pool.emplace_back(worker);
+    for (std::thread& thread : pool) thread.join();
+    float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+    if (!writeResults(options, results)) {
+        std::cout << "Could not write " << options.out << std::endl;
+        return 1;
+    }
+
+    int cleared = 0;
+    for (const RunResult& run : results) {
+        if (run.diedOnWave == 0) cleared++;
+    }
+    std::printf("%d runs on %d threads in %.2f s, %.1f%% cleared %d waves -> %s\n", options.runs, threadCount,
+                seconds, 100.0f * cleared / options.runs, options.waves, options.out.c_str());
+    return 0;
+}
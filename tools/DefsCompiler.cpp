@@ -0,0 +1,397 @@
+// Offline definitions compiler: turns the text sources in data/ into the flat
+// table the game indexes in place (see src/DefsFormat.h).
+//
+//   defs_compiler <output.bin> <data-dir>
+//
+// Reads weapons.def, enemies.def and items.def. Sources are INI-like:
+//
+//   # comment
+//   [key]
+//   field = value
+//
+// Unknown fields, bad numbers and missing built-in entries are reported as
+// file:line errors and fail the build, so a typo never reaches the game.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "DefsFormat.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Entries the game refers to by enum, in enum order (WeaponType, EnemyType, ItemType)
+const char* const BUILTIN_WEAPONS[] = {"pistol", "smg", "brick_on_stick"};
+const char* const BUILTIN_ENEMIES[] = {"base", "slime", "pebblin"};
+const char* const BUILTIN_ITEMS[] = {"healing_box", "mass_bomb"};
+
+const double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+
+int errorCount = 0;
+
+struct Field {
+    std::string value;
+    int line = 0;
+    bool used = false;
+};
+
+struct Section {
+    std::string file;
+    std::string key;
+    int line = 0;
+    std::map<std::string, Field> fields;
+
+    void error(int at, const std::string& message) const {
+        std::cout << file << ":" << at << ": error: " << message << std::endl;
+        errorCount++;
+    }
+
+    const Field* find(const char* name) {
+        auto it = fields.find(name);
+        if (it == fields.end()) return nullptr;
+        it->second.used = true;
+        return &it->second;
+    }
+
+    void reportUnused() const {
+        for (const auto& [name, field] : fields) {
+            if (!field.used) error(field.line, "unknown field '" + name + "' in [" + key + "]");
+        }
+    }
+};
+
+std::string trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+std::vector<std::string> splitWords(const std::string& text) {
+    std::vector<std::string> words;
+    std::istringstream stream(text);
+    for (std::string word; stream >> word;) words.push_back(word);
+    return words;
+}
+
+bool parseFile(const fs::path& path, std::vector<Section>& sections) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cout << path.string() << ": error: cannot open" << std::endl;
+        errorCount++;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        std::string text = trim(line);
+        if (text.empty() || text[0] == '#') continue;
+
+        if (text.front() == '[' && text.back() == ']') {
+            Section section;
+            section.file = path.string();
+            section.key = trim(text.substr(1, text.size() - 2));
+            section.line = lineNumber;
+            for (const Section& existing : sections) {
+                if (existing.key == section.key) section.error(lineNumber, "duplicate [" + section.key + "]");
+            }
+            sections.push_back(section);
+            continue;
+        }
+
+        size_t equals = text.find('=');
+        if (equals == std::string::npos || sections.empty()) {
+            std::cout << path.string() << ":" << lineNumber << ": error: expected [key] or field = value" << std::endl;
+            errorCount++;
+            continue;
+        }
+        std::string name = trim(text.substr(0, equals));
+        Field& field = sections.back().fields[name];
+        if (field.line != 0) sections.back().error(lineNumber, "'" + name + "' set twice");
+        field.value = trim(text.substr(equals + 1));
+        field.line = lineNumber;
+    }
+    return true;
+}
+
+// Deduplicated NUL-terminated strings; offset 0 is the empty string
+class StringTable {
+public:
+    StringTable() : data(1, '\0') {}
+
+    uint32_t add(const std::string& text) {
+        if (text.empty()) return 0;
+        auto it = offsets.find(text);
+        if (it != offsets.end()) return it->second;
+        uint32_t offset = static_cast<uint32_t>(data.size());
+        data += text;
+        data += '\0';
+        offsets[text] = offset;
+        return offset;
+    }
+
+    const std::string& bytes() const { return data; }
+
+private:
+    std::string data;
+    std::map<std::string, uint32_t> offsets;
+};
+
+std::string unescape(const std::string& text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\\' && i + 1 < text.size() && text[i + 1] == 'n') {
+            out += '\n';
+            i++;
+        } else {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+std::string readText(Section& section, const char* name, const std::string& fallback) {
+    const Field* field = section.find(name);
+    return field ? unescape(field->value) : fallback;
+}
+
+bool toFloat(Section& section, const Field& field, const std::string& word, float& out) {
+    char* end = nullptr;
+    double value = std::strtod(word.c_str(), &end);
+    if (end == word.c_str() || *end != '\0' || !std::isfinite(value)) {
+        section.error(field.line, "'" + word + "' is not a number");
+        return false;
+    }
+    out = static_cast<float>(value);
+    return true;
+}
+
+float readFloat(Section& section, const char* name, float fallback) {
+    const Field* field = section.find(name);
+    if (!field) return fallback;
+    float value = fallback;
+    toFloat(section, *field, field->value, value);
+    return value;
+}
+
+int32_t readInt(Section& section, const char* name, int32_t fallback) {
+    return static_cast<int32_t>(std::lround(readFloat(section, name, static_cast<float>(fallback))));
+}
+
+bool readFlag(Section& section, const char* name) {
+    const Field* field = section.find(name);
+    if (!field) return false;
+    if (field->value == "yes" || field->value == "true") return true;
+    if (field->value != "no" && field->value != "false") {
+        section.error(field->line, std::string(name) + " must be yes or no");
+    }
+    return false;
+}
+
+// One value for all tiers or one per tier
+std::vector<std::string> readTierWords(Section& section, const char* name, const std::string& fallback) {
+    const Field* field = section.find(name);
+    std::vector<std::string> words = splitWords(field ? field->value : fallback);
+    if (words.size() == 1) words.assign(DEFS_TIER_COUNT, words[0]);
+    if (words.size() != DEFS_TIER_COUNT) {
+        section.error(field ? field->line : section.line,
+                      std::string(name) + " needs 1 or " + std::to_string(DEFS_TIER_COUNT) + " values");
+        words.assign(DEFS_TIER_COUNT, fallback);
+    }
+    return words;
+}
+
+void readTierFloats(Section& section, const char* name, float fallback, float out[DEFS_TIER_COUNT]) {
+    const Field* field = section.find(name);
+    std::vector<std::string> words = splitWords(field ? field->value : "");
+    if (!field) words.assign(DEFS_TIER_COUNT, "");
+    else if (words.size() == 1) words.assign(DEFS_TIER_COUNT, words[0]);
+    if (words.size() != DEFS_TIER_COUNT) {
+        section.error(field->line, std::string(name) + " needs 1 or " + std::to_string(DEFS_TIER_COUNT) + " values");
+    }
+    for (int tier = 0; tier < DEFS_TIER_COUNT; tier++) {
+        out[tier] = fallback;
+        if (field && tier < static_cast<int>(words.size())) toFloat(section, *field, words[tier], out[tier]);
+    }
+}
+
+template<size_t N>
+void checkBuiltins(const std::vector<Section>& sections, const char* const (&keys)[N], const char* file, bool exact) {
+    for (size_t i = 0; i < N; i++) {
+        if (i >= sections.size() || sections[i].key != keys[i]) {
+            std::cout << file << ": error: entry " << i << " must be [" << keys[i] << "] (named in code)" << std::endl;
+            errorCount++;
+        }
+    }
+    if (exact && sections.size() != N) {
+        std::cout << file << ": error: expected exactly " << N << " entries; new ones need code" << std::endl;
+        errorCount++;
+    }
+}
+
+WeaponDef compileWeapon(Section& section, StringTable& strings) {
+    // Defaults match WeaponStats' constructor
+    WeaponDef def = {};
+    def.key = strings.add(section.key);
+    std::string name = readText(section, "name", section.key);
+    def.description = strings.add(readText(section, "description", ""));
+    if (readFlag(section, "melee")) def.flags |= DEFS_WEAPON_MELEE;
+    if (readFlag(section, "shop")) def.flags |= DEFS_WEAPON_SHOP;
+    def.range = readFloat(section, "range", 400.0f);
+    def.critMultiplier = readFloat(section, "crit_multiplier", 2.0f);
+    def.knockback = readInt(section, "knockback", 0);
+    def.lifesteal = readFloat(section, "lifesteal", 0.0f);
+    def.rangedScaling = readFloat(section, "ranged_scaling", 1.0f);
+    def.meleeScaling = readFloat(section, "melee_scaling", 0.0f);
+    def.elementalScaling = readFloat(section, "elemental_scaling", 0.0f);
+    def.pellets = readInt(section, "pellets", 1);
+    def.spread = static_cast<float>(readFloat(section, "spread", 0.0f) * DEGREES_TO_RADIANS);
+    def.bulletSpeed = readFloat(section, "bullet_speed", 400.0f);
+    if (def.pellets < 1) section.error(section.line, "pellets must be at least 1");
+
+    float damage[DEFS_TIER_COUNT], cooldown[DEFS_TIER_COUNT], crit[DEFS_TIER_COUNT];
+    readTierFloats(section, "damage", 10.0f, damage);
+    readTierFloats(section, "cooldown", 1.0f, cooldown);
+    readTierFloats(section, "crit_chance", 0.05f, crit);
+    std::vector<std::string> sprites = readTierWords(section, "sprite", "assets/weapons/pistol.png");
+
+    std::vector<std::string> tierNames(DEFS_TIER_COUNT);
+    if (const Field* field = section.find("tier_names")) {
+        // Comma-separated, since names have spaces
+        std::stringstream stream(field->value);
+        tierNames.clear();
+        for (std::string part; std::getline(stream, part, ',');) tierNames.push_back(trim(part));
+        if (tierNames.size() != DEFS_TIER_COUNT) {
+            section.error(field->line, "tier_names needs " + std::to_string(DEFS_TIER_COUNT) + " comma-separated names");
+            tierNames.resize(DEFS_TIER_COUNT);
+        }
+    } else {
+        tierNames[0] = name;
+        for (int tier = 1; tier < DEFS_TIER_COUNT; tier++) {
+            tierNames[tier] = "Tier " + std::to_string(tier + 1) + " " + name;
+        }
+    }
+
+    for (int tier = 0; tier < DEFS_TIER_COUNT; tier++) {
+        WeaponTierDef& t = def.tiers[tier];
+        t.name = strings.add(tierNames[tier]);
+        t.sprite = strings.add(sprites[tier]);
+        t.damage = static_cast<int32_t>(std::lround(damage[tier]));
+        t.cooldown = cooldown[tier];
+        t.critChance = crit[tier];
+        if (t.cooldown <= 0.0f) section.error(section.line, "cooldown must be positive");
+    }
+    section.reportUnused();
+    return def;
+}
+
+EnemyDef compileEnemy(Section& section, StringTable& strings) {
+    EnemyDef def = {};
+    def.key = strings.add(section.key);
+    def.info.speed = readFloat(section, "speed", 80.0f);
+    def.info.radius = readFloat(section, "radius", 30.0f);
+    def.info.damage = readInt(section, "damage", 10);
+    def.info.health = readInt(section, "health", 1);
+    def.info.fireCooldown = readFloat(section, "fire_cooldown", 0.0f);
+    def.info.frameInterval = readFloat(section, "frame_interval", 0.5f);
+    section.reportUnused();
+    return def;
+}
+
+ItemDef compileItem(Section& section, StringTable& strings) {
+    ItemDef def = {};
+    def.key = strings.add(section.key);
+    def.name = strings.add(readText(section, "name", section.key));
+    def.description = strings.add(readText(section, "description", ""));
+    def.icon = strings.add(readText(section, "icon", ""));
+    def.fuseSeconds = readFloat(section, "fuse", 0.0f);
+    def.radiusPerPower = readFloat(section, "radius_per_power", 0.0f);
+    section.reportUnused();
+    return def;
+}
+
+template<typename T>
+void writeArray(std::ofstream& out, const std::vector<T>& values) {
+    out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cout << "Usage: defs_compiler <output.bin> <data-dir>" << std::endl;
+        return 1;
+    }
+    const fs::path output = argv[1];
+    const fs::path dataDir = argv[2];
+
+    std::vector<Section> weaponSections, enemySections, itemSections;
+    parseFile(dataDir / "weapons.def", weaponSections);
+    parseFile(dataDir / "enemies.def", enemySections);
+    parseFile(dataDir / "items.def", itemSections);
+
+    checkBuiltins(weaponSections, BUILTIN_WEAPONS, "weapons.def", false);
+    checkBuiltins(enemySections, BUILTIN_ENEMIES, "enemies.def", true);
+    checkBuiltins(itemSections, BUILTIN_ITEMS, "items.def", true);
+    if (weaponSections.size() > DEFS_MAX_WEAPONS) {
+        std::cout << "weapons.def: error: at most " << DEFS_MAX_WEAPONS << " weapons" << std::endl;
+        errorCount++;
+    }
+
+    StringTable strings;
+    std::vector<WeaponDef> weapons;
+    std::vector<EnemyDef> enemies;
+    std::vector<ItemDef> items;
+    for (Section& section : weaponSections) weapons.push_back(compileWeapon(section, strings));
+    for (Section& section : enemySections) enemies.push_back(compileEnemy(section, strings));
+    for (Section& section : itemSections) items.push_back(compileItem(section, strings));
+
+    if (errorCount > 0) {
+        std::cout << errorCount << " error(s); " << output.string() << " not written" << std::endl;
+        return 1;
+    }
+
+    DefsHeader header = {};
+    header.magic = DEFS_MAGIC;
+    header.version = DEFS_VERSION;
+    header.weaponCount = static_cast<uint32_t>(weapons.size());
+    header.enemyCount = static_cast<uint32_t>(enemies.size());
+    header.itemCount = static_cast<uint32_t>(items.size());
+    header.weaponsOffset = sizeof(DefsHeader);
+    header.enemiesOffset = header.weaponsOffset + static_cast<uint32_t>(weapons.size() * sizeof(WeaponDef));
+    header.itemsOffset = header.enemiesOffset + static_cast<uint32_t>(enemies.size() * sizeof(EnemyDef));
+    header.stringsOffset = header.itemsOffset + static_cast<uint32_t>(items.size() * sizeof(ItemDef));
+    header.stringsSize = static_cast<uint32_t>(strings.bytes().size());
+
+    if (output.has_parent_path()) {
+        std::error_code ignored;
+        fs::create_directories(output.parent_path(), ignored);
+    }
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(out, weapons);
+    writeArray(out, enemies);
+    writeArray(out, items);
+    out.write(strings.bytes().data(), static_cast<std::streamsize>(strings.bytes().size()));
+    out.close();
+    if (!out) {
+        std::cout << "Failed while writing " << output.string() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << output.string() << ": " << weapons.size() << " weapons, " << enemies.size()
+              << " enemies, " << items.size() << " items, " << header.stringsOffset + header.stringsSize
+              << " bytes" << std::endl;
+    return 0;
+}